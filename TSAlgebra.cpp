@@ -13,6 +13,48 @@
 using namespace Terathon;
 
 
+namespace
+{
+	enum
+	{
+		kMatrix4DLayoutColumnMajor,
+		kMatrix4DLayoutRowMajor,
+		kMatrix4DLayoutOther
+	};
+
+	constexpr bool IsMatrix4DLayout(int count, int i00, int i01, int i02, int i03, int i10, int i11, int i12, int i13, int i20, int i21, int i22, int i23, int i30, int i31, int i32, int i33, int rowStride, int columnStride)
+	{
+		return ((count == 16) && (i00 == 0) && (i01 == columnStride) && (i02 == columnStride * 2) && (i03 == columnStride * 3)
+			&& (i10 == rowStride) && (i11 == rowStride + columnStride) && (i12 == rowStride + columnStride * 2) && (i13 == rowStride + columnStride * 3)
+			&& (i20 == rowStride * 2) && (i21 == rowStride * 2 + columnStride) && (i22 == rowStride * 2 + columnStride * 2) && (i23 == rowStride * 2 + columnStride * 3)
+			&& (i30 == rowStride * 3) && (i31 == rowStride * 3 + columnStride) && (i32 == rowStride * 3 + columnStride * 2) && (i33 == rowStride * 3 + columnStride * 3));
+	}
+
+	constexpr int GetMatrix4DLayout(int count, int i00, int i01, int i02, int i03, int i10, int i11, int i12, int i13, int i20, int i21, int i22, int i23, int i30, int i31, int i32, int i33)
+	{
+		return ((IsMatrix4DLayout(count, i00, i01, i02, i03, i10, i11, i12, i13, i20, i21, i22, i23, i30, i31, i32, i33, 1, 4)) ? kMatrix4DLayoutColumnMajor :
+			((IsMatrix4DLayout(count, i00, i01, i02, i03, i10, i11, i12, i13, i20, i21, i22, i23, i30, i31, i32, i33, 4, 1)) ? kMatrix4DLayoutRowMajor : kMatrix4DLayoutOther));
+	}
+
+	#ifndef TERATHON_NO_SIMD
+
+		inline void LoadMatrix4DColumns(const float *data, int layout, vec_float *column)
+		{
+			column[0] = VecLoad(data);
+			column[1] = VecLoad(data + 4);
+			column[2] = VecLoad(data + 8);
+			column[3] = VecLoad(data + 12);
+
+			if (layout == kMatrix4DLayoutRowMajor)
+			{
+				VecTranspose4D(column[0], column[1], column[2], column[3], &column[0], &column[1], &column[2], &column[3]);
+			}
+		}
+
+	#endif
+}
+
+
 template <typename A_type_struct, int A_count, int A_index_00, int A_index_01, int A_index_10, int A_index_11,
 		  typename B_type_struct, int B_count, int B_index_00, int B_index_01, int B_index_10, int B_index_11>
 TERATHON_API typename A_type_struct::matrix2D_type Terathon::operator *(const Submat2D<A_type_struct, A_count, A_index_00, A_index_01, A_index_10, A_index_11>& A,
@@ -72,6 +114,46 @@ template <typename A_type_struct, int A_count, int A_index_00, int A_index_01, i
 TERATHON_API typename A_type_struct::matrix4D_type Terathon::operator *(const Submat4D<A_type_struct, A_count, A_index_00, A_index_01, A_index_02, A_index_03, A_index_10, A_index_11, A_index_12, A_index_13, A_index_20, A_index_21, A_index_22, A_index_23, A_index_30, A_index_31, A_index_32, A_index_33>& A,
                                                                         const Submat4D<B_type_struct, B_count, B_index_00, B_index_01, B_index_02, B_index_03, B_index_10, B_index_11, B_index_12, B_index_13, B_index_20, B_index_21, B_index_22, B_index_23, B_index_30, B_index_31, B_index_32, B_index_33>& B)
 {
+	#ifndef TERATHON_NO_SIMD
+
+		// When both operands are stored as whole 4x4 matrices in either column-major or row-major order, the
+		// columns of the product are calculated with vector operations. A row-major operand is transposed after
+		// it's loaded so that the same kernel handles all four combinations of matrices and their transposes.
+
+		constexpr int A_layout = GetMatrix4DLayout(A_count, A_index_00, A_index_01, A_index_02, A_index_03, A_index_10, A_index_11, A_index_12, A_index_13, A_index_20, A_index_21, A_index_22, A_index_23, A_index_30, A_index_31, A_index_32, A_index_33);
+		constexpr int B_layout = GetMatrix4DLayout(B_count, B_index_00, B_index_01, B_index_02, B_index_03, B_index_10, B_index_11, B_index_12, B_index_13, B_index_20, B_index_21, B_index_22, B_index_23, B_index_30, B_index_31, B_index_32, B_index_33);
+
+		if ((A_layout != kMatrix4DLayoutOther) && (B_layout != kMatrix4DLayoutOther))
+		{
+			typename A_type_struct::matrix4D_type	result;
+			vec_float								a[4], b[4];
+
+			LoadMatrix4DColumns(A.data, A_layout, a);
+			LoadMatrix4DColumns(B.data, B_layout, b);
+
+			#if defined(TERATHON_AVX)
+
+				exv_float c1 = ExvFloat(a[0], a[0]);
+				exv_float c2 = ExvFloat(a[1], a[1]);
+				exv_float c3 = ExvFloat(a[2], a[2]);
+				exv_float c4 = ExvFloat(a[3], a[3]);
+				ExvStoreUnaligned(ExvTransformVector4D(c1, c2, c3, c4, ExvFloat(b[0], b[1])), &result(0,0));
+				ExvStoreUnaligned(ExvTransformVector4D(c1, c2, c3, c4, ExvFloat(b[2], b[3])), &result(0,2));
+
+			#else
+
+				for (machine j = 0; j < 4; j++)
+				{
+					VecStore(VecTransformVector4D(a[0], a[1], a[2], a[3], b[j]), &result(0,j));
+				}
+
+			#endif
+
+			return (result);
+		}
+
+	#endif
+
 	return (typename A_type_struct::matrix4D_type(A.data[A_index_00] * B.data[B_index_00] + A.data[A_index_01] * B.data[B_index_10] + A.data[A_index_02] * B.data[B_index_20] + A.data[A_index_03] * B.data[B_index_30],
 												  A.data[A_index_00] * B.data[B_index_01] + A.data[A_index_01] * B.data[B_index_11] + A.data[A_index_02] * B.data[B_index_21] + A.data[A_index_03] * B.data[B_index_31],
 												  A.data[A_index_00] * B.data[B_index_02] + A.data[A_index_01] * B.data[B_index_12] + A.data[A_index_02] * B.data[B_index_22] + A.data[A_index_03] * B.data[B_index_32],
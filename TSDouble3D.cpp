@@ -0,0 +1,468 @@
+//
+// This file is part of the Terathon Math Library, by Eric Lengyel.
+// Copyright 1999-2025, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+
+#include "TSDouble3D.h"
+#include "TSSimdDispatch.h"
+
+
+using namespace Terathon;
+
+
+namespace
+{
+	#if defined(TERATHON_SSE)
+
+		double SqrtDouble(double x)
+		{
+			double		result;
+
+			_mm_store_sd(&result, _mm_sqrt_sd(_mm_setzero_pd(), _mm_load_sd(&x)));
+			return ((x > 0.0) ? result : 0.0);
+		}
+
+		double InverseSqrtDouble(double x)
+		{
+			return (1.0 / SqrtDouble(x));
+		}
+
+	#else
+
+		double InverseSqrtDouble(double x)
+		{
+			// The single-precision estimate is calculated for x divided by an even power of two 2^(2k) that brings it
+			// close to one, so the estimate cannot underflow or overflow, and the result is then multiplied by 2^-k.
+			// Each Newton iteration roughly doubles the number of correct bits, so two of them are enough to go from
+			// the 22-bit estimate to full double precision.
+
+			uint64		bits;
+			double		scale, unscale;
+
+			if ((x == 0.0) || (x > 1.7976931348623157e308))
+			{
+				return (1.0 / x);
+			}
+
+			memcpy(&bits, &x, 8);
+			int32 k = (int32((bits >> 52) & 0x07FF) - 1023) >> 1;
+			k = (k < -511) ? -511 : k;
+
+			bits = uint64(1023 - k * 2) << 52;
+			memcpy(&scale, &bits, 8);
+			bits = uint64(1023 - k) << 52;
+			memcpy(&unscale, &bits, 8);
+
+			x *= scale;
+			double y = InverseSqrt(float(x));
+			double h = x * 0.5;
+
+			y = y * (1.5 - h * y * y);
+			y = y * (1.5 - h * y * y);
+			return (y * unscale);
+		}
+
+		double SqrtDouble(double x)
+		{
+			return ((x > 0.0) ? x * InverseSqrtDouble(x) : 0.0);
+		}
+
+	#endif
+}
+
+
+double Terathon::Magnitude(const DoubleVector3D& v)
+{
+	return (SqrtDouble(SquaredMag(v)));
+}
+
+double Terathon::InverseMag(const DoubleVector3D& v)
+{
+	return (InverseSqrtDouble(SquaredMag(v)));
+}
+
+DoubleVector3D& DoubleVector3D::Normalize(void)
+{
+	return (*this *= InverseMag(*this));
+}
+
+
+DoubleQuaternion& DoubleQuaternion::Normalize(void)
+{
+	return (*this *= InverseSqrtDouble(SquaredMag(*this)));
+}
+
+DoubleQuaternion Terathon::operator *(const DoubleQuaternion& q1, const DoubleQuaternion& q2)
+{
+	return (DoubleQuaternion(q1.w * q2.x + q1.x * q2.w + q1.y * q2.z - q1.z * q2.y,
+	                         q1.w * q2.y - q1.x * q2.z + q1.y * q2.w + q1.z * q2.x,
+	                         q1.w * q2.z + q1.x * q2.y - q1.y * q2.x + q1.z * q2.w,
+	                         q1.w * q2.w - q1.x * q2.x - q1.y * q2.y - q1.z * q2.z));
+}
+
+DoubleVector3D Terathon::Transform(const DoubleVector3D& v, const DoubleQuaternion& q)
+{
+	DoubleVector3D b(q.x, q.y, q.z);
+
+	DoubleVector3D u = Cross(b, v) * 2.0;
+	return (Cross(b, u) + u * double(q.w) + v);
+}
+
+
+DoubleTransform3D::DoubleTransform3D(double n00, double n01, double n02, double n03, double n10, double n11, double n12, double n13, double n20, double n21, double n22, double n23)
+{
+	n[0][0] = n00;
+	n[0][1] = n10;
+	n[0][2] = n20;
+	n[0][3] = 0.0;
+	n[1][0] = n01;
+	n[1][1] = n11;
+	n[1][2] = n21;
+	n[1][3] = 0.0;
+	n[2][0] = n02;
+	n[2][1] = n12;
+	n[2][2] = n22;
+	n[2][3] = 0.0;
+	n[3][0] = n03;
+	n[3][1] = n13;
+	n[3][2] = n23;
+	n[3][3] = 1.0;
+}
+
+DoubleTransform3D::DoubleTransform3D(const DoubleVector3D& a, const DoubleVector3D& b, const DoubleVector3D& c, const DoublePoint3D& p)
+{
+	n[0][0] = a.x;
+	n[0][1] = a.y;
+	n[0][2] = a.z;
+	n[0][3] = 0.0;
+	n[1][0] = b.x;
+	n[1][1] = b.y;
+	n[1][2] = b.z;
+	n[1][3] = 0.0;
+	n[2][0] = c.x;
+	n[2][1] = c.y;
+	n[2][2] = c.z;
+	n[2][3] = 0.0;
+	n[3][0] = p.x;
+	n[3][1] = p.y;
+	n[3][2] = p.z;
+	n[3][3] = 1.0;
+}
+
+DoubleTransform3D::DoubleTransform3D(const Transform3D& m)
+{
+	for (machine j = 0; j < 4; j++)
+	{
+		#ifndef TERATHON_NO_SIMD
+
+			VecDoubleStore(VecFloatConvertDouble(VecLoad(&m(0,j))), n[j]);
+
+		#else
+
+			n[j][0] = m(0,j);
+			n[j][1] = m(1,j);
+			n[j][2] = m(2,j);
+			n[j][3] = m(3,j);
+
+		#endif
+	}
+}
+
+DoubleTransform3D& DoubleTransform3D::SetIdentity(void)
+{
+	for (machine j = 0; j < 4; j++)
+	{
+		for (machine i = 0; i < 4; i++)
+		{
+			n[j][i] = (i == j) ? 1.0 : 0.0;
+		}
+	}
+
+	return (*this);
+}
+
+Transform3D DoubleTransform3D::GetTransform3D(void) const
+{
+	Transform3D		result;
+
+	for (machine j = 0; j < 4; j++)
+	{
+		#ifndef TERATHON_NO_SIMD
+
+			VecStore(VecDoubleConvertFloat(VecDoubleLoad(n[j])), &result(0,j));
+
+		#else
+
+			result(0,j) = float(n[j][0]);
+			result(1,j) = float(n[j][1]);
+			result(2,j) = float(n[j][2]);
+			result(3,j) = float(n[j][3]);
+
+		#endif
+	}
+
+	return (result);
+}
+
+Transform3D DoubleTransform3D::GetRelativeTransform3D(const DoublePoint3D& origin) const
+{
+	Transform3D result = GetTransform3D();
+	result.SetTranslation(float(n[3][0] - origin.x), float(n[3][1] - origin.y), float(n[3][2] - origin.z));
+	return (result);
+}
+
+
+DoubleTransform3D Terathon::operator *(const DoubleTransform3D& m1, const DoubleTransform3D& m2)
+{
+	#ifndef TERATHON_NO_SIMD
+
+		DoubleTransform3D	result;
+
+		vec_double c1 = VecDoubleLoad(m1.GetColumn(0));
+		vec_double c2 = VecDoubleLoad(m1.GetColumn(1));
+		vec_double c3 = VecDoubleLoad(m1.GetColumn(2));
+		vec_double c4 = VecDoubleLoad(m1.GetColumn(3));
+
+		VecDoubleStore(VecDoubleTransformVector3D(c1, c2, c3, VecDoubleLoad(m2.GetColumn(0))), &result(0,0));
+		VecDoubleStore(VecDoubleTransformVector3D(c1, c2, c3, VecDoubleLoad(m2.GetColumn(1))), &result(0,1));
+		VecDoubleStore(VecDoubleTransformVector3D(c1, c2, c3, VecDoubleLoad(m2.GetColumn(2))), &result(0,2));
+		VecDoubleStore(VecDoubleTransformPoint3D(c1, c2, c3, c4, VecDoubleLoad(m2.GetColumn(3))), &result(0,3));
+		return (result);
+
+	#else
+
+		return (DoubleTransform3D(m1(0,0) * m2(0,0) + m1(0,1) * m2(1,0) + m1(0,2) * m2(2,0),
+		                          m1(0,0) * m2(0,1) + m1(0,1) * m2(1,1) + m1(0,2) * m2(2,1),
+		                          m1(0,0) * m2(0,2) + m1(0,1) * m2(1,2) + m1(0,2) * m2(2,2),
+		                          m1(0,0) * m2(0,3) + m1(0,1) * m2(1,3) + m1(0,2) * m2(2,3) + m1(0,3),
+		                          m1(1,0) * m2(0,0) + m1(1,1) * m2(1,0) + m1(1,2) * m2(2,0),
+		                          m1(1,0) * m2(0,1) + m1(1,1) * m2(1,1) + m1(1,2) * m2(2,1),
+		                          m1(1,0) * m2(0,2) + m1(1,1) * m2(1,2) + m1(1,2) * m2(2,2),
+		                          m1(1,0) * m2(0,3) + m1(1,1) * m2(1,3) + m1(1,2) * m2(2,3) + m1(1,3),
+		                          m1(2,0) * m2(0,0) + m1(2,1) * m2(1,0) + m1(2,2) * m2(2,0),
+		                          m1(2,0) * m2(0,1) + m1(2,1) * m2(1,1) + m1(2,2) * m2(2,1),
+		                          m1(2,0) * m2(0,2) + m1(2,1) * m2(1,2) + m1(2,2) * m2(2,2),
+		                          m1(2,0) * m2(0,3) + m1(2,1) * m2(1,3) + m1(2,2) * m2(2,3) + m1(2,3)));
+
+	#endif
+}
+
+DoubleVector3D Terathon::operator *(const DoubleTransform3D& m, const DoubleVector3D& v)
+{
+	#ifndef TERATHON_NO_SIMD
+
+		DoubleVector3D		result;
+
+		vec_double r = VecDoubleTransformVector3D(VecDoubleLoad(m.GetColumn(0)), VecDoubleLoad(m.GetColumn(1)), VecDoubleLoad(m.GetColumn(2)), VecDoubleLoad3D(&v.x));
+		VecDoubleStore3D(r, &result.x);
+		return (result);
+
+	#else
+
+		return (DoubleVector3D(m(0,0) * v.x + m(0,1) * v.y + m(0,2) * v.z,
+		                       m(1,0) * v.x + m(1,1) * v.y + m(1,2) * v.z,
+		                       m(2,0) * v.x + m(2,1) * v.y + m(2,2) * v.z));
+
+	#endif
+}
+
+DoublePoint3D Terathon::operator *(const DoubleTransform3D& m, const DoublePoint3D& p)
+{
+	#ifndef TERATHON_NO_SIMD
+
+		DoublePoint3D		result;
+
+		vec_double r = VecDoubleTransformPoint3D(VecDoubleLoad(m.GetColumn(0)), VecDoubleLoad(m.GetColumn(1)), VecDoubleLoad(m.GetColumn(2)), VecDoubleLoad(m.GetColumn(3)), VecDoubleLoad3D(&p.x));
+		VecDoubleStore3D(r, &result.x);
+		return (result);
+
+	#else
+
+		return (DoublePoint3D(m(0,0) * p.x + m(0,1) * p.y + m(0,2) * p.z + m(0,3),
+		                      m(1,0) * p.x + m(1,1) * p.y + m(1,2) * p.z + m(1,3),
+		                      m(2,0) * p.x + m(2,1) * p.y + m(2,2) * p.z + m(2,3)));
+
+	#endif
+}
+
+DoubleTransform3D Terathon::Inverse(const DoubleTransform3D& m)
+{
+	// See FGED1, Section 2.6.
+
+	const DoubleVector3D& a = m[0];
+	const DoubleVector3D& b = m[1];
+	const DoubleVector3D& c = m[2];
+	const DoubleVector3D& d = m[3];
+
+	DoubleVector3D s = Cross(a, b);
+	DoubleVector3D t = Cross(c, d);
+
+	double invDet = 1.0 / Dot(s, c);
+
+	s *= invDet;
+	t *= invDet;
+	DoubleVector3D v = c * invDet;
+
+	DoubleVector3D r0 = Cross(b, v);
+	DoubleVector3D r1 = Cross(v, a);
+
+	return (DoubleTransform3D(r0.x, r0.y, r0.z, -Dot(b, t),
+	                          r1.x, r1.y, r1.z,  Dot(a, t),
+	                          s.x,  s.y,  s.z,  -Dot(d, s)));
+}
+
+void Terathon::TransformPoints(const DoubleTransform3D& m, const DoublePoint3D *in, DoublePoint3D *out, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->TransformPointsDoubleTransform3D(&m, in, out, count);
+			return;
+		}
+
+	#endif
+
+	#ifndef TERATHON_NO_SIMD
+
+		vec_double c1 = VecDoubleLoad(m.GetColumn(0));
+		vec_double c2 = VecDoubleLoad(m.GetColumn(1));
+		vec_double c3 = VecDoubleLoad(m.GetColumn(2));
+		vec_double c4 = VecDoubleLoad(m.GetColumn(3));
+
+		for (machine k = 0; k < count; k++)
+		{
+			VecDoubleStore3D(VecDoubleTransformPoint3D(c1, c2, c3, c4, VecDoubleLoad3D(&in[k].x)), &out[k].x);
+		}
+
+	#else
+
+		for (machine k = 0; k < count; k++)
+		{
+			out[k] = m * in[k];
+		}
+
+	#endif
+}
+
+void Terathon::TransformVectors(const DoubleTransform3D& m, const DoubleVector3D *in, DoubleVector3D *out, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->TransformVectorsDoubleTransform3D(&m, in, out, count);
+			return;
+		}
+
+	#endif
+
+	#ifndef TERATHON_NO_SIMD
+
+		vec_double c1 = VecDoubleLoad(m.GetColumn(0));
+		vec_double c2 = VecDoubleLoad(m.GetColumn(1));
+		vec_double c3 = VecDoubleLoad(m.GetColumn(2));
+
+		for (machine k = 0; k < count; k++)
+		{
+			VecDoubleStore3D(VecDoubleTransformVector3D(c1, c2, c3, VecDoubleLoad3D(&in[k].x)), &out[k].x);
+		}
+
+	#else
+
+		for (machine k = 0; k < count; k++)
+		{
+			out[k] = m * in[k];
+		}
+
+	#endif
+}
+
+
+DoubleMotor3D& DoubleMotor3D::Unitize(void)
+{
+	return (*this *= InverseSqrtDouble(SquaredMag(v)));
+}
+
+DoublePoint3D DoubleMotor3D::GetPosition(void) const
+{
+	double A03 = v.y * m.z - v.z * m.y;
+	double A13 = v.z * m.x - v.x * m.z;
+	double A23 = v.x * m.y - v.y * m.x;
+	double B03 = m.x * v.w - v.x * m.w;
+	double B13 = m.y * v.w - v.y * m.w;
+	double B23 = m.z * v.w - v.z * m.w;
+
+	return (DoublePoint3D((A03 + B03) * 2.0, (A13 + B13) * 2.0, (A23 + B23) * 2.0));
+}
+
+DoubleTransform3D DoubleMotor3D::GetTransformMatrix(void) const
+{
+	double vx2 = v.x * v.x;
+	double vy2 = v.y * v.y;
+	double vz2 = v.z * v.z;
+
+	double A00 = 1.0 - (vy2 + vz2) * 2.0;
+	double A11 = 1.0 - (vz2 + vx2) * 2.0;
+	double A22 = 1.0 - (vx2 + vy2) * 2.0;
+	double A01 = v.x * v.y;
+	double A02 = v.z * v.x;
+	double A12 = v.y * v.z;
+	double A03 = v.y * m.z - v.z * m.y;
+	double A13 = v.z * m.x - v.x * m.z;
+	double A23 = v.x * m.y - v.y * m.x;
+
+	double B01 = v.z * v.w;
+	double B20 = v.y * v.w;
+	double B12 = v.x * v.w;
+	double B03 = m.x * v.w - v.x * m.w;
+	double B13 = m.y * v.w - v.y * m.w;
+	double B23 = m.z * v.w - v.z * m.w;
+
+	return (DoubleTransform3D(       A00,        (A01 - B01) * 2.0, (A02 + B20) * 2.0, (A03 + B03) * 2.0,
+	                          (A01 + B01) * 2.0,        A11,        (A12 - B12) * 2.0, (A13 + B13) * 2.0,
+	                          (A02 - B20) * 2.0, (A12 + B12) * 2.0,        A22,        (A23 + B23) * 2.0));
+}
+
+DoubleMotor3D Terathon::operator *(const DoubleMotor3D& a, const DoubleMotor3D& b)
+{
+	return (DoubleMotor3D(a.v.w * b.v.x + a.v.x * b.v.w + a.v.y * b.v.z - a.v.z * b.v.y,
+	                      a.v.w * b.v.y + a.v.y * b.v.w + a.v.z * b.v.x - a.v.x * b.v.z,
+	                      a.v.w * b.v.z + a.v.z * b.v.w + a.v.x * b.v.y - a.v.y * b.v.x,
+	                      a.v.w * b.v.w - a.v.x * b.v.x - a.v.y * b.v.y - a.v.z * b.v.z,
+	                      a.m.w * b.v.x + a.m.x * b.v.w + a.m.y * b.v.z - a.m.z * b.v.y + b.m.w * a.v.x + b.m.x * a.v.w - b.m.y * a.v.z + b.m.z * a.v.y,
+	                      a.m.w * b.v.y - a.m.x * b.v.z + a.m.y * b.v.w + a.m.z * b.v.x + b.m.w * a.v.y + b.m.x * a.v.z + b.m.y * a.v.w - b.m.z * a.v.x,
+	                      a.m.w * b.v.z + a.m.x * b.v.y - a.m.y * b.v.x + a.m.z * b.v.w + b.m.w * a.v.z - b.m.x * a.v.y + b.m.y * a.v.x + b.m.z * a.v.w,
+	                      a.m.w * b.v.w - a.m.x * b.v.x - a.m.y * b.v.y - a.m.z * b.v.z + b.m.w * a.v.w - b.m.x * a.v.x - b.m.y * a.v.y - b.m.z * a.v.z));
+}
+
+DoublePoint3D Terathon::Transform(const DoublePoint3D& p, const DoubleMotor3D& Q)
+{
+	DoubleVector3D v(Q.v.x, Q.v.y, Q.v.z);
+	DoubleVector3D m(Q.m.x, Q.m.y, Q.m.z);
+
+	DoubleVector3D a = Cross(v, p) + m;
+	DoubleVector3D u = Cross(v, a) + a * double(Q.v.w) - v * double(Q.m.w);
+	return (p + (u + u));
+}
+
+DoubleVector3D Terathon::Transform(const DoubleVector3D& v, const DoubleMotor3D& Q)
+{
+	return (Transform(v, Q.v));
+}
+
+void Terathon::TransformPoints(const DoubleMotor3D& Q, const DoublePoint3D *in, DoublePoint3D *out, machine count)
+{
+	TransformPoints(Q.GetTransformMatrix(), in, out, count);
+}
+
+void Terathon::TransformVectors(const DoubleMotor3D& Q, const DoubleVector3D *in, DoubleVector3D *out, machine count)
+{
+	TransformVectors(Q.GetTransformMatrix(), in, out, count);
+}
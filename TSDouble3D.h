@@ -0,0 +1,764 @@
+//
+// This file is part of the Terathon Math Library, by Eric Lengyel.
+// Copyright 1999-2025, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+
+#ifndef TSDouble3D_h
+#define TSDouble3D_h
+
+
+#include "TSMotor3D.h"
+#include "TSMatrix4D.h"
+
+
+#define TERATHON_DOUBLE3D 1
+
+
+namespace Terathon
+{
+	class DoubleVector2D;
+	class DoubleVector3D;
+	class DoublePoint3D;
+
+
+	// ==============================================
+	//	DoubleVector2D
+	// ==============================================
+
+	struct TypeDoubleVector2D
+	{
+		typedef double component_type;
+		typedef DoubleVector2D vector2D_type;
+	};
+
+
+	/// \brief Encapsulates a double-precision 2D vector.
+	///
+	/// The $DoubleVector2D$ class is used to store a two-dimensional vector having double-precision
+	/// components <i>x</i> and <i>y</i>. It is primarily the type of the two-component swizzles of a
+	/// $DoubleVector3D$ object.
+	///
+	/// \also DoubleVector3D
+
+	class DoubleVector2D : public Vec2D<TypeDoubleVector2D>
+	{
+		public:
+
+			inline DoubleVector2D() = default;
+
+			DoubleVector2D(const DoubleVector2D& v)
+			{
+				xy = v.xy;
+			}
+
+			DoubleVector2D(double a, double b) : Vec2D<TypeDoubleVector2D>(a, b) {}
+
+			template <typename type>
+			explicit DoubleVector2D(const Vec2D<type>& v) : Vec2D<TypeDoubleVector2D>(double(v.x), double(v.y)) {}
+
+			DoubleVector2D& Set(double a, double b)
+			{
+				xy.Set(a, b);
+				return (*this);
+			}
+
+			DoubleVector2D& operator =(const DoubleVector2D& v)
+			{
+				xy = v.xy;
+				return (*this);
+			}
+	};
+
+
+	// ==============================================
+	//	DoubleVector3D
+	// ==============================================
+
+	struct TypeDoubleVector3D
+	{
+		typedef double component_type;
+		typedef DoubleVector2D vector2D_type;
+		typedef DoubleVector3D vector3D_type;
+	};
+
+
+	/// \brief Encapsulates a double-precision 3D vector.
+	///
+	/// The $DoubleVector3D$ class is used to store a three-dimensional direction vector having double-precision
+	/// components <i>x</i>, <i>y</i>, and <i>z</i>. It is intended for large-world coordinates that cannot be
+	/// represented to the necessary precision by the $Vector3D$ class. A $DoubleVector3D$ object can be explicitly
+	/// converted to and from a $Vector3D$ object.
+	///
+	/// \also DoublePoint3D
+	/// \also Vector3D
+
+	class DoubleVector3D : public Vec3D<TypeDoubleVector3D>
+	{
+		public:
+
+			/// \brief Default constructor that leaves the components uninitialized.
+
+			inline DoubleVector3D() = default;
+
+			DoubleVector3D(const DoubleVector3D& v)
+			{
+				xyz = v.xyz;
+			}
+
+			/// \brief Constructor that sets components explicitly.
+			/// \param a,b,c	The components of the vector.
+
+			DoubleVector3D(double a, double b, double c) : Vec3D<TypeDoubleVector3D>(a, b, c) {}
+
+			template <typename type>
+			explicit DoubleVector3D(const Vec3D<type>& v) : Vec3D<TypeDoubleVector3D>(double(v.x), double(v.y), double(v.z)) {}
+
+			/// \brief Sets all three components of a 3D vector.
+			/// \param a,b,c	The new components of the vector.
+
+			DoubleVector3D& Set(double a, double b, double c)
+			{
+				xyz.Set(a, b, c);
+				return (*this);
+			}
+
+			DoubleVector3D& operator =(const DoubleVector3D& v)
+			{
+				xyz = v.xyz;
+				return (*this);
+			}
+
+			DoubleVector3D& operator +=(const DoubleVector3D& v)
+			{
+				x += v.x;
+				y += v.y;
+				z += v.z;
+				return (*this);
+			}
+
+			DoubleVector3D& operator -=(const DoubleVector3D& v)
+			{
+				x -= v.x;
+				y -= v.y;
+				z -= v.z;
+				return (*this);
+			}
+
+			DoubleVector3D& operator *=(double n)
+			{
+				x *= n;
+				y *= n;
+				z *= n;
+				return (*this);
+			}
+
+			DoubleVector3D& operator /=(double n)
+			{
+				n = 1.0 / n;
+				x *= n;
+				y *= n;
+				z *= n;
+				return (*this);
+			}
+
+			/// \brief Converts to a single-precision 3D vector.
+
+			Vector3D GetVector3D(void) const
+			{
+				return (Vector3D(float(x), float(y), float(z)));
+			}
+
+			/// \brief Normalizes a 3D vector to unit length.
+			///
+			/// If the magnitude of the vector is zero, then the result is undefined.
+
+			TERATHON_API DoubleVector3D& Normalize(void);
+	};
+
+
+	inline DoubleVector3D operator -(const DoubleVector3D& v)
+	{
+		return (DoubleVector3D(-v.x, -v.y, -v.z));
+	}
+
+	inline DoubleVector3D operator +(const DoubleVector3D& a, const DoubleVector3D& b)
+	{
+		return (DoubleVector3D(a.x + b.x, a.y + b.y, a.z + b.z));
+	}
+
+	inline DoubleVector3D operator -(const DoubleVector3D& a, const DoubleVector3D& b)
+	{
+		return (DoubleVector3D(a.x - b.x, a.y - b.y, a.z - b.z));
+	}
+
+	/// \brief Returns the product of the 3D vector $v$ and the scalar $n$.
+	/// \related DoubleVector3D
+
+	inline DoubleVector3D operator *(const DoubleVector3D& v, double n)
+	{
+		return (DoubleVector3D(v.x * n, v.y * n, v.z * n));
+	}
+
+	/// \brief Returns the product of the 3D vector $v$ and the scalar $n$.
+	/// \related DoubleVector3D
+
+	inline DoubleVector3D operator *(double n, const DoubleVector3D& v)
+	{
+		return (DoubleVector3D(n * v.x, n * v.y, n * v.z));
+	}
+
+	/// \brief Returns the product of the 3D vector $v$ and the inverse of the scalar $n$.
+	/// \related DoubleVector3D
+
+	inline DoubleVector3D operator /(const DoubleVector3D& v, double n)
+	{
+		n = 1.0 / n;
+		return (DoubleVector3D(v.x * n, v.y * n, v.z * n));
+	}
+
+	/// \brief Returns the componentwise product of the 3D vectors $a$ and $b$.
+	/// \related DoubleVector3D
+
+	inline DoubleVector3D operator *(const DoubleVector3D& a, const DoubleVector3D& b)
+	{
+		return (DoubleVector3D(a.x * b.x, a.y * b.y, a.z * b.z));
+	}
+
+	/// \brief Returns the dot product between the 3D vectors $a$ and $b$.
+	/// \related DoubleVector3D
+
+	inline double Dot(const DoubleVector3D& a, const DoubleVector3D& b)
+	{
+		return (a.x * b.x + a.y * b.y + a.z * b.z);
+	}
+
+	/// \brief Returns the cross product between the 3D vectors $a$ and $b$.
+	/// \related DoubleVector3D
+
+	inline DoubleVector3D Cross(const DoubleVector3D& a, const DoubleVector3D& b)
+	{
+		return (DoubleVector3D(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x));
+	}
+
+	/// \brief Returns the squared magnitude of the 3D vector $v$.
+	/// \related DoubleVector3D
+
+	inline double SquaredMag(const DoubleVector3D& v)
+	{
+		return (v.x * v.x + v.y * v.y + v.z * v.z);
+	}
+
+	/// \brief Returns the magnitude of the 3D vector $v$.
+	/// \related DoubleVector3D
+
+	TERATHON_API double Magnitude(const DoubleVector3D& v);
+
+	/// \brief Returns the inverse magnitude of the 3D vector $v$.
+	/// \related DoubleVector3D
+
+	TERATHON_API double InverseMag(const DoubleVector3D& v);
+
+	/// \brief Returns the normalized version of the 3D vector $v$.
+	/// \related DoubleVector3D
+
+	inline DoubleVector3D Normalize(const DoubleVector3D& v)
+	{
+		return (v * InverseMag(v));
+	}
+
+
+	// ==============================================
+	//	DoublePoint3D
+	// ==============================================
+
+	/// \brief Encapsulates a double-precision 3D point.
+	///
+	/// The $DoublePoint3D$ class is used to store a three-dimensional point having double-precision
+	/// components <i>x</i>, <i>y</i>, and <i>z</i>. The difference between two $DoublePoint3D$ objects
+	/// is a $DoubleVector3D$ object.
+	///
+	/// \also DoubleVector3D
+	/// \also Point3D
+
+	class DoublePoint3D : public DoubleVector3D
+	{
+		public:
+
+			/// \brief Default constructor that leaves the components uninitialized.
+
+			inline DoublePoint3D() = default;
+
+			DoublePoint3D(const DoublePoint3D& p) : DoubleVector3D(p) {}
+
+			/// \brief Constructor that sets components explicitly.
+			/// \param a,b,c	The components of the point.
+
+			DoublePoint3D(double a, double b, double c) : DoubleVector3D(a, b, c) {}
+
+			explicit DoublePoint3D(const DoubleVector3D& v) : DoubleVector3D(v) {}
+
+			template <typename type>
+			explicit DoublePoint3D(const Vec3D<type>& v) : DoubleVector3D(v) {}
+
+			DoublePoint3D& Set(double a, double b, double c)
+			{
+				xyz.Set(a, b, c);
+				return (*this);
+			}
+
+			DoublePoint3D& operator =(const DoublePoint3D& p)
+			{
+				xyz = p.xyz;
+				return (*this);
+			}
+
+			DoublePoint3D& operator +=(const DoubleVector3D& v)
+			{
+				x += v.x;
+				y += v.y;
+				z += v.z;
+				return (*this);
+			}
+
+			DoublePoint3D& operator -=(const DoubleVector3D& v)
+			{
+				x -= v.x;
+				y -= v.y;
+				z -= v.z;
+				return (*this);
+			}
+
+			/// \brief Converts to a single-precision 3D point.
+
+			Point3D GetPoint3D(void) const
+			{
+				return (Point3D(float(x), float(y), float(z)));
+			}
+
+			/// \brief Returns the single-precision position of a point relative to an origin.
+			/// \param origin	The origin relative to which the position is calculated.
+			///
+			/// The difference is calculated in double precision before it is converted to single precision,
+			/// so the result retains full single precision when the point is near the origin, regardless of
+			/// how far both of them are from the world origin.
+
+			Point3D GetRelativePoint3D(const DoublePoint3D& origin) const
+			{
+				return (Point3D(float(x - origin.x), float(y - origin.y), float(z - origin.z)));
+			}
+	};
+
+
+	inline DoublePoint3D operator -(const DoublePoint3D& p)
+	{
+		return (DoublePoint3D(-p.x, -p.y, -p.z));
+	}
+
+	inline DoublePoint3D operator +(const DoublePoint3D& p, const DoubleVector3D& v)
+	{
+		return (DoublePoint3D(p.x + v.x, p.y + v.y, p.z + v.z));
+	}
+
+	inline DoublePoint3D operator -(const DoublePoint3D& p, const DoubleVector3D& v)
+	{
+		return (DoublePoint3D(p.x - v.x, p.y - v.y, p.z - v.z));
+	}
+
+	inline DoubleVector3D operator -(const DoublePoint3D& a, const DoublePoint3D& b)
+	{
+		return (DoubleVector3D(a.x - b.x, a.y - b.y, a.z - b.z));
+	}
+
+	inline DoublePoint3D operator +(const DoublePoint3D& p, const Vector3D& v)
+	{
+		return (DoublePoint3D(p.x + v.x, p.y + v.y, p.z + v.z));
+	}
+
+	inline DoublePoint3D operator -(const DoublePoint3D& p, const Vector3D& v)
+	{
+		return (DoublePoint3D(p.x - v.x, p.y - v.y, p.z - v.z));
+	}
+
+
+	// ==============================================
+	//	DoubleQuaternion
+	// ==============================================
+
+	struct TypeDoubleQuaternion
+	{
+		typedef double component_type;
+		typedef DoubleVector3D vector3D_type;
+	};
+
+
+	/// \brief Encapsulates a double-precision quaternion.
+	///
+	/// The $DoubleQuaternion$ class encapsulates a Hamiltonian quaternion having double-precision components
+	/// in the form <i>xi</i>&#x202F;+&#x202F;<i>yj</i>&#x202F;+&#x202F;<i>zk</i>&#x202F;+&#x202F;<i>w</i>.
+	///
+	/// \also DoubleMotor3D
+	/// \also Quaternion
+
+	class DoubleQuaternion
+	{
+		public:
+
+			union
+			{
+				Component<TypeDoubleQuaternion, 4, 0>					x;			///< The <i>x</i> coordinate of the bivector part.
+				Component<TypeDoubleQuaternion, 4, 1>					y;			///< The <i>y</i> coordinate of the bivector part.
+				Component<TypeDoubleQuaternion, 4, 2>					z;			///< The <i>z</i> coordinate of the bivector part.
+				Component<TypeDoubleQuaternion, 4, 3>					w;			///< The <i>w</i> coordinate, which is the scalar part.
+				Subvec3D<TypeDoubleQuaternion, false, 4, 0, 1, 2>		xyz;		///< The <i>x</i>, <i>y</i>, and <i>z</i> coordinates together.
+			};
+
+			/// \brief Default constructor that leaves the components uninitialized.
+
+			inline DoubleQuaternion() = default;
+
+			DoubleQuaternion(const DoubleQuaternion& q)
+			{
+				xyz = q.xyz;
+				w = q.w;
+			}
+
+			/// \brief Constructor that sets components explicitly.
+			/// \param a,b,c	The components of the bivector part.
+			/// \param s		The scalar part.
+
+			DoubleQuaternion(double a, double b, double c, double s)
+			{
+				xyz.Set(a, b, c);
+				w = s;
+			}
+
+			explicit DoubleQuaternion(const Quaternion& q)
+			{
+				xyz.Set(q.x, q.y, q.z);
+				w = q.w;
+			}
+
+			DoubleQuaternion& Set(double a, double b, double c, double s)
+			{
+				xyz.Set(a, b, c);
+				w = s;
+				return (*this);
+			}
+
+			DoubleQuaternion& operator =(const DoubleQuaternion& q)
+			{
+				xyz = q.xyz;
+				w = q.w;
+				return (*this);
+			}
+
+			DoubleQuaternion& operator *=(double n)
+			{
+				xyz *= n;
+				w *= n;
+				return (*this);
+			}
+
+			/// \brief Converts to a single-precision quaternion.
+
+			Quaternion GetQuaternion(void) const
+			{
+				return (Quaternion(float(x), float(y), float(z), float(w)));
+			}
+
+			/// \brief Normalizes a quaternion to unit magnitude.
+
+			TERATHON_API DoubleQuaternion& Normalize(void);
+	};
+
+
+	/// \brief Returns the conjugate of the quaternion $q$.
+	/// \related DoubleQuaternion
+
+	inline DoubleQuaternion operator ~(const DoubleQuaternion& q)
+	{
+		return (DoubleQuaternion(-q.x, -q.y, -q.z, q.w));
+	}
+
+	/// \brief Returns the product of the quaternions $q1$ and $q2$.
+	/// \related DoubleQuaternion
+
+	TERATHON_API DoubleQuaternion operator *(const DoubleQuaternion& q1, const DoubleQuaternion& q2);
+
+	/// \brief Returns the squared magnitude of the quaternion $q$.
+	/// \related DoubleQuaternion
+
+	inline double SquaredMag(const DoubleQuaternion& q)
+	{
+		return (q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+	}
+
+	/// \brief Transforms the vector $v$ with the unit quaternion $q$.
+	/// \related DoubleQuaternion
+
+	TERATHON_API DoubleVector3D Transform(const DoubleVector3D& v, const DoubleQuaternion& q);
+
+
+	// ==============================================
+	//	DoubleTransform3D
+	// ==============================================
+
+	/// \brief Encapsulates a double-precision 3D affine transformation.
+	///
+	/// The $DoubleTransform3D$ class is used to store a 3D affine transformation with double-precision entries.
+	/// Like the $Transform3D$ class, the entries are stored in column-major order as a full 4&#x202F;&times;&#x202F;4
+	/// matrix whose fourth row is always (0,&#x202F;0,&#x202F;0,&#x202F;1), and they are accessed using the () operator
+	/// with two indexes specifying the row and column of an entry. The storage is aligned so that each column can be
+	/// loaded as a single $vec_double$ value.
+	///
+	/// \also DoubleMotor3D
+	/// \also Transform3D
+
+	class DoubleTransform3D
+	{
+		private:
+
+			alignas(32) double		n[4][4];
+
+		public:
+
+			/// \brief Default constructor that leaves the entries uninitialized.
+
+			inline DoubleTransform3D() = default;
+
+			/// \brief Constructor that sets entries explicitly.
+			/// \param n00,n01,n02,n03,n10,n11,n12,n13,n20,n21,n22,n23		The entries of first three rows of the transform.
+
+			TERATHON_API DoubleTransform3D(double n00, double n01, double n02, double n03, double n10, double n11, double n12, double n13, double n20, double n21, double n22, double n23);
+
+			/// \brief Constructor that sets columns explicitly.
+			/// \param a,b,c	The first three columns of the transform.
+			/// \param p		The fourth column of the transform.
+
+			TERATHON_API DoubleTransform3D(const DoubleVector3D& a, const DoubleVector3D& b, const DoubleVector3D& c, const DoublePoint3D& p);
+
+			/// \brief Constructor that converts a single-precision transform.
+
+			TERATHON_API explicit DoubleTransform3D(const Transform3D& m);
+
+			double& operator ()(machine i, machine j)
+			{
+				return (n[j][i]);
+			}
+
+			const double& operator ()(machine i, machine j) const
+			{
+				return (n[j][i]);
+			}
+
+			DoubleVector3D& operator [](machine j)
+			{
+				return (reinterpret_cast<DoubleVector3D&>(n[j][0]));
+			}
+
+			const DoubleVector3D& operator [](machine j) const
+			{
+				return (reinterpret_cast<const DoubleVector3D&>(n[j][0]));
+			}
+
+			/// \brief Returns a pointer to the four entries of the column with index $j$.
+
+			const double *GetColumn(machine j) const
+			{
+				return (n[j]);
+			}
+
+			const DoublePoint3D& GetTranslation(void) const
+			{
+				return (reinterpret_cast<const DoublePoint3D&>(n[3][0]));
+			}
+
+			DoubleTransform3D& SetTranslation(const DoublePoint3D& p)
+			{
+				n[3][0] = p.x;
+				n[3][1] = p.y;
+				n[3][2] = p.z;
+				return (*this);
+			}
+
+			/// \brief Sets a transform to the identity.
+
+			TERATHON_API DoubleTransform3D& SetIdentity(void);
+
+			/// \brief Converts to a single-precision transform.
+
+			TERATHON_API Transform3D GetTransform3D(void) const;
+
+			/// \brief Returns a single-precision transform relative to an origin.
+			/// \param origin	The origin relative to which the translation is expressed.
+			///
+			/// The $GetRelativeTransform3D()$ function returns the transform that results from applying this transform
+			/// and then translating by the negation of $origin$. The translation is calculated in double precision before it
+			/// is converted to single precision, so the result is suitable for rendering relative to a camera position in
+			/// a large world.
+
+			TERATHON_API Transform3D GetRelativeTransform3D(const DoublePoint3D& origin) const;
+	};
+
+
+	/// \brief Returns the product of the transforms $m1$ and $m2$.
+	/// \related DoubleTransform3D
+
+	TERATHON_API DoubleTransform3D operator *(const DoubleTransform3D& m1, const DoubleTransform3D& m2);
+
+	/// \brief Returns the product of the transform $m$ and the vector $v$.
+	/// \related DoubleTransform3D
+
+	TERATHON_API DoubleVector3D operator *(const DoubleTransform3D& m, const DoubleVector3D& v);
+
+	/// \brief Returns the product of the transform $m$ and the point $p$.
+	/// \related DoubleTransform3D
+
+	TERATHON_API DoublePoint3D operator *(const DoubleTransform3D& m, const DoublePoint3D& p);
+
+	/// \brief Returns the inverse of the transform $m$. If $m$ is singular, then the result is undefined.
+	/// \related DoubleTransform3D
+
+	TERATHON_API DoubleTransform3D Inverse(const DoubleTransform3D& m);
+
+	/// \brief Transforms the $count$ points in the array $in$ with the transform $m$ and stores the results in the array $out$.
+	/// The $in$ and $out$ arrays may be the same, but they must not otherwise overlap.
+	/// \related DoubleTransform3D
+
+	TERATHON_API void TransformPoints(const DoubleTransform3D& m, const DoublePoint3D *in, DoublePoint3D *out, machine count);
+
+	/// \brief Transforms the $count$ vectors in the array $in$ with the transform $m$ and stores the results in the array $out$.
+	/// The $in$ and $out$ arrays may be the same, but they must not otherwise overlap.
+	/// \related DoubleTransform3D
+
+	TERATHON_API void TransformVectors(const DoubleTransform3D& m, const DoubleVector3D *in, DoubleVector3D *out, machine count);
+
+
+	// ==============================================
+	//	DoubleMotor3D
+	// ==============================================
+
+	/// \brief Encapsulates a double-precision 3D motion operator (motor).
+	///
+	/// The $DoubleMotor3D$ class encapsulates a 3D motor with double-precision components. It uses the same
+	/// conventions as the $Motor3D$ class.
+	///
+	/// \also DoubleTransform3D
+	/// \also Motor3D
+
+	class DoubleMotor3D
+	{
+		public:
+
+			DoubleQuaternion		v;			///< The coordinates of the weight components using basis elements <b>e</b><sub>41</sub>, <b>e</b><sub>42</sub>, <b>e</b><sub>43</sub>, and <b>e</b><sub>1234</sub>.
+			DoubleQuaternion		m;			///< The coordinates of the bulk components using basis elements <b>e</b><sub>23</sub>, <b>e</b><sub>31</sub>, <b>e</b><sub>12</sub>, and <b>1</b>.
+
+			/// \brief Default constructor that leaves the components uninitialized.
+
+			inline DoubleMotor3D() = default;
+
+			/// \brief Constructor that sets components explicitly.
+			/// \param vx,vy,vz,vw		The values of the <b>e</b><sub>41</sub>, <b>e</b><sub>42</sub>, <b>e</b><sub>43</sub>, and antiscalar coordinates.
+			/// \param mx,my,mz,mw		The values of the <b>e</b><sub>23</sub>, <b>e</b><sub>31</sub>, <b>e</b><sub>12</sub>, and scalar coordinates.
+
+			DoubleMotor3D(double vx, double vy, double vz, double vw, double mx, double my, double mz, double mw)
+			{
+				v.Set(vx, vy, vz, vw);
+				m.Set(mx, my, mz, mw);
+			}
+
+			DoubleMotor3D(const DoubleQuaternion& rotor, const DoubleQuaternion& screw)
+			{
+				v = rotor;
+				m = screw;
+			}
+
+			/// \brief Constructor that converts a single-precision motor.
+
+			explicit DoubleMotor3D(const Motor3D& Q) : v(Q.v), m(Q.m) {}
+
+			DoubleMotor3D& Set(double vx, double vy, double vz, double vw, double mx, double my, double mz, double mw)
+			{
+				v.Set(vx, vy, vz, vw);
+				m.Set(mx, my, mz, mw);
+				return (*this);
+			}
+
+			DoubleMotor3D& operator *=(double n)
+			{
+				v *= n;
+				m *= n;
+				return (*this);
+			}
+
+			/// \brief Converts to a single-precision motor.
+
+			Motor3D GetMotor3D(void) const
+			{
+				return (Motor3D(v.GetQuaternion(), m.GetQuaternion()));
+			}
+
+			/// \brief Unitizes the weight of a 3D motor.
+
+			TERATHON_API DoubleMotor3D& Unitize(void);
+
+			/// \brief Returns the position of the origin after it is transformed by the motor.
+
+			TERATHON_API DoublePoint3D GetPosition(void) const;
+
+			/// \brief Converts a unitized motor to its equivalent 3D affine transformation.
+
+			TERATHON_API DoubleTransform3D GetTransformMatrix(void) const;
+
+			/// \brief Returns a 3D motor that represents a translation.
+			/// \param offset	The offset vector.
+
+			static DoubleMotor3D MakeTranslation(const DoubleVector3D& offset)
+			{
+				return (DoubleMotor3D(0.0, 0.0, 0.0, 1.0, offset.x * 0.5, offset.y * 0.5, offset.z * 0.5, 0.0));
+			}
+	};
+
+
+	/// \brief Returns the antireverse of the 3D motor $Q$.
+	/// \related DoubleMotor3D
+
+	inline DoubleMotor3D operator ~(const DoubleMotor3D& Q)
+	{
+		return (DoubleMotor3D(-Q.v.x, -Q.v.y, -Q.v.z, Q.v.w, -Q.m.x, -Q.m.y, -Q.m.z, Q.m.w));
+	}
+
+	/// \brief Returns the geometric antiproduct of the 3D motors $a$ and $b$.
+	/// \related DoubleMotor3D
+
+	TERATHON_API DoubleMotor3D operator *(const DoubleMotor3D& a, const DoubleMotor3D& b);
+
+	/// \brief Transforms the point $p$ with the unitized motor $Q$.
+	/// \related DoubleMotor3D
+
+	TERATHON_API DoublePoint3D Transform(const DoublePoint3D& p, const DoubleMotor3D& Q);
+
+	/// \brief Transforms the vector $v$ with the unitized motor $Q$.
+	/// \related DoubleMotor3D
+
+	TERATHON_API DoubleVector3D Transform(const DoubleVector3D& v, const DoubleMotor3D& Q);
+
+	/// \brief Transforms the $count$ points in the array $in$ with the unitized motor $Q$ and stores the results in the array $out$.
+	/// The $in$ and $out$ arrays may be the same, but they must not otherwise overlap.
+	/// \related DoubleMotor3D
+
+	TERATHON_API void TransformPoints(const DoubleMotor3D& Q, const DoublePoint3D *in, DoublePoint3D *out, machine count);
+
+	/// \brief Transforms the $count$ vectors in the array $in$ with the unitized motor $Q$ and stores the results in the array $out$.
+	/// The $in$ and $out$ arrays may be the same, but they must not otherwise overlap.
+	/// \related DoubleMotor3D
+
+	TERATHON_API void TransformVectors(const DoubleMotor3D& Q, const DoubleVector3D *in, DoubleVector3D *out, machine count);
+}
+
+
+#endif
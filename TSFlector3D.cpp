@@ -8,11 +8,62 @@
 
 
 #include "TSFlector3D.h"
+#include "TSSimdDispatch.h"
 
 
 using namespace Terathon;
 
 
+#ifndef TERATHON_NO_SIMD
+
+	namespace
+	{
+		// A flector multiplies like the pair of quaternions (p.xyz, g.w) and (g.xyz, p.w), so exchanging
+		// the w components converts between that pair and the (p, g) storage order in both directions.
+
+		inline void VecExchangeW(const vec_float& p, const vec_float& g, vec_float *a, vec_float *b)
+		{
+			alignas(16) static const uint32 mask[4] = {0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF};
+
+			vec_float w = VecLoad(reinterpret_cast<const float *>(mask));
+			*a = VecSelect(p, g, w);
+			*b = VecSelect(g, p, w);
+		}
+
+		// These follow the scalar Line3D and Plane3D transforms operation for operation, so they
+		// produce identical results when the compiler does not fuse the multiplies and adds.
+
+		inline void VecFlectorTransformLine(const vec_float& p, const vec_float& g, const vec_float& lv, const vec_float& lm, vec_float *rv, vec_float *rm)
+		{
+			vec_float pw = VecSmearW(p);
+			vec_float gw = VecSmearW(g);
+			vec_float two = VecLoadVectorConstant<0x40000000>();
+
+			vec_float a = VecCross3D(g, lv) * two;
+			*rv = VecCross3D(g, a) + a * pw + lv;
+
+			vec_float d = VecCross3D(p, lv) * two - VecCross3D(g, lm) * two;
+			*rm = d * pw + a * gw + VecCross3D(p, a) + VecCross3D(g, d) - lm;
+		}
+
+		inline vec_float VecFlectorTransformPlane(const vec_float& p, const vec_float& g, const vec_float& h, vec_float *rw)
+		{
+			vec_float pw = VecSmearW(p);
+			vec_float gw = VecSmearW(g);
+			vec_float two = VecLoadVectorConstant<0x40000000>();
+
+			vec_float hp = VecDot3D(h, p);
+			vec_float hg = VecDot3D(h, g);
+
+			vec_float a = VecCross3D(g, h) * two;
+			*rw = (hg * gw - hp * pw - VecDot3D(VecCross3D(h, p), g)) * two - VecSmearW(h);
+			return (VecCross3D(g, a) + a * pw + h);
+		}
+	}
+
+#endif
+
+
 Transform3D Flector3D::GetTransformMatrix(void) const
 {
 	float gx2 = g.x * g.x;
@@ -145,14 +196,26 @@ Flector3D& Flector3D::SetTransformMatrix(const Transform3D& M)
 		p.w = (M(1,0) - M(0,1)) * f;
 	}
 
-	float tx = M(0,3) * 0.5F;
-	float ty = M(1,3) * 0.5F;
-	float tz = M(2,3) * 0.5F;
+	#ifndef TERATHON_NO_SIMD
+
+		vec_float t = VecLoad3D(&M.GetTranslation().x) * VecLoadVectorConstant<0x3F000000>();
+		vec_float u = VecLoad3D(&g.x);
 
-	p.x =  p.w * tx + g.z * ty - g.y * tz;
-	p.y =  p.w * ty + g.x * tz - g.z * tx;
-	p.z =  p.w * tz + g.y * tx - g.x * ty;
-	g.w = -g.x * tx - g.y * ty - g.z * tz;
+		VecStore3D(t * VecLoadSmearScalar(&p.w) + VecCross3D(t, u), &p.x);
+		VecStoreX(VecNegate(VecDot3D(u, t)), &g.w);
+
+	#else
+
+		float tx = M(0,3) * 0.5F;
+		float ty = M(1,3) * 0.5F;
+		float tz = M(2,3) * 0.5F;
+
+		p.x =  p.w * tx + g.z * ty - g.y * tz;
+		p.y =  p.w * ty + g.x * tz - g.z * tx;
+		p.z =  p.w * tz + g.y * tx - g.x * ty;
+		g.w = -g.x * tx - g.y * ty - g.z * tz;
+
+	#endif
 
 	return (*this);
 }
@@ -160,101 +223,443 @@ Flector3D& Flector3D::SetTransformMatrix(const Transform3D& M)
 
 Motor3D Terathon::operator *(const Flector3D& a, const Flector3D& b)
 {
-	return (Motor3D(a.g.z * b.g.y - a.g.y * b.g.z - a.g.x * b.p.w - a.p.w * b.g.x,
-	                a.g.x * b.g.z - a.g.z * b.g.x - a.g.y * b.p.w - a.p.w * b.g.y,
-	                a.g.y * b.g.x - a.g.x * b.g.y - a.g.z * b.p.w - a.p.w * b.g.z,
-	                a.g.x * b.g.x + a.g.y * b.g.y + a.g.z * b.g.z - a.p.w * b.p.w,
-	                a.p.z * b.g.y - a.p.y * b.g.z + a.g.y * b.p.z - a.g.z * b.p.y + a.g.x * b.g.w - a.g.w * b.g.x + a.p.w * b.p.x - a.p.x * b.p.w,
-	                a.p.x * b.g.z - a.p.z * b.g.x + a.g.z * b.p.x - a.g.x * b.p.z + a.g.y * b.g.w - a.g.w * b.g.y + a.p.w * b.p.y - a.p.y * b.p.w,
-	                a.p.y * b.g.x - a.p.x * b.g.y + a.g.x * b.p.y - a.g.y * b.p.x + a.g.z * b.g.w - a.g.w * b.g.z + a.p.w * b.p.z - a.p.z * b.p.w,
-	                a.p.x * b.g.x + a.p.y * b.g.y + a.p.z * b.g.z + a.p.w * b.g.w - a.g.x * b.p.x - a.g.y * b.p.y - a.g.z * b.p.z - a.g.w * b.p.w));
+	#ifndef TERATHON_NO_SIMD
+
+		// The weight of the product is -(a.g * b.g), and the bulk is a.g * b.p - a.p * b.g, where the
+		// factors are the quaternions (g.xyz, p.w) and (p.xyz, g.w) that make up each flector.
+
+		Motor3D			result;
+		vec_float		ap, ag, bp, bg;
+
+		VecExchangeW(VecLoadUnaligned(&a.p.x), VecLoadUnaligned(&a.g.x), &ap, &ag);
+		VecExchangeW(VecLoadUnaligned(&b.p.x), VecLoadUnaligned(&b.g.x), &bp, &bg);
+
+		VecStoreUnaligned(VecNegate(VecQuaternionProduct(ag, bg)), &result.v.x);
+		VecStoreUnaligned(VecQuaternionProduct(ag, bp) - VecQuaternionProduct(ap, bg), &result.m.x);
+		return (result);
+
+	#else
+
+		return (Motor3D(a.g.z * b.g.y - a.g.y * b.g.z - a.g.x * b.p.w - a.p.w * b.g.x,
+		                a.g.x * b.g.z - a.g.z * b.g.x - a.g.y * b.p.w - a.p.w * b.g.y,
+		                a.g.y * b.g.x - a.g.x * b.g.y - a.g.z * b.p.w - a.p.w * b.g.z,
+		                a.g.x * b.g.x + a.g.y * b.g.y + a.g.z * b.g.z - a.p.w * b.p.w,
+		                a.p.z * b.g.y - a.p.y * b.g.z + a.g.y * b.p.z - a.g.z * b.p.y + a.g.x * b.g.w - a.g.w * b.g.x + a.p.w * b.p.x - a.p.x * b.p.w,
+		                a.p.x * b.g.z - a.p.z * b.g.x + a.g.z * b.p.x - a.g.x * b.p.z + a.g.y * b.g.w - a.g.w * b.g.y + a.p.w * b.p.y - a.p.y * b.p.w,
+		                a.p.y * b.g.x - a.p.x * b.g.y + a.g.x * b.p.y - a.g.y * b.p.x + a.g.z * b.g.w - a.g.w * b.g.z + a.p.w * b.p.z - a.p.z * b.p.w,
+		                a.p.x * b.g.x + a.p.y * b.g.y + a.p.z * b.g.z + a.p.w * b.g.w - a.g.x * b.p.x - a.g.y * b.p.y - a.g.z * b.p.z - a.g.w * b.p.w));
+
+	#endif
 }
 
 Flector3D Terathon::operator *(const Flector3D& a, const Motor3D& b)
 {
-	return (Flector3D(a.g.z * b.m.y - a.g.y * b.m.z + a.g.w * b.v.x - a.g.x * b.m.w + a.p.y * b.v.z - a.p.z * b.v.y + a.p.x * b.v.w - a.p.w * b.m.x,
-	                  a.g.x * b.m.z - a.g.z * b.m.x + a.g.w * b.v.y - a.g.y * b.m.w + a.p.z * b.v.x - a.p.x * b.v.z + a.p.y * b.v.w - a.p.w * b.m.y,
-	                  a.g.y * b.m.x - a.g.x * b.m.y + a.g.w * b.v.z - a.g.z * b.m.w + a.p.x * b.v.y - a.p.y * b.v.x + a.p.z * b.v.w - a.p.w * b.m.z,
-	                  a.p.w * b.v.w - a.g.x * b.v.x - a.g.y * b.v.y - a.g.z * b.v.z,
-	                  a.g.y * b.v.z - a.g.z * b.v.y + a.p.w * b.v.x + a.g.x * b.v.w,
-	                  a.g.z * b.v.x - a.g.x * b.v.z + a.p.w * b.v.y + a.g.y * b.v.w,
-	                  a.g.x * b.v.y - a.g.y * b.v.x + a.p.w * b.v.z + a.g.z * b.v.w,
-	                  a.g.w * b.v.w + a.g.x * b.m.x + a.g.y * b.m.y + a.g.z * b.m.z - a.p.w * b.m.w - a.p.x * b.v.x - a.p.y * b.v.y - a.p.z * b.v.z));
+	#ifndef TERATHON_NO_SIMD
+
+		Flector3D		result;
+		vec_float		fp, fg;
+
+		vec_float v = VecLoadUnaligned(&b.v.x);
+		vec_float m = VecLoadUnaligned(&b.m.x);
+
+		VecExchangeW(VecLoadUnaligned(&a.p.x), VecLoadUnaligned(&a.g.x), &fp, &fg);
+		VecExchangeW(VecQuaternionProduct(fp, v) - VecQuaternionProduct(fg, m), VecQuaternionProduct(fg, v), &fp, &fg);
+
+		VecStoreUnaligned(fp, &result.p.x);
+		VecStoreUnaligned(fg, &result.g.x);
+		return (result);
+
+	#else
+
+		return (Flector3D(a.g.z * b.m.y - a.g.y * b.m.z + a.g.w * b.v.x - a.g.x * b.m.w + a.p.y * b.v.z - a.p.z * b.v.y + a.p.x * b.v.w - a.p.w * b.m.x,
+		                  a.g.x * b.m.z - a.g.z * b.m.x + a.g.w * b.v.y - a.g.y * b.m.w + a.p.z * b.v.x - a.p.x * b.v.z + a.p.y * b.v.w - a.p.w * b.m.y,
+		                  a.g.y * b.m.x - a.g.x * b.m.y + a.g.w * b.v.z - a.g.z * b.m.w + a.p.x * b.v.y - a.p.y * b.v.x + a.p.z * b.v.w - a.p.w * b.m.z,
+		                  a.p.w * b.v.w - a.g.x * b.v.x - a.g.y * b.v.y - a.g.z * b.v.z,
+		                  a.g.y * b.v.z - a.g.z * b.v.y + a.p.w * b.v.x + a.g.x * b.v.w,
+		                  a.g.z * b.v.x - a.g.x * b.v.z + a.p.w * b.v.y + a.g.y * b.v.w,
+		                  a.g.x * b.v.y - a.g.y * b.v.x + a.p.w * b.v.z + a.g.z * b.v.w,
+		                  a.g.w * b.v.w + a.g.x * b.m.x + a.g.y * b.m.y + a.g.z * b.m.z - a.p.w * b.m.w - a.p.x * b.v.x - a.p.y * b.v.y - a.p.z * b.v.z));
+
+	#endif
 }
 
 Flector3D Terathon::operator *(const Motor3D& a, const Flector3D& b)
 {
-	return (Flector3D(b.g.z * a.m.y - b.g.y * a.m.z + b.g.w * a.v.x + b.g.x * a.m.w + b.p.z * a.v.y - b.p.y * a.v.z + b.p.x * a.v.w + b.p.w * a.m.x,
-	                  b.g.x * a.m.z - b.g.z * a.m.x + b.g.w * a.v.y + b.g.y * a.m.w + b.p.x * a.v.z - b.p.z * a.v.x + b.p.y * a.v.w + b.p.w * a.m.y,
-	                  b.g.y * a.m.x - b.g.x * a.m.y + b.g.w * a.v.z + b.g.z * a.m.w + b.p.y * a.v.x - b.p.x * a.v.y + b.p.z * a.v.w + b.p.w * a.m.z,
-	                  b.p.w * a.v.w - b.g.x * a.v.x - b.g.y * a.v.y - b.g.z * a.v.z,
-	                  b.g.z * a.v.y - b.g.y * a.v.z + b.p.w * a.v.x + b.g.x * a.v.w,
-	                  b.g.x * a.v.z - b.g.z * a.v.x + b.p.w * a.v.y + b.g.y * a.v.w,
-	                  b.g.y * a.v.x - b.g.x * a.v.y + b.p.w * a.v.z + b.g.z * a.v.w,
-	                  b.g.w * a.v.w - b.g.x * a.m.x - b.g.y * a.m.y - b.g.z * a.m.z + b.p.w * a.m.w - b.p.x * a.v.x - b.p.y * a.v.y - b.p.z * a.v.z));
+	#ifndef TERATHON_NO_SIMD
+
+		Flector3D		result;
+		vec_float		fp, fg;
+
+		vec_float v = VecLoadUnaligned(&a.v.x);
+		vec_float m = VecLoadUnaligned(&a.m.x);
+
+		VecExchangeW(VecLoadUnaligned(&b.p.x), VecLoadUnaligned(&b.g.x), &fp, &fg);
+		VecExchangeW(VecQuaternionProduct(v, fp) + VecQuaternionProduct(m, fg), VecQuaternionProduct(v, fg), &fp, &fg);
+
+		VecStoreUnaligned(fp, &result.p.x);
+		VecStoreUnaligned(fg, &result.g.x);
+		return (result);
+
+	#else
+
+		return (Flector3D(b.g.z * a.m.y - b.g.y * a.m.z + b.g.w * a.v.x + b.g.x * a.m.w + b.p.z * a.v.y - b.p.y * a.v.z + b.p.x * a.v.w + b.p.w * a.m.x,
+		                  b.g.x * a.m.z - b.g.z * a.m.x + b.g.w * a.v.y + b.g.y * a.m.w + b.p.x * a.v.z - b.p.z * a.v.x + b.p.y * a.v.w + b.p.w * a.m.y,
+		                  b.g.y * a.m.x - b.g.x * a.m.y + b.g.w * a.v.z + b.g.z * a.m.w + b.p.y * a.v.x - b.p.x * a.v.y + b.p.z * a.v.w + b.p.w * a.m.z,
+		                  b.p.w * a.v.w - b.g.x * a.v.x - b.g.y * a.v.y - b.g.z * a.v.z,
+		                  b.g.z * a.v.y - b.g.y * a.v.z + b.p.w * a.v.x + b.g.x * a.v.w,
+		                  b.g.x * a.v.z - b.g.z * a.v.x + b.p.w * a.v.y + b.g.y * a.v.w,
+		                  b.g.y * a.v.x - b.g.x * a.v.y + b.p.w * a.v.z + b.g.z * a.v.w,
+		                  b.g.w * a.v.w - b.g.x * a.m.x - b.g.y * a.m.y - b.g.z * a.m.z + b.p.w * a.m.w - b.p.x * a.v.x - b.p.y * a.v.y - b.p.z * a.v.z));
+
+	#endif
 }
 
 Flector3D Terathon::operator *(const Flector3D& F, const Quaternion& r)
 {
-	return (Flector3D(F.g.w * r.x + F.p.y * r.z - F.p.z * r.y + F.p.x * r.w,
-	                  F.g.w * r.y + F.p.z * r.x - F.p.x * r.z + F.p.y * r.w,
-	                  F.g.w * r.z + F.p.x * r.y - F.p.y * r.x + F.p.z * r.w,
-	                  F.p.w * r.w - F.g.x * r.x - F.g.y * r.y - F.g.z * r.z,
-	                  F.g.y * r.z - F.g.z * r.y + F.p.w * r.x + F.g.x * r.w,
-	                  F.g.z * r.x - F.g.x * r.z + F.p.w * r.y + F.g.y * r.w,
-	                  F.g.x * r.y - F.g.y * r.x + F.p.w * r.z + F.g.z * r.w,
-	                  F.g.w * r.w - F.p.x * r.x - F.p.y * r.y - F.p.z * r.z));
+	#ifndef TERATHON_NO_SIMD
+
+		Flector3D		result;
+		vec_float		fp, fg;
+
+		vec_float q = VecLoadUnaligned(&r.x);
+
+		VecExchangeW(VecLoadUnaligned(&F.p.x), VecLoadUnaligned(&F.g.x), &fp, &fg);
+		VecExchangeW(VecQuaternionProduct(fp, q), VecQuaternionProduct(fg, q), &fp, &fg);
+
+		VecStoreUnaligned(fp, &result.p.x);
+		VecStoreUnaligned(fg, &result.g.x);
+		return (result);
+
+	#else
+
+		return (Flector3D(F.g.w * r.x + F.p.y * r.z - F.p.z * r.y + F.p.x * r.w,
+		                  F.g.w * r.y + F.p.z * r.x - F.p.x * r.z + F.p.y * r.w,
+		                  F.g.w * r.z + F.p.x * r.y - F.p.y * r.x + F.p.z * r.w,
+		                  F.p.w * r.w - F.g.x * r.x - F.g.y * r.y - F.g.z * r.z,
+		                  F.g.y * r.z - F.g.z * r.y + F.p.w * r.x + F.g.x * r.w,
+		                  F.g.z * r.x - F.g.x * r.z + F.p.w * r.y + F.g.y * r.w,
+		                  F.g.x * r.y - F.g.y * r.x + F.p.w * r.z + F.g.z * r.w,
+		                  F.g.w * r.w - F.p.x * r.x - F.p.y * r.y - F.p.z * r.z));
+
+	#endif
 }
 
 Flector3D Terathon::operator *(const Quaternion& r, const Flector3D& F)
 {
-	return (Flector3D(F.g.w * r.x + F.p.z * r.y - F.p.y * r.z + F.p.x * r.w,
-	                  F.g.w * r.y + F.p.x * r.z - F.p.z * r.x + F.p.y * r.w,
-	                  F.g.w * r.z + F.p.y * r.x - F.p.x * r.y + F.p.z * r.w,
-	                  F.p.w * r.w - F.g.x * r.x - F.g.y * r.y - F.g.z * r.z,
-	                  F.g.z * r.y - F.g.y * r.z + F.p.w * r.x + F.g.x * r.w,
-	                  F.g.x * r.z - F.g.z * r.x + F.p.w * r.y + F.g.y * r.w,
-	                  F.g.y * r.x - F.g.x * r.y + F.p.w * r.z + F.g.z * r.w,
-	                  F.g.w * r.w - F.p.x * r.x - F.p.y * r.y - F.p.z * r.z));
+	#ifndef TERATHON_NO_SIMD
+
+		Flector3D		result;
+		vec_float		fp, fg;
+
+		vec_float q = VecLoadUnaligned(&r.x);
+
+		VecExchangeW(VecLoadUnaligned(&F.p.x), VecLoadUnaligned(&F.g.x), &fp, &fg);
+		VecExchangeW(VecQuaternionProduct(q, fp), VecQuaternionProduct(q, fg), &fp, &fg);
+
+		VecStoreUnaligned(fp, &result.p.x);
+		VecStoreUnaligned(fg, &result.g.x);
+		return (result);
+
+	#else
+
+		return (Flector3D(F.g.w * r.x + F.p.z * r.y - F.p.y * r.z + F.p.x * r.w,
+		                  F.g.w * r.y + F.p.x * r.z - F.p.z * r.x + F.p.y * r.w,
+		                  F.g.w * r.z + F.p.y * r.x - F.p.x * r.y + F.p.z * r.w,
+		                  F.p.w * r.w - F.g.x * r.x - F.g.y * r.y - F.g.z * r.z,
+		                  F.g.z * r.y - F.g.y * r.z + F.p.w * r.x + F.g.x * r.w,
+		                  F.g.x * r.z - F.g.z * r.x + F.p.w * r.y + F.g.y * r.w,
+		                  F.g.y * r.x - F.g.x * r.y + F.p.w * r.z + F.g.z * r.w,
+		                  F.g.w * r.w - F.p.x * r.x - F.p.y * r.y - F.p.z * r.z));
+
+	#endif
 }
 
 Vector3D Terathon::Transform(const Vector3D& v, const Flector3D& F)
 {
-	Bivector3D a = (!F.g.xyz ^ v) * 2.0F;
-	return ((a ^ F.g.xyz) - !a * F.p.w - v);
+	#ifndef TERATHON_NO_SIMD
+
+		Vector3D		result;
+
+		vec_float g = VecLoadUnaligned(&F.g.x);
+		vec_float q = VecLoad3D(&v.x);
+
+		vec_float a = VecCross3D(g, q) * VecLoadVectorConstant<0x40000000>();
+		VecStore3D(VecCross3D(a, g) - a * VecLoadSmearScalar(&F.p.w) - q, &result.x);
+		return (result);
+
+	#else
+
+		Bivector3D a = (!F.g.xyz ^ v) * 2.0F;
+		return ((a ^ F.g.xyz) - !a * F.p.w - v);
+
+	#endif
 }
 
 FlatPoint3D Terathon::Transform(const FlatPoint3D& q, const Flector3D& F)
 {
-	Bivector3D a = (!F.g.xyz ^ q.xyz) - !F.p.xyz * q.w;
-	return (FlatPoint3D(((a ^ F.g.xyz) - !a * F.p.w - !F.g.xyz * (F.g.w * q.w)) * 2.0F - q.xyz, q.w));
+	#ifndef TERATHON_NO_SIMD
+
+		FlatPoint3D		result;
+
+		vec_float p = VecLoadUnaligned(&F.p.x);
+		vec_float g = VecLoadUnaligned(&F.g.x);
+		vec_float u = VecLoadUnaligned(&q.x);
+		vec_float qw = VecSmearW(u);
+
+		vec_float a = VecCross3D(g, u) - p * qw;
+		VecStore3D((VecCross3D(a, g) - a * VecSmearW(p) - g * (VecSmearW(g) * qw)) * VecLoadVectorConstant<0x40000000>() - u, &result.x);
+		result.w = q.w;
+		return (result);
+
+	#else
+
+		Bivector3D a = (!F.g.xyz ^ q.xyz) - !F.p.xyz * q.w;
+		return (FlatPoint3D(((a ^ F.g.xyz) - !a * F.p.w - !F.g.xyz * (F.g.w * q.w)) * 2.0F - q.xyz, q.w));
+
+	#endif
 }
 
 Point3D Terathon::Transform(const Point3D& q, const Flector3D& F)
 {
-	Bivector3D a = (!F.g.xyz ^ q.xyz) - !F.p.xyz;
-	return (((a ^ F.g.xyz) - !a * F.p.w - !F.g.xyz * F.g.w) * 2.0F - q);
+	#ifndef TERATHON_NO_SIMD
+
+		Point3D			result;
+
+		vec_float p = VecLoadUnaligned(&F.p.x);
+		vec_float g = VecLoadUnaligned(&F.g.x);
+		vec_float u = VecLoad3D(&q.x);
+
+		vec_float a = VecCross3D(g, u) - p;
+		VecStore3D((VecCross3D(a, g) - a * VecSmearW(p) - g * VecSmearW(g)) * VecLoadVectorConstant<0x40000000>() - u, &result.x);
+		return (result);
+
+	#else
+
+		Bivector3D a = (!F.g.xyz ^ q.xyz) - !F.p.xyz;
+		return (((a ^ F.g.xyz) - !a * F.p.w - !F.g.xyz * F.g.w) * 2.0F - q);
+
+	#endif
 }
 
 Line3D Terathon::Transform(const Line3D& l, const Flector3D& F)
 {
 	Line3D		result;
 
-	Bivector3D Fglv = (!F.g.xyz ^ l.v) * 2.0F;
-	result.v = (F.g.xyz ^ Fglv) + !Fglv * F.p.w + l.v;
+	#ifndef TERATHON_NO_SIMD
+
+		vec_float	rv, rm;
+
+		VecFlectorTransformLine(VecLoadUnaligned(&F.p.x), VecLoadUnaligned(&F.g.x), VecLoad3D(&l.v.x), VecLoad3D(&l.m.x), &rv, &rm);
+		VecStore3D(rv, &result.v.x);
+		VecStore3D(rm, &result.m.x);
+
+	#else
 
-	Vector3D Fplv = (!F.p.xyz ^ !l.v) * 2.0F;
-	Vector3D Fglm = (F.g.xyz ^ l.m) * 2.0F;
-	result.m = !(Fplv - Fglm) * F.p.w + Fglv * F.g.w + (F.p.xyz ^ !Fglv) + (!F.g.xyz ^ (Fplv - Fglm)) - l.m;
+		Bivector3D Fglv = (!F.g.xyz ^ l.v) * 2.0F;
+		result.v = (F.g.xyz ^ Fglv) + !Fglv * F.p.w + l.v;
+
+		Vector3D Fplv = (!F.p.xyz ^ !l.v) * 2.0F;
+		Vector3D Fglm = (F.g.xyz ^ l.m) * 2.0F;
+		result.m = !(Fplv - Fglm) * F.p.w + Fglv * F.g.w + (F.p.xyz ^ !Fglv) + (!F.g.xyz ^ (Fplv - Fglm)) - l.m;
+
+	#endif
 
 	return (result);
 }
 
 Plane3D Terathon::Transform(const Plane3D& h, const Flector3D& F)
 {
-	float hp = h.x * F.p.x + h.y * F.p.y + h.z * F.p.z;
-	float hg = h.x * F.g.x + h.y * F.g.y + h.z * F.g.z;
+	#ifndef TERATHON_NO_SIMD
+
+		Plane3D			result;
+		vec_float		rw;
+
+		VecStore3D(VecFlectorTransformPlane(VecLoadUnaligned(&F.p.x), VecLoadUnaligned(&F.g.x), VecLoadUnaligned(&h.x), &rw), &result.x);
+		VecStoreX(rw, &result.w);
+		return (result);
+
+	#else
+
+		float hp = h.x * F.p.x + h.y * F.p.y + h.z * F.p.z;
+		float hg = h.x * F.g.x + h.y * F.g.y + h.z * F.g.z;
+
+		Vector3D Fgh = (F.g.xyz ^ h.xyz) * 2.0F;
+		return (Plane3D((!F.g.xyz ^ Fgh) + !Fgh * F.p.w + h.xyz, (hg * F.g.w - hp * F.p.w - (h.xyz ^ !F.p.xyz ^ F.g.xyz)) * 2.0F - h.w));
+
+	#endif
+}
+
+void Terathon::TransformPoints(const Flector3D& F, const Point3D *in, Point3D *out, machine count)
+{
+	// The sandwich product is an affine function of the point, so the flector is converted to the
+	// equivalent matrix once, and the batch kernels for Transform3D do the per-point work.
+
+	TransformPoints(F.GetTransformMatrix(), in, out, count);
+}
 
-	Vector3D Fgh = (F.g.xyz ^ h.xyz) * 2.0F;
-	return (Plane3D((!F.g.xyz ^ Fgh) + !Fgh * F.p.w + h.xyz, (hg * F.g.w - hp * F.p.w - (h.xyz ^ !F.p.xyz ^ F.g.xyz)) * 2.0F - h.w));
+void Terathon::TransformPoints(const Flector3D& F, const FlatPoint3D *in, FlatPoint3D *out, machine count)
+{
+	TransformPoints(F.GetTransformMatrix(), in, out, count);
+}
+
+void Terathon::TransformVectors(const Flector3D& F, const Vector3D *in, Vector3D *out, machine count)
+{
+	TransformVectors(F.GetTransformMatrix(), in, out, count);
+}
+
+void Terathon::TransformLines(const Flector3D& F, const Line3D *in, Line3D *out, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->TransformLinesFlector3D(&F, in, out, count);
+			return;
+		}
+
+	#endif
+
+	#ifndef TERATHON_NO_SIMD
+
+		vec_float p = VecLoadUnaligned(&F.p.x);
+		vec_float g = VecLoadUnaligned(&F.g.x);
+
+		for (machine k = 0; k < count; k++)
+		{
+			vec_float	rv, rm;
+
+			VecFlectorTransformLine(p, g, VecLoad3D(&in[k].v.x), VecLoad3D(&in[k].m.x), &rv, &rm);
+			VecStore3D(rv, &out[k].v.x);
+			VecStore3D(rm, &out[k].m.x);
+		}
+
+	#else
+
+		for (machine k = 0; k < count; k++)
+		{
+			out[k] = Transform(in[k], F);
+		}
+
+	#endif
+}
+
+void Terathon::TransformPlanes(const Flector3D& F, const Plane3D *in, Plane3D *out, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->TransformPlanesFlector3D(&F, in, out, count);
+			return;
+		}
+
+	#endif
+
+	#ifndef TERATHON_NO_SIMD
+
+		vec_float p = VecLoadUnaligned(&F.p.x);
+		vec_float g = VecLoadUnaligned(&F.g.x);
+
+		for (machine k = 0; k < count; k++)
+		{
+			vec_float	rw;
+
+			vec_float h = VecFlectorTransformPlane(p, g, VecLoadUnaligned(&in[k].x), &rw);
+			VecStore3D(h, &out[k].x);
+			VecStoreX(rw, &out[k].w);
+		}
+
+	#else
+
+		for (machine k = 0; k < count; k++)
+		{
+			out[k] = Transform(in[k], F);
+		}
+
+	#endif
+}
+
+void Terathon::StoreTransformMatrices(const Flector3D *flector, float *matrix, machine count, uint32 flags)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->StoreTransformMatricesFlector3D(flector, matrix, count, flags);
+			return;
+		}
+
+	#endif
+
+	machine size = (flags & kMatrixStore3x4) ? 12 : 16;
+
+	#ifndef TERATHON_NO_SIMD
+
+		const vec_float one = VecLoadVectorConstant<0x3F800000>();
+		const vec_float two = VecLoadVectorConstant<0x40000000>();
+
+		for (machine k = 0; k < count; k += 4)
+		{
+			vec_float	p[4], g[4];
+			vec_float	entry[3][4];
+
+			machine n = (count - k < 4) ? count - k : 4;
+			const Flector3D *F = flector + k;
+
+			for (machine a = 0; a < 4; a++)
+			{
+				const Flector3D& f = F[(a < n) ? a : n - 1];
+				p[a] = VecLoadUnaligned(&f.p.x);
+				g[a] = VecLoadUnaligned(&f.g.x);
+			}
+
+			VecTranspose4D(p[0], p[1], p[2], p[3], &p[0], &p[1], &p[2], &p[3]);
+			VecTranspose4D(g[0], g[1], g[2], g[3], &g[0], &g[1], &g[2], &g[3]);
+
+			vec_float gx2 = g[0] * g[0];
+			vec_float gy2 = g[1] * g[1];
+			vec_float gz2 = g[2] * g[2];
+
+			vec_float A01 = g[0] * g[1] * -two;
+			vec_float A02 = g[2] * g[0] * -two;
+			vec_float A12 = g[1] * g[2] * -two;
+			vec_float A03 = p[0] * p[3] - g[0] * g[3];
+			vec_float A13 = p[1] * p[3] - g[1] * g[3];
+			vec_float A23 = p[2] * p[3] - g[2] * g[3];
+
+			vec_float B01 = g[2] * p[3] * two;
+			vec_float B20 = g[1] * p[3] * two;
+			vec_float B12 = g[0] * p[3] * two;
+			vec_float B03 = g[1] * p[2] - g[2] * p[1];
+			vec_float B13 = g[2] * p[0] - g[0] * p[2];
+			vec_float B23 = g[0] * p[1] - g[1] * p[0];
+
+			entry[0][0] = (gy2 + gz2) * two - one;
+			entry[0][1] = A01 + B01;
+			entry[0][2] = A02 - B20;
+			entry[0][3] = (A03 + B03) * two;
+			entry[1][0] = A01 - B01;
+			entry[1][1] = (gz2 + gx2) * two - one;
+			entry[1][2] = A12 + B12;
+			entry[1][3] = (A13 + B13) * two;
+			entry[2][0] = A02 + B20;
+			entry[2][1] = A12 - B12;
+			entry[2][2] = (gx2 + gy2) * two - one;
+			entry[2][3] = (A23 + B23) * two;
+
+			StoreTransformMatrices(entry, matrix + k * size, n, flags);
+		}
+
+	#else
+
+		for (machine k = 0; k < count; k++)
+		{
+			Transform3D M = flector[k].GetTransformMatrix();
+			StoreTransformMatrices(&M, matrix + k * size, 1, flags);
+		}
+
+	#endif
 }
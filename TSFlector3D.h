@@ -413,6 +413,52 @@ namespace Terathon
 
 	TERATHON_API Plane3D Transform(const Plane3D& h, const Flector3D& F);
 
+	/// \brief Transforms the $count$ Euclidean points in the array $in$ with the flector $F$ and stores the results in the array $out$.
+	/// The flector is converted to a matrix once, and the points are then transformed in groups by the SIMD batch kernels.
+	/// The $in$ and $out$ arrays may be the same, but they must not otherwise overlap.
+	/// \related Flector3D
+
+	TERATHON_API void TransformPoints(const Flector3D& F, const Point3D *in, Point3D *out, machine count);
+
+	/// \brief Transforms the $count$ flat points in the array $in$ with the flector $F$ and stores the results in the array $out$.
+	/// The $in$ and $out$ arrays may be the same, but they must not otherwise overlap.
+	/// \related Flector3D
+
+	TERATHON_API void TransformPoints(const Flector3D& F, const FlatPoint3D *in, FlatPoint3D *out, machine count);
+
+	/// \brief Transforms the $count$ vectors in the array $in$ with the flector $F$ and stores the results in the array $out$.
+	/// The $in$ and $out$ arrays may be the same, but they must not otherwise overlap.
+	/// \related Flector3D
+
+	TERATHON_API void TransformVectors(const Flector3D& F, const Vector3D *in, Vector3D *out, machine count);
+
+	/// \brief Transforms the $count$ lines in the array $in$ with the flector $F$ and stores the results in the array $out$.
+	/// Each result is identical to the one returned by the Transform() function for a single line unless the library is compiled
+	/// with FMA, in which case the compiler may fuse multiplies and adds differently in the two functions, and each component
+	/// then agrees to within a few roundings of the largest term in its sum.
+	/// The $in$ and $out$ arrays may be the same, but they must not otherwise overlap.
+	/// \related Flector3D
+
+	TERATHON_API void TransformLines(const Flector3D& F, const Line3D *in, Line3D *out, machine count);
+
+	/// \brief Transforms the $count$ planes in the array $in$ with the flector $F$ and stores the results in the array $out$.
+	/// Each result is identical to the one returned by the Transform() function for a single plane unless the library is compiled
+	/// with FMA, in which case the compiler may fuse multiplies and adds differently in the two functions, and each component
+	/// then agrees to within a few roundings of the largest term in its sum.
+	/// The $in$ and $out$ arrays may be the same, but they must not otherwise overlap.
+	/// \related Flector3D
+
+	TERATHON_API void TransformPlanes(const Flector3D& F, const Plane3D *in, Plane3D *out, machine count);
+
+	/// \brief Converts the $count$ flectors in the array $flector$ to transform matrices and stores them in the float buffer $matrix$.
+	/// The layout of the matrices is specified by $flags$, which can be a combination (through logical OR) of the $kMatrixStore$ flags.
+	/// Each matrix is the same as the one returned by the Flector3D::GetTransformMatrix() function unless the library is compiled with FMA,
+	/// in which case the compiler may fuse multiplies and adds differently in the two functions, and each entry then agrees to within
+	/// a few roundings of the largest term in its sum. Four flectors are converted at a time with the SIMD kernels.
+	/// \related Flector3D
+
+	TERATHON_API void StoreTransformMatrices(const Flector3D *flector, float *matrix, machine count, uint32 flags = 0);
+
 	/// \brief Transforms the 3D bivector $v$ with the flector $f$.
 	/// \related Flector3D
 
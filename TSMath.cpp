@@ -8,6 +8,7 @@
 
 
 #include "TSMath.h"
+#include "TSSimdDispatch.h"
 
 
 using namespace Terathon;
@@ -127,6 +128,144 @@ namespace
 	{
 		return (reinterpret_cast<const TrigPair *>(Math::trigTable));
 	}
+
+	// Values of arctan(n / 64) for integers n in the range [0, 64].
+
+	alignas(64) const uint32 arctanTable[65] =
+	{
+		0x00000000, 0x3C7FFAAB, 0x3CFFEAAE, 0x3D3FDC0C, 0x3D7FAADE, 0x3D9FACF8, 0x3DBF70C1, 0x3DDF1CF6,
+		0x3DFEADD5, 0x3E0F0FD8, 0x3E1EB777, 0x3E2E4C09, 0x3E3DCBDA, 0x3E4D3547, 0x3E5C86BB, 0x3E6BBEAF,
+		0x3E7ADBB0, 0x3E84EE2D, 0x3E8C5FAD, 0x3E93C1B9, 0x3E9B13BA, 0x3EA25522, 0x3EA9856D, 0x3EB0A420,
+		0x3EB7B0CA, 0x3EBEAB02, 0x3EC5926A, 0x3ECC66AA, 0x3ED32776, 0x3ED9D489, 0x3EE06DA6, 0x3EE6F29A,
+		0x3EED6338, 0x3EF3BF5C, 0x3EFA06E8, 0x3F001CE4, 0x3F032BF5, 0x3F0630A3, 0x3F092AED, 0x3F0C1AD4,
+		0x3F0F005D, 0x3F11DB8F, 0x3F14AC73, 0x3F177314, 0x3F1A2F81, 0x3F1CE1C9, 0x3F1F89FE, 0x3F222833,
+		0x3F24BC7D, 0x3F2746F3, 0x3F29C7AC, 0x3F2C3EC1, 0x3F2EAC4C, 0x3F311069, 0x3F336B32, 0x3F35BCC5,
+		0x3F38053E, 0x3F3A44BC, 0x3F3C7B5E, 0x3F3EA941, 0x3F40CE86, 0x3F42EB4B, 0x3F44FFB0, 0x3F470BD5, 0x3F490FDB
+	};
+
+	// Values of exp(n) for integers n in the range [-88, 91].
+
+	alignas(64) const uint32 expTable[180] =
+	{
+		0x00000000, 0x00B33687, 0x01739362, 0x022586E0, 0x02E0F96D, 0x0398E2CB, 0x044FCB22, 0x050D35D7,
+		0x05BFECBA, 0x06826D27, 0x07314490, 0x07F0EE94, 0x08A3BAF0, 0x095E884F, 0x0A1739FB, 0x0ACD89C1,
+		0x0B8BAD78, 0x0C3DD771, 0x0D0102BF, 0x0DAF5800, 0x0E6E511E, 0x0F21F3FE, 0x0FDC1DF9, 0x109595C7,
+		0x114B4EA4, 0x120A295C, 0x12BBC7F1, 0x137F388B, 0x142D70C9, 0x14EBBAEC, 0x15A031FC, 0x1659BA5A,
+		0x1713F623, 0x17C919B9, 0x1888A975, 0x1939BE2B, 0x19FC7361, 0x1AAB8EDC, 0x1B692BEB, 0x1C1E74DD,
+		0x1CD75D5D, 0x1D925B02, 0x1E46EAF1, 0x1F072DBA, 0x1FB7BA0F, 0x2079B5EA, 0x2129B229, 0x21E6A405,
+		0x229CBC92, 0x235506F2, 0x2410C457, 0x24C4C239, 0x2585B61D, 0x2635BB8D, 0x26F7000F, 0x27A7DAA4,
+		0x28642328, 0x291B090F, 0x29D2B706, 0x2A8F3216, 0x2B429F81, 0x2C044295, 0x2CB3C295, 0x2D7451BD,
+		0x2E26083C, 0x2EE1A93F, 0x2F995A46, 0x30506D87, 0x310DA433, 0x31C082B8, 0x3282D314, 0x3331CF19,
+		0x33F1AADE, 0x34A43AE5, 0x355F3638, 0x3617B02A, 0x36CE2A62, 0x378C1AA1, 0x383E6BCE, 0x39016791,
+		0x39AFE108, 0x3A6F0B5D, 0x3B227290, 0x3BDCC9FF, 0x3C960AAE, 0x3D4BED86, 0x3E0A9555, 0x3EBC5AB2,
+		0x3F800000, 0x402DF854, 0x40EC7326, 0x41A0AF2E, 0x425A6481, 0x431469C5, 0x43C9B6E3, 0x44891443,
+		0x453A4F54, 0x45FD38AC, 0x46AC14EE, 0x4769E224, 0x481EF0B3, 0x48D805AD, 0x4992CD62, 0x4A478665,
+		0x4B07975F, 0x4BB849A4, 0x4C7A7910, 0x4D2A36C8, 0x4DE75844, 0x4E9D3710, 0x4F55AD6E, 0x5011357A,
+		0x50C55BFE, 0x51861E9D, 0x52364993, 0x52F7C118, 0x53A85DD2, 0x5464D572, 0x551B8238, 0x55D35BB3,
+		0x568FA1FE, 0x5743379A, 0x5804A9F1, 0x58B44F11, 0x597510AD, 0x5A2689FE, 0x5AE2599A, 0x5B99D21F,
+		0x5C51106A, 0x5D0E12E4, 0x5DC1192B, 0x5E833952, 0x5F325A0E, 0x5FF267BB, 0x60A4BB3E, 0x615FE4A9,
+		0x621826B5, 0x62CECB81, 0x638C881F, 0x643F009E, 0x6501CCB3, 0x65B06A7B, 0x666FC62D, 0x6722F184,
+		0x67DD768B, 0x68967FF0, 0x694C8CE5, 0x6A0B01A3, 0x6ABCEDE5, 0x6B806408, 0x6C2E804A, 0x6CED2BEF,
+		0x6DA12CC1, 0x6E5B0F2E, 0x6F14DDC1, 0x6FCA5487, 0x70897F64, 0x713AE0EE, 0x71FDFE91, 0x72AC9B6A,
+		0x736A98EC, 0x741F6CE9, 0x74D8AE7F, 0x7593401C, 0x76482254, 0x77080156, 0x77B8D9AA, 0x787B3CCF,
+		0x792ABBCE, 0x79E80D11, 0x7A9DB1ED, 0x7B56546B, 0x7C11A6F5, 0x7CC5F63B, 0x7D86876D, 0x7E36D809,
+		0x7EF882B7, 0x7F800000
+	};
+
+	#ifndef TERATHON_NO_SIMD
+
+		void VecGatherTrigTable(const vec_float& i, vec_float *cosine, vec_float *sine)
+		{
+			int32	k0, k1, k2, k3;
+
+			vec_int32 k = VecConvertInt32(i);
+			VecInt32StoreX(k, &k0);
+			VecInt32StoreY(k, &k1);
+			VecInt32StoreZ(k, &k2);
+			VecInt32StoreW(k, &k3);
+
+			const TrigPair *table = GetTrigTable();
+			vec_float p01 = VecLoadPairs(&table[k0 & 255].x, &table[k1 & 255].x);
+			vec_float p23 = VecLoadPairs(&table[k2 & 255].x, &table[k3 & 255].x);
+			VecDeinterleave2D(p01, p23, cosine, sine);
+		}
+
+		void VecCosSinAbs(const vec_float& x, vec_float *cosine, vec_float *sine)
+		{
+			// Calculates cos(x) and sin(|x|) in each lane using exactly the same sequence
+			// of operations as the scalar functions so that the results are identical.
+
+			vec_float b = VecMul(VecAndc(x, VecFloatGetMinusZero()), VecLoadVectorConstant<0x4222F983>());
+			vec_float i = VecPositiveFloor(b);
+			b = VecMul(VecSub(b, i), VecLoadVectorConstant<0x3CC90FDB>());
+
+			vec_float	cosine_alpha, sine_alpha;
+
+			VecGatherTrigTable(i, &cosine_alpha, &sine_alpha);
+
+			vec_float b2 = VecMul(b, b);
+			vec_float sine_beta = VecNmsub(VecMul(b, b2), VecNmsub(b2, VecLoadVectorConstant<0x3C088889>(), VecLoadVectorConstant<0x3E2AAAAB>()), b);
+			vec_float cosine_beta = VecNmsub(b2, VecNmsub(b2, VecLoadVectorConstant<0x3D2AAAAB>(), VecLoadVectorConstant<0x3F000000>()), VecLoadVectorConstant<0x3F800000>());
+
+			*sine = VecMadd(sine_alpha, cosine_beta, VecMul(cosine_alpha, sine_beta));
+			*cosine = VecNmsub(sine_alpha, sine_beta, VecMul(cosine_alpha, cosine_beta));
+		}
+
+		inline vec_float VecGetNegativeSign(const vec_float& x)
+		{
+			return (VecAnd(VecMaskCmplt(x, VecFloatGetZero()), VecFloatGetMinusZero()));
+		}
+
+		void ExvCosSinAbs(const exv_float& x, exv_float *cosine, exv_float *sine)
+		{
+			exv_float b = ExvMul(ExvAndc(x, ExvFloatGetMinusZero()), ExvLoadVectorConstant<0x4222F983>());
+			exv_float i = ExvPositiveFloor(b);
+			b = ExvMul(ExvSub(b, i), ExvLoadVectorConstant<0x3CC90FDB>());
+
+			vec_float	cosine_lo, sine_lo, cosine_hi, sine_hi;
+
+			VecGatherTrigTable(ExvGetVecLo(i), &cosine_lo, &sine_lo);
+			VecGatherTrigTable(ExvGetVecHi(i), &cosine_hi, &sine_hi);
+			exv_float cosine_alpha = ExvFloat(cosine_lo, cosine_hi);
+			exv_float sine_alpha = ExvFloat(sine_lo, sine_hi);
+
+			exv_float b2 = ExvMul(b, b);
+			exv_float sine_beta = ExvNmsub(ExvMul(b, b2), ExvNmsub(b2, ExvLoadVectorConstant<0x3C088889>(), ExvLoadVectorConstant<0x3E2AAAAB>()), b);
+			exv_float cosine_beta = ExvNmsub(b2, ExvNmsub(b2, ExvLoadVectorConstant<0x3D2AAAAB>(), ExvLoadVectorConstant<0x3F000000>()), ExvLoadVectorConstant<0x3F800000>());
+
+			*sine = ExvMadd(sine_alpha, cosine_beta, ExvMul(cosine_alpha, sine_beta));
+			*cosine = ExvNmsub(sine_alpha, sine_beta, ExvMul(cosine_alpha, cosine_beta));
+		}
+
+		inline exv_float ExvGetNegativeSign(const exv_float& x)
+		{
+			return (ExvAnd(ExvMaskCmplt(x, ExvFloatGetZero()), ExvFloatGetMinusZero()));
+		}
+
+		vec_float VecGatherTable(const float *table, const vec_float& i)
+		{
+			alignas(16) float	value[4];
+			int32				k[4];
+
+			vec_int32 n = VecConvertInt32(i);
+			VecInt32StoreX(n, &k[0]);
+			VecInt32StoreY(n, &k[1]);
+			VecInt32StoreZ(n, &k[2]);
+			VecInt32StoreW(n, &k[3]);
+
+			value[0] = table[k[0]];
+			value[1] = table[k[1]];
+			value[2] = table[k[2]];
+			value[3] = table[k[3]];
+			return (VecLoad(value));
+		}
+
+		inline exv_float ExvGatherTable(const float *table, const exv_float& i)
+		{
+			return (ExvFloat(VecGatherTable(table, ExvGetVecLo(i)), VecGatherTable(table, ExvGetVecHi(i))));
+		}
+
+	#endif
 }
 
 
@@ -183,6 +322,7 @@ float Terathon::Sqrt(float x)
 		float r = asfloat(i);
 		r = (0.5F * r) * (3.0F - x * r * r);
 		r = (0.5F * r) * (3.0F - x * r * r);
+		r = (0.5F * r) * (3.0F - x * r * r);
 		return (r * x);
 
 	#endif
@@ -214,6 +354,7 @@ float Terathon::InverseSqrt(float x)
 		float r = asfloat(i);
 		r = (0.5F * r) * (3.0F - x * r * r);
 		r = (0.5F * r) * (3.0F - x * r * r);
+		r = (0.5F * r) * (3.0F - x * r * r);
 		return (r);
 
 	#endif
@@ -234,7 +375,7 @@ float Terathon::Sin(float x)
 		vec_float sine_alpha = VecLoadScalar(&cossin.y);
 
 		vec_float b2 = VecMulScalar(b, b);
-		vec_float sine_beta = VecNmsubScalar(VecMulScalar(b, b2), VecNmsubScalar(b2, VecLoadScalarConstant<0x3E2AAAAB>(), VecLoadScalarConstant<0x3C088889>()), b);
+		vec_float sine_beta = VecNmsubScalar(VecMulScalar(b, b2), VecNmsubScalar(b2, VecLoadScalarConstant<0x3C088889>(), VecLoadScalarConstant<0x3E2AAAAB>()), b);
 		vec_float cosine_beta = VecNmsubScalar(b2, VecNmsub(b2, VecLoadScalarConstant<0x3D2AAAAB>(), VecLoadScalarConstant<0x3F000000>()), VecLoadScalarConstant<0x3F800000>());
 
 		vec_float sine = VecMaddScalar(sine_alpha, cosine_beta, VecMulScalar(cosine_alpha, sine_beta));
@@ -275,10 +416,10 @@ float Terathon::Cos(float x)
 		vec_float sine_alpha = VecLoadScalar(&cossin.y);
 
 		vec_float b2 = VecMulScalar(b, b);
-		vec_float sine_beta = VecNmsubScalar(VecMulScalar(b, b2), VecNmsubScalar(b2, VecLoadScalarConstant<0x3E2AAAAB>(), VecLoadScalarConstant<0x3C088889>()), b);
+		vec_float sine_beta = VecNmsubScalar(VecMulScalar(b, b2), VecNmsubScalar(b2, VecLoadScalarConstant<0x3C088889>(), VecLoadScalarConstant<0x3E2AAAAB>()), b);
 		vec_float cosine_beta = VecNmsubScalar(b2, VecNmsub(b2, VecLoadScalarConstant<0x3D2AAAAB>(), VecLoadScalarConstant<0x3F000000>()), VecLoadScalarConstant<0x3F800000>());
 
-		VecStoreX(VecSubScalar(VecMulScalar(cosine_alpha, cosine_beta), VecMulScalar(sine_alpha, sine_beta)), &result);
+		VecStoreX(VecNmsubScalar(sine_alpha, sine_beta, VecMulScalar(cosine_alpha, cosine_beta)), &result);
 		return (result);
 
 	#else
@@ -313,11 +454,11 @@ float Terathon::Tan(float x)
 		vec_float sine_alpha = VecLoadScalar(&cossin.y);
 
 		vec_float b2 = VecMulScalar(b, b);
-		vec_float sine_beta = VecNmsubScalar(VecMulScalar(b, b2), VecNmsubScalar(b2, VecLoadScalarConstant<0x3E2AAAAB>(), VecLoadScalarConstant<0x3C088889>()), b);
+		vec_float sine_beta = VecNmsubScalar(VecMulScalar(b, b2), VecNmsubScalar(b2, VecLoadScalarConstant<0x3C088889>(), VecLoadScalarConstant<0x3E2AAAAB>()), b);
 		vec_float cosine_beta = VecNmsubScalar(b2, VecNmsub(b2, VecLoadScalarConstant<0x3D2AAAAB>(), VecLoadScalarConstant<0x3F000000>()), VecLoadScalarConstant<0x3F800000>());
 
 		VecStoreX(VecMaddScalar(sine_alpha, cosine_beta, VecMulScalar(cosine_alpha, sine_beta)), &sine);
-		VecStoreX(VecSubScalar(VecMulScalar(cosine_alpha, cosine_beta), VecMulScalar(sine_alpha, sine_beta)), &cosine);
+		VecStoreX(VecNmsubScalar(sine_alpha, sine_beta, VecMulScalar(cosine_alpha, cosine_beta)), &cosine);
 
 		float result = sine / cosine;
 		return ((x < 0.0F) ? -result : result);
@@ -356,11 +497,11 @@ void Terathon::CosSin(float x, float *c, float *s)
 		vec_float sine_alpha = VecLoadScalar(&cossin.y);
 
 		vec_float b2 = VecMulScalar(b, b);
-		vec_float sine_beta = VecNmsubScalar(VecMulScalar(b, b2), VecNmsubScalar(b2, VecLoadScalarConstant<0x3E2AAAAB>(), VecLoadScalarConstant<0x3C088889>()), b);
+		vec_float sine_beta = VecNmsubScalar(VecMulScalar(b, b2), VecNmsubScalar(b2, VecLoadScalarConstant<0x3C088889>(), VecLoadScalarConstant<0x3E2AAAAB>()), b);
 		vec_float cosine_beta = VecNmsubScalar(b2, VecNmsub(b2, VecLoadScalarConstant<0x3D2AAAAB>(), VecLoadScalarConstant<0x3F000000>()), VecLoadScalarConstant<0x3F800000>());
 
 		vec_float sine = VecMaddScalar(sine_alpha, cosine_beta, VecMulScalar(cosine_alpha, sine_beta));
-		vec_float cosine = VecSubScalar(VecMulScalar(cosine_alpha, cosine_beta), VecMulScalar(sine_alpha, sine_beta));
+		vec_float cosine = VecNmsubScalar(sine_alpha, sine_beta, VecMulScalar(cosine_alpha, cosine_beta));
 
 		VecStoreX(cosine, c);
 		VecStoreX((x < 0.0F) ? -sine : sine, s);
@@ -384,6 +525,254 @@ void Terathon::CosSin(float x, float *c, float *s)
 	#endif
 }
 
+void Terathon::Sin(const float *x, float *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->SinArray(x, result, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		for (; i + 8 <= count; i += 8)
+		{
+			exv_float	cosine, sine;
+
+			exv_float v = ExvLoadUnaligned(x + i);
+			ExvCosSinAbs(v, &cosine, &sine);
+			ExvStoreUnaligned(ExvXor(sine, ExvGetNegativeSign(v)), result + i);
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	cosine, sine;
+
+			vec_float v = VecLoadUnaligned(x + i);
+			VecCosSinAbs(v, &cosine, &sine);
+			VecStoreUnaligned(VecXor(sine, VecGetNegativeSign(v)), result + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		result[i] = Sin(x[i]);
+	}
+}
+
+void Terathon::Cos(const float *x, float *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->CosArray(x, result, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		for (; i + 8 <= count; i += 8)
+		{
+			exv_float	cosine, sine;
+
+			ExvCosSinAbs(ExvLoadUnaligned(x + i), &cosine, &sine);
+			ExvStoreUnaligned(cosine, result + i);
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	cosine, sine;
+
+			VecCosSinAbs(VecLoadUnaligned(x + i), &cosine, &sine);
+			VecStoreUnaligned(cosine, result + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		result[i] = Cos(x[i]);
+	}
+}
+
+void Terathon::Tan(const float *x, float *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->TanArray(x, result, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		for (; i + 8 <= count; i += 8)
+		{
+			exv_float	cosine, sine;
+
+			exv_float v = ExvLoadUnaligned(x + i);
+			ExvCosSinAbs(v, &cosine, &sine);
+			ExvStoreUnaligned(ExvXor(ExvDiv(sine, cosine), ExvGetNegativeSign(v)), result + i);
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	cosine, sine;
+
+			vec_float v = VecLoadUnaligned(x + i);
+			VecCosSinAbs(v, &cosine, &sine);
+			VecStoreUnaligned(VecXor(VecDiv(sine, cosine), VecGetNegativeSign(v)), result + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		result[i] = Tan(x[i]);
+	}
+}
+
+void Terathon::CosSin(const float *x, float *c, float *s, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->CosSinArray(x, c, s, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		for (; i + 8 <= count; i += 8)
+		{
+			exv_float	cosine, sine;
+
+			exv_float v = ExvLoadUnaligned(x + i);
+			ExvCosSinAbs(v, &cosine, &sine);
+			ExvStoreUnaligned(cosine, c + i);
+			ExvStoreUnaligned(ExvXor(sine, ExvGetNegativeSign(v)), s + i);
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	cosine, sine;
+
+			vec_float v = VecLoadUnaligned(x + i);
+			VecCosSinAbs(v, &cosine, &sine);
+			VecStoreUnaligned(cosine, c + i);
+			VecStoreUnaligned(VecXor(sine, VecGetNegativeSign(v)), s + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		CosSin(x[i], &c[i], &s[i]);
+	}
+}
+
+#ifndef TERATHON_NO_SIMD
+
+	vec_float Terathon::VecSin(const vec_float& x)
+	{
+		vec_float	cosine, sine;
+
+		VecCosSinAbs(x, &cosine, &sine);
+		return (VecXor(sine, VecGetNegativeSign(x)));
+	}
+
+	vec_float Terathon::VecCos(const vec_float& x)
+	{
+		vec_float	cosine, sine;
+
+		VecCosSinAbs(x, &cosine, &sine);
+		return (cosine);
+	}
+
+	vec_float Terathon::VecTan(const vec_float& x)
+	{
+		vec_float	cosine, sine;
+
+		VecCosSinAbs(x, &cosine, &sine);
+		return (VecXor(VecDiv(sine, cosine), VecGetNegativeSign(x)));
+	}
+
+	void Terathon::VecCosSin(const vec_float& x, vec_float *c, vec_float *s)
+	{
+		vec_float	sine;
+
+		VecCosSinAbs(x, c, &sine);
+		*s = VecXor(sine, VecGetNegativeSign(x));
+	}
+
+	exv_float Terathon::ExvSin(const exv_float& x)
+	{
+		exv_float	cosine, sine;
+
+		ExvCosSinAbs(x, &cosine, &sine);
+		return (ExvXor(sine, ExvGetNegativeSign(x)));
+	}
+
+	exv_float Terathon::ExvCos(const exv_float& x)
+	{
+		exv_float	cosine, sine;
+
+		ExvCosSinAbs(x, &cosine, &sine);
+		return (cosine);
+	}
+
+	exv_float Terathon::ExvTan(const exv_float& x)
+	{
+		exv_float	cosine, sine;
+
+		ExvCosSinAbs(x, &cosine, &sine);
+		return (ExvXor(ExvDiv(sine, cosine), ExvGetNegativeSign(x)));
+	}
+
+	void Terathon::ExvCosSin(const exv_float& x, exv_float *c, exv_float *s)
+	{
+		exv_float	sine;
+
+		ExvCosSinAbs(x, c, &sine);
+		*s = ExvXor(sine, ExvGetNegativeSign(x));
+	}
+
+#endif
+
 float Terathon::Arcsin(float y)
 {
 	return (Arctan(y * InverseSqrt(1.0F - y * y)));
@@ -397,20 +786,6 @@ float Terathon::Arccos(float x)
 
 float Terathon::Arctan(float x)
 {
-	// Values of arctan(n / 64) for integers n in the range [0, 64].
-
-	alignas(64) static const uint32 table[65] =
-	{
-		0x00000000, 0x3C7FFAAB, 0x3CFFEAAE, 0x3D3FDC0C, 0x3D7FAADE, 0x3D9FACF8, 0x3DBF70C1, 0x3DDF1CF6,
-		0x3DFEADD5, 0x3E0F0FD8, 0x3E1EB777, 0x3E2E4C09, 0x3E3DCBDA, 0x3E4D3547, 0x3E5C86BB, 0x3E6BBEAF,
-		0x3E7ADBB0, 0x3E84EE2D, 0x3E8C5FAD, 0x3E93C1B9, 0x3E9B13BA, 0x3EA25522, 0x3EA9856D, 0x3EB0A420,
-		0x3EB7B0CA, 0x3EBEAB02, 0x3EC5926A, 0x3ECC66AA, 0x3ED32776, 0x3ED9D489, 0x3EE06DA6, 0x3EE6F29A,
-		0x3EED6338, 0x3EF3BF5C, 0x3EFA06E8, 0x3F001CE4, 0x3F032BF5, 0x3F0630A3, 0x3F092AED, 0x3F0C1AD4,
-		0x3F0F005D, 0x3F11DB8F, 0x3F14AC73, 0x3F177314, 0x3F1A2F81, 0x3F1CE1C9, 0x3F1F89FE, 0x3F222833,
-		0x3F24BC7D, 0x3F2746F3, 0x3F29C7AC, 0x3F2C3EC1, 0x3F2EAC4C, 0x3F311069, 0x3F336B32, 0x3F35BCC5,
-		0x3F38053E, 0x3F3A44BC, 0x3F3C7B5E, 0x3F3EA941, 0x3F40CE86, 0x3F42EB4B, 0x3F44FFB0, 0x3F470BD5, 0x3F490FDB
-	};
-
 	// arctan(a) = arctan(b) + arctan((a - b) / (ab + 1))
 
 	float a = Fabs(x);
@@ -420,7 +795,7 @@ float Terathon::Arctan(float x)
 		float i = PositiveFloor(b);
 		b = i * 0.015625F;
 
-		float arctan_b = reinterpret_cast<const float *>(table)[int32(i)];
+		float arctan_b = reinterpret_cast<const float *>(arctanTable)[int32(i)];
 		float c = (a - b) / (a * b + 1.0F);
 		float c2 = c * c;
 
@@ -436,7 +811,7 @@ float Terathon::Arctan(float x)
 		float i = PositiveFloor(b);
 		b = i * 0.015625F;
 
-		float arctan_b = reinterpret_cast<const float *>(table)[int32(i)];
+		float arctan_b = reinterpret_cast<const float *>(arctanTable)[int32(i)];
 		float c = (a - b) / (a * b + 1.0F);
 		float c2 = c * c;
 
@@ -478,35 +853,6 @@ float Terathon::Arctan(float y, float x)
 
 float Terathon::Exp(float x)
 {
-	// Values of exp(n) for integers n in the range [-88, 91].
-
-	alignas(64) static const uint32 table[180] =
-	{
-		0x00000000, 0x00B33687, 0x01739362, 0x022586E0, 0x02E0F96D, 0x0398E2CB, 0x044FCB22, 0x050D35D7,
-		0x05BFECBA, 0x06826D27, 0x07314490, 0x07F0EE94, 0x08A3BAF0, 0x095E884F, 0x0A1739FB, 0x0ACD89C1,
-		0x0B8BAD78, 0x0C3DD771, 0x0D0102BF, 0x0DAF5800, 0x0E6E511E, 0x0F21F3FE, 0x0FDC1DF9, 0x109595C7,
-		0x114B4EA4, 0x120A295C, 0x12BBC7F1, 0x137F388B, 0x142D70C9, 0x14EBBAEC, 0x15A031FC, 0x1659BA5A,
-		0x1713F623, 0x17C919B9, 0x1888A975, 0x1939BE2B, 0x19FC7361, 0x1AAB8EDC, 0x1B692BEB, 0x1C1E74DD,
-		0x1CD75D5D, 0x1D925B02, 0x1E46EAF1, 0x1F072DBA, 0x1FB7BA0F, 0x2079B5EA, 0x2129B229, 0x21E6A405,
-		0x229CBC92, 0x235506F2, 0x2410C457, 0x24C4C239, 0x2585B61D, 0x2635BB8D, 0x26F7000F, 0x27A7DAA4,
-		0x28642328, 0x291B090F, 0x29D2B706, 0x2A8F3216, 0x2B429F81, 0x2C044295, 0x2CB3C295, 0x2D7451BD,
-		0x2E26083C, 0x2EE1A93F, 0x2F995A46, 0x30506D87, 0x310DA433, 0x31C082B8, 0x3282D314, 0x3331CF19,
-		0x33F1AADE, 0x34A43AE5, 0x355F3638, 0x3617B02A, 0x36CE2A62, 0x378C1AA1, 0x383E6BCE, 0x39016791,
-		0x39AFE108, 0x3A6F0B5D, 0x3B227290, 0x3BDCC9FF, 0x3C960AAE, 0x3D4BED86, 0x3E0A9555, 0x3EBC5AB2,
-		0x3F800000, 0x402DF854, 0x40EC7326, 0x41A0AF2E, 0x425A6481, 0x431469C5, 0x43C9B6E3, 0x44891443,
-		0x453A4F54, 0x45FD38AC, 0x46AC14EE, 0x4769E224, 0x481EF0B3, 0x48D805AD, 0x4992CD62, 0x4A478665,
-		0x4B07975F, 0x4BB849A4, 0x4C7A7910, 0x4D2A36C8, 0x4DE75844, 0x4E9D3710, 0x4F55AD6E, 0x5011357A,
-		0x50C55BFE, 0x51861E9D, 0x52364993, 0x52F7C118, 0x53A85DD2, 0x5464D572, 0x551B8238, 0x55D35BB3,
-		0x568FA1FE, 0x5743379A, 0x5804A9F1, 0x58B44F11, 0x597510AD, 0x5A2689FE, 0x5AE2599A, 0x5B99D21F,
-		0x5C51106A, 0x5D0E12E4, 0x5DC1192B, 0x5E833952, 0x5F325A0E, 0x5FF267BB, 0x60A4BB3E, 0x615FE4A9,
-		0x621826B5, 0x62CECB81, 0x638C881F, 0x643F009E, 0x6501CCB3, 0x65B06A7B, 0x666FC62D, 0x6722F184,
-		0x67DD768B, 0x68967FF0, 0x694C8CE5, 0x6A0B01A3, 0x6ABCEDE5, 0x6B806408, 0x6C2E804A, 0x6CED2BEF,
-		0x6DA12CC1, 0x6E5B0F2E, 0x6F14DDC1, 0x6FCA5487, 0x70897F64, 0x713AE0EE, 0x71FDFE91, 0x72AC9B6A,
-		0x736A98EC, 0x741F6CE9, 0x74D8AE7F, 0x7593401C, 0x76482254, 0x77080156, 0x77B8D9AA, 0x787B3CCF,
-		0x792ABBCE, 0x79E80D11, 0x7A9DB1ED, 0x7B56546B, 0x7C11A6F5, 0x7CC5F63B, 0x7D86876D, 0x7E36D809,
-		0x7EF882B7, 0x7F800000
-	};
-
 	float f = Floor(x);
 	int32 i = int32(f) + 88;
 	if (i > 0)
@@ -522,7 +868,7 @@ float Terathon::Exp(float x)
 		r = r * x + 1.0F / 6.0F;
 		r = r * x + 0.5F;
 
-		return ((r * (x * x) + (x + 1.0F)) * reinterpret_cast<const float *>(table)[(i < 179) ? i : 179]);
+		return ((r * (x * x) + (x + 1.0F)) * reinterpret_cast<const float *>(expTable)[(i < 179) ? i : 179]);
 	}
 
 	return (0.0F);
@@ -557,3 +903,421 @@ float Terathon::Log(float x)
 	static const uint32 nan = 0x7FFFFFFF;
 	return (asfloat(nan));
 }
+
+void Terathon::Arcsin(const float *x, float *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->ArcsinArray(x, result, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		for (; i + 8 <= count; i += 8)
+		{
+			ExvStoreUnaligned(ExvArcsin(ExvLoadUnaligned(x + i)), result + i);
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		for (; i + 4 <= count; i += 4)
+		{
+			VecStoreUnaligned(VecArcsin(VecLoadUnaligned(x + i)), result + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		result[i] = Arcsin(x[i]);
+	}
+}
+
+void Terathon::Arccos(const float *x, float *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->ArccosArray(x, result, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		for (; i + 8 <= count; i += 8)
+		{
+			ExvStoreUnaligned(ExvArccos(ExvLoadUnaligned(x + i)), result + i);
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		for (; i + 4 <= count; i += 4)
+		{
+			VecStoreUnaligned(VecArccos(VecLoadUnaligned(x + i)), result + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		result[i] = Arccos(x[i]);
+	}
+}
+
+void Terathon::Arctan(const float *x, float *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->ArctanArray(x, result, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		for (; i + 8 <= count; i += 8)
+		{
+			ExvStoreUnaligned(ExvArctan(ExvLoadUnaligned(x + i)), result + i);
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		for (; i + 4 <= count; i += 4)
+		{
+			VecStoreUnaligned(VecArctan(VecLoadUnaligned(x + i)), result + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		result[i] = Arctan(x[i]);
+	}
+}
+
+void Terathon::Arctan(const float *y, const float *x, float *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->Arctan2Array(y, x, result, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		for (; i + 8 <= count; i += 8)
+		{
+			ExvStoreUnaligned(ExvArctan(ExvLoadUnaligned(y + i), ExvLoadUnaligned(x + i)), result + i);
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		for (; i + 4 <= count; i += 4)
+		{
+			VecStoreUnaligned(VecArctan(VecLoadUnaligned(y + i), VecLoadUnaligned(x + i)), result + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		result[i] = Arctan(y[i], x[i]);
+	}
+}
+
+void Terathon::Exp(const float *x, float *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->ExpArray(x, result, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		for (; i + 8 <= count; i += 8)
+		{
+			ExvStoreUnaligned(ExvExp(ExvLoadUnaligned(x + i)), result + i);
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		for (; i + 4 <= count; i += 4)
+		{
+			VecStoreUnaligned(VecExp(VecLoadUnaligned(x + i)), result + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		result[i] = Exp(x[i]);
+	}
+}
+
+void Terathon::Log(const float *x, float *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->LogArray(x, result, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		for (; i + 8 <= count; i += 8)
+		{
+			ExvStoreUnaligned(ExvLog(ExvLoadUnaligned(x + i)), result + i);
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		for (; i + 4 <= count; i += 4)
+		{
+			VecStoreUnaligned(VecLog(VecLoadUnaligned(x + i)), result + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		result[i] = Log(x[i]);
+	}
+}
+
+#ifndef TERATHON_NO_SIMD
+
+	vec_float Terathon::VecArcsin(const vec_float& y)
+	{
+		vec_float one = VecLoadVectorConstant<0x3F800000>();
+		return (VecArctan(VecDiv(y, VecSqrt(VecNmsub(y, y, one)))));
+	}
+
+	vec_float Terathon::VecArccos(const vec_float& x)
+	{
+		vec_float one = VecLoadVectorConstant<0x3F800000>();
+		vec_float r = VecArctan(VecDiv(VecSqrt(VecNmsub(x, x, one)), x));
+		return (VecAdd(r, VecAnd(VecMaskCmplt(x, VecFloatGetZero()), VecLoadVectorConstant<0x40490FDB>())));
+	}
+
+	vec_float Terathon::VecArctan(const vec_float& x)
+	{
+		// This follows the same steps as the scalar Arctan() function, using
+		// the reciprocal of |x| in the lanes where |x| is greater than one.
+
+		vec_float one = VecLoadVectorConstant<0x3F800000>();
+		vec_float a = VecAndc(x, VecFloatGetMinusZero());
+		vec_float large = VecMaskCmpgt(a, one);
+		a = VecSelect(a, VecDiv(one, a), large);
+
+		vec_float i = VecMin(VecPositiveFloor(VecMul(a, VecLoadVectorConstant<0x42800000>())), VecLoadVectorConstant<0x42800000>());
+		vec_float b = VecMul(i, VecLoadVectorConstant<0x3C800000>());
+
+		vec_float arctan_b = VecGatherTable(reinterpret_cast<const float *>(arctanTable), i);
+		vec_float c = VecDiv(VecSub(a, b), VecMadd(a, b, one));
+		vec_float c2 = VecMul(c, c);
+
+		vec_float arctan_c = VecMul(c, VecNmsub(c2, VecMadd(c2, VecNmsub(c2, VecLoadVectorConstant<0x3E124925>(), VecLoadVectorConstant<0x3E4CCCCD>()), VecLoadVectorConstant<0x3EAAAAAB>()), one));
+		a = VecAdd(arctan_b, arctan_c);
+		a = VecSelect(a, VecSub(VecLoadVectorConstant<0x3FC90FDB>(), a), large);
+
+		return (VecXor(a, VecGetNegativeSign(x)));
+	}
+
+	vec_float Terathon::VecArctan(const vec_float& y, const vec_float& x)
+	{
+		vec_float minus_zero = VecFloatGetMinusZero();
+		vec_float min_float = VecLoadVectorConstant<0x00800000>();
+		vec_float pi = VecLoadVectorConstant<0x40490FDB>();
+
+		vec_float sign = VecAnd(y, minus_zero);
+		vec_float negative = VecMaskCmplt(x, VecFloatGetZero());
+
+		vec_float r = VecAdd(VecArctan(VecDiv(y, x)), VecAnd(negative, VecOr(pi, sign)));
+		r = VecSelect(VecOr(VecLoadVectorConstant<0x3FC90FDB>(), sign), r, VecMaskCmpgt(VecAndc(x, minus_zero), min_float));
+		return (VecSelect(VecAnd(negative, pi), r, VecMaskCmpgt(VecAndc(y, minus_zero), min_float)));
+	}
+
+	vec_float Terathon::VecExp(const vec_float& x)
+	{
+		vec_float zero = VecFloatGetZero();
+		vec_float f = VecFloor(x);
+		vec_float i = VecAdd(f, VecLoadVectorConstant<0x42B00000>());
+		vec_float exp_f = VecGatherTable(reinterpret_cast<const float *>(expTable), VecMin(VecMax(i, zero), VecLoadVectorConstant<0x43330000>()));
+
+		vec_float y = VecSub(x, f);
+		vec_float r = VecMadd(VecLoadVectorConstant<0x3638EF1D>(), y, VecLoadVectorConstant<0x37D00D01>());
+		r = VecMadd(r, y, VecLoadVectorConstant<0x39500D01>());
+		r = VecMadd(r, y, VecLoadVectorConstant<0x3AB60B61>());
+		r = VecMadd(r, y, VecLoadVectorConstant<0x3C088889>());
+		r = VecMadd(r, y, VecLoadVectorConstant<0x3D2AAAAB>());
+		r = VecMadd(r, y, VecLoadVectorConstant<0x3E2AAAAB>());
+		r = VecMadd(r, y, VecLoadVectorConstant<0x3F000000>());
+		r = VecMadd(r, VecMul(y, y), VecAdd(y, VecLoadVectorConstant<0x3F800000>()));
+
+		return (VecAnd(VecMul(r, exp_f), VecMaskCmpgt(i, zero)));
+	}
+
+	vec_float Terathon::VecLog(const vec_float& x)
+	{
+		// The exponent field is converted to float without shifting it down
+		// because (e + 127) * 2^23 is exactly representable.
+
+		vec_float zero = VecFloatGetZero();
+		vec_float one = VecLoadVectorConstant<0x3F800000>();
+		vec_float e = VecSub(VecMul(VecInt32ConvertFloat(VecFloatAsInt32(VecAnd(x, VecLoadVectorConstant<0x7F800000>()))), VecLoadVectorConstant<0x34000000>()), VecLoadVectorConstant<0x42FE0000>());
+		vec_float f = VecOr(VecAnd(x, VecLoadVectorConstant<0x007FFFFF>()), one);
+
+		vec_float y = VecDiv(VecSub(f, one), VecAdd(f, one));
+		vec_float z = VecMul(y, y);
+
+		vec_float r = VecMadd(VecLoadVectorConstant<0x3D9D89D9>(), z, VecLoadVectorConstant<0x3DBA2E8C>());
+		r = VecMadd(r, z, VecLoadVectorConstant<0x3DE38E39>());
+		r = VecMadd(r, z, VecLoadVectorConstant<0x3E124925>());
+		r = VecMadd(r, z, VecLoadVectorConstant<0x3E4CCCCD>());
+		r = VecMadd(r, z, VecLoadVectorConstant<0x3EAAAAAB>());
+		r = VecMadd(r, z, one);
+
+		r = VecMadd(r, VecAdd(y, y), VecMul(e, VecLoadVectorConstant<0x3F317218>()));
+		r = VecSelect(VecLoadVectorConstant<0x7FFFFFFF>(), r, VecMaskCmpgt(x, zero));
+		return (VecSelect(r, VecLoadVectorConstant<0xFF800000>(), VecMaskCmpeq(x, zero)));
+	}
+
+	exv_float Terathon::ExvArcsin(const exv_float& y)
+	{
+		exv_float one = ExvLoadVectorConstant<0x3F800000>();
+		return (ExvArctan(ExvDiv(y, ExvSqrt(ExvNmsub(y, y, one)))));
+	}
+
+	exv_float Terathon::ExvArccos(const exv_float& x)
+	{
+		exv_float one = ExvLoadVectorConstant<0x3F800000>();
+		exv_float r = ExvArctan(ExvDiv(ExvSqrt(ExvNmsub(x, x, one)), x));
+		return (ExvAdd(r, ExvAnd(ExvMaskCmplt(x, ExvFloatGetZero()), ExvLoadVectorConstant<0x40490FDB>())));
+	}
+
+	exv_float Terathon::ExvArctan(const exv_float& x)
+	{
+		// This follows the same steps as the scalar Arctan() function, using
+		// the reciprocal of |x| in the lanes where |x| is greater than one.
+
+		exv_float one = ExvLoadVectorConstant<0x3F800000>();
+		exv_float a = ExvAndc(x, ExvFloatGetMinusZero());
+		exv_float large = ExvMaskCmpgt(a, one);
+		a = ExvSelect(a, ExvDiv(one, a), large);
+
+		exv_float i = ExvMin(ExvPositiveFloor(ExvMul(a, ExvLoadVectorConstant<0x42800000>())), ExvLoadVectorConstant<0x42800000>());
+		exv_float b = ExvMul(i, ExvLoadVectorConstant<0x3C800000>());
+
+		exv_float arctan_b = ExvGatherTable(reinterpret_cast<const float *>(arctanTable), i);
+		exv_float c = ExvDiv(ExvSub(a, b), ExvMadd(a, b, one));
+		exv_float c2 = ExvMul(c, c);
+
+		exv_float arctan_c = ExvMul(c, ExvNmsub(c2, ExvMadd(c2, ExvNmsub(c2, ExvLoadVectorConstant<0x3E124925>(), ExvLoadVectorConstant<0x3E4CCCCD>()), ExvLoadVectorConstant<0x3EAAAAAB>()), one));
+		a = ExvAdd(arctan_b, arctan_c);
+		a = ExvSelect(a, ExvSub(ExvLoadVectorConstant<0x3FC90FDB>(), a), large);
+
+		return (ExvXor(a, ExvGetNegativeSign(x)));
+	}
+
+	exv_float Terathon::ExvArctan(const exv_float& y, const exv_float& x)
+	{
+		exv_float minus_zero = ExvFloatGetMinusZero();
+		exv_float min_float = ExvLoadVectorConstant<0x00800000>();
+		exv_float pi = ExvLoadVectorConstant<0x40490FDB>();
+
+		exv_float sign = ExvAnd(y, minus_zero);
+		exv_float negative = ExvMaskCmplt(x, ExvFloatGetZero());
+
+		exv_float r = ExvAdd(ExvArctan(ExvDiv(y, x)), ExvAnd(negative, ExvOr(pi, sign)));
+		r = ExvSelect(ExvOr(ExvLoadVectorConstant<0x3FC90FDB>(), sign), r, ExvMaskCmpgt(ExvAndc(x, minus_zero), min_float));
+		return (ExvSelect(ExvAnd(negative, pi), r, ExvMaskCmpgt(ExvAndc(y, minus_zero), min_float)));
+	}
+
+	exv_float Terathon::ExvExp(const exv_float& x)
+	{
+		exv_float zero = ExvFloatGetZero();
+		exv_float f = ExvFloor(x);
+		exv_float i = ExvAdd(f, ExvLoadVectorConstant<0x42B00000>());
+		exv_float exp_f = ExvGatherTable(reinterpret_cast<const float *>(expTable), ExvMin(ExvMax(i, zero), ExvLoadVectorConstant<0x43330000>()));
+
+		exv_float y = ExvSub(x, f);
+		exv_float r = ExvMadd(ExvLoadVectorConstant<0x3638EF1D>(), y, ExvLoadVectorConstant<0x37D00D01>());
+		r = ExvMadd(r, y, ExvLoadVectorConstant<0x39500D01>());
+		r = ExvMadd(r, y, ExvLoadVectorConstant<0x3AB60B61>());
+		r = ExvMadd(r, y, ExvLoadVectorConstant<0x3C088889>());
+		r = ExvMadd(r, y, ExvLoadVectorConstant<0x3D2AAAAB>());
+		r = ExvMadd(r, y, ExvLoadVectorConstant<0x3E2AAAAB>());
+		r = ExvMadd(r, y, ExvLoadVectorConstant<0x3F000000>());
+		r = ExvMadd(r, ExvMul(y, y), ExvAdd(y, ExvLoadVectorConstant<0x3F800000>()));
+
+		return (ExvAnd(ExvMul(r, exp_f), ExvMaskCmpgt(i, zero)));
+	}
+
+	exv_float Terathon::ExvLog(const exv_float& x)
+	{
+		// The exponent field is converted to float without shifting it down
+		// because (e + 127) * 2^23 is exactly representable.
+
+		exv_float zero = ExvFloatGetZero();
+		exv_float one = ExvLoadVectorConstant<0x3F800000>();
+		exv_float e = ExvSub(ExvMul(ExvInt32ConvertFloat(ExvFloatAsInt32(ExvAnd(x, ExvLoadVectorConstant<0x7F800000>()))), ExvLoadVectorConstant<0x34000000>()), ExvLoadVectorConstant<0x42FE0000>());
+		exv_float f = ExvOr(ExvAnd(x, ExvLoadVectorConstant<0x007FFFFF>()), one);
+
+		exv_float y = ExvDiv(ExvSub(f, one), ExvAdd(f, one));
+		exv_float z = ExvMul(y, y);
+
+		exv_float r = ExvMadd(ExvLoadVectorConstant<0x3D9D89D9>(), z, ExvLoadVectorConstant<0x3DBA2E8C>());
+		r = ExvMadd(r, z, ExvLoadVectorConstant<0x3DE38E39>());
+		r = ExvMadd(r, z, ExvLoadVectorConstant<0x3E124925>());
+		r = ExvMadd(r, z, ExvLoadVectorConstant<0x3E4CCCCD>());
+		r = ExvMadd(r, z, ExvLoadVectorConstant<0x3EAAAAAB>());
+		r = ExvMadd(r, z, one);
+
+		r = ExvMadd(r, ExvAdd(y, y), ExvMul(e, ExvLoadVectorConstant<0x3F317218>()));
+		r = ExvSelect(ExvLoadVectorConstant<0x7FFFFFFF>(), r, ExvMaskCmpgt(x, zero));
+		return (ExvSelect(r, ExvLoadVectorConstant<0xFF800000>(), ExvMaskCmpeq(x, zero)));
+	}
+
+#endif
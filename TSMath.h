@@ -289,6 +289,8 @@ namespace Terathon
 
 	#ifndef TERATHON_NO_SIMD
 
+		/// \brief Returns the largest integer not greater than $x$. The result is exact for all finite inputs.
+
 		inline float Floor(const float& x)
 		{
 			float	result;
@@ -297,6 +299,8 @@ namespace Terathon
 			return (result);
 		}
 
+		/// \brief Returns the smallest integer not less than $x$. The result is exact for all finite inputs.
+
 		inline float Ceil(const float& x)
 		{
 			float	result;
@@ -307,7 +311,12 @@ namespace Terathon
 
 	#else
 
+		/// \brief Returns the largest integer not greater than $x$. The result is exact for all finite inputs.
+
 		TERATHON_API float Floor(const float& x);
+
+		/// \brief Returns the smallest integer not less than $x$. The result is exact for all finite inputs.
+
 		TERATHON_API float Ceil(const float& x);
 
 	#endif
@@ -446,22 +455,148 @@ namespace Terathon
 	}
 
 
+	/// \brief Returns the square root of $x$.
+	///
+	/// The square root is calculated as the product of $x$ and its inverse square root, which is a hardware estimate refined
+	/// with one Newton step when SSE is available and a bit-manipulated estimate refined with three Newton steps otherwise.
+	/// Over the full range of normal floats, the maximum relative error is below 4e-7 (about 6.5 ulp) with SSE and below
+	/// 2e-7 (about 3 ulp) without.
+
 	TERATHON_API float Sqrt(float x);
+
+	/// \brief Returns the inverse square root of $x$, with the same error bounds as the Sqrt() function.
+
 	TERATHON_API float InverseSqrt(float x);
 
+	/// \brief Returns the sine of $x$.
+	///
+	/// The maximum absolute error is 4.8e-7 over [&minus;2&pi;,&#x202F;2&pi;]. The error grows with the magnitude of $x$
+	/// because the range reduction is performed in single precision, and it reaches 7.1e-6 over [&minus;100,&#x202F;100].
+
 	TERATHON_API float Sin(float x);
+
+	/// \brief Returns the cosine of $x$, with the same error bounds as the Sin() function.
+
 	TERATHON_API float Cos(float x);
+
+	/// \brief Returns the tangent of $x$. The maximum error is 21 ulp over [&minus;1.5,&#x202F;1.5].
+
 	TERATHON_API float Tan(float x);
+
+	/// \brief Calculates the cosine and sine of $x$ and stores them in $c$ and $s$, with the same error bounds as the Sin() function.
+
 	TERATHON_API void CosSin(float x, float *c, float *s);
 
+	/// \brief Calculates the sines of the $count$ values in the array $x$ and stores them in the array $result$.
+	/// The results are identical to those of the scalar Sin() function.
+
+	TERATHON_API void Sin(const float *x, float *result, machine count);
+
+	/// \brief Calculates the cosines of the $count$ values in the array $x$ and stores them in the array $result$.
+	/// The results are identical to those of the scalar Cos() function.
+
+	TERATHON_API void Cos(const float *x, float *result, machine count);
+
+	/// \brief Calculates the tangents of the $count$ values in the array $x$ and stores them in the array $result$.
+	/// The results are identical to those of the scalar Tan() function.
+
+	TERATHON_API void Tan(const float *x, float *result, machine count);
+
+	/// \brief Calculates the cosines and sines of the $count$ values in the array $x$ and stores them in the arrays $c$ and $s$.
+	/// The results are identical to those of the scalar CosSin() function.
+
+	TERATHON_API void CosSin(const float *x, float *c, float *s, machine count);
+
+	#ifndef TERATHON_NO_SIMD
+
+		TERATHON_API vec_float VecSin(const vec_float& x);
+		TERATHON_API vec_float VecCos(const vec_float& x);
+		TERATHON_API vec_float VecTan(const vec_float& x);
+		TERATHON_API void VecCosSin(const vec_float& x, vec_float *c, vec_float *s);
+
+		TERATHON_API exv_float ExvSin(const exv_float& x);
+		TERATHON_API exv_float ExvCos(const exv_float& x);
+		TERATHON_API exv_float ExvTan(const exv_float& x);
+		TERATHON_API void ExvCosSin(const exv_float& x, exv_float *c, exv_float *s);
+
+	#endif
+
+	/// \brief Returns the arcsine of $y$. The maximum absolute error is 1e-6 over [&minus;1,&#x202F;1].
+
 	TERATHON_API float Arcsin(float y);
+
+	/// \brief Returns the arccosine of $x$. The maximum absolute error is 1e-6 over [&minus;1,&#x202F;1].
+
 	TERATHON_API float Arccos(float x);
+
+	/// \brief Returns the arctangent of $x$. The maximum error is 2 ulp.
+
 	TERATHON_API float Arctan(float x);
+
+	/// \brief Returns the angle of the vector (<i>x</i>,&#x202F;<i>y</i>) in the range [&minus;&pi;,&#x202F;&pi;].
+	/// The maximum absolute error is 3e-7.
+
 	TERATHON_API float Arctan(float y, float x);
 
+	/// \brief Returns <i>e</i> raised to the power $x$. The maximum error is 3.7 ulp over [&minus;87,&#x202F;88].
+
 	TERATHON_API float Exp(float x);
+
+	/// \brief Returns the natural logarithm of $x$.
+	///
+	/// The maximum absolute error is 1.5e-7 over [0.5,&#x202F;2], where the result is close to zero, and the maximum error
+	/// is 2.3 ulp outside this range.
+
 	TERATHON_API float Log(float x);
 
+	/// \brief Calculates the arcsines of the $count$ values in the array $y$ and stores them in the array $result$.
+	/// The same steps are followed as in the scalar Arcsin() function, and the error bound is the same.
+
+	TERATHON_API void Arcsin(const float *y, float *result, machine count);
+
+	/// \brief Calculates the arccosines of the $count$ values in the array $x$ and stores them in the array $result$.
+	/// The same steps are followed as in the scalar Arccos() function, and the error bound is the same.
+
+	TERATHON_API void Arccos(const float *x, float *result, machine count);
+
+	/// \brief Calculates the arctangents of the $count$ values in the array $x$ and stores them in the array $result$.
+	/// The same steps are followed as in the scalar Arctan() function, and the error bound is the same.
+
+	TERATHON_API void Arctan(const float *x, float *result, machine count);
+
+	/// \brief Calculates the angles of the $count$ vectors whose coordinates are stored in the arrays $x$ and $y$ and stores
+	/// them in the array $result$. The same steps are followed as in the scalar Arctan(y, x) function, and the error bound is the same.
+
+	TERATHON_API void Arctan(const float *y, const float *x, float *result, machine count);
+
+	/// \brief Calculates <i>e</i> raised to each of the $count$ powers in the array $x$ and stores the results in the array $result$.
+	/// The same steps are followed as in the scalar Exp() function, and the error bound is the same.
+
+	TERATHON_API void Exp(const float *x, float *result, machine count);
+
+	/// \brief Calculates the natural logarithms of the $count$ values in the array $x$ and stores them in the array $result$.
+	/// The same steps are followed as in the scalar Log() function, and the error bounds are the same.
+
+	TERATHON_API void Log(const float *x, float *result, machine count);
+
+	#ifndef TERATHON_NO_SIMD
+
+		TERATHON_API vec_float VecArcsin(const vec_float& y);
+		TERATHON_API vec_float VecArccos(const vec_float& x);
+		TERATHON_API vec_float VecArctan(const vec_float& x);
+		TERATHON_API vec_float VecArctan(const vec_float& y, const vec_float& x);
+		TERATHON_API vec_float VecExp(const vec_float& x);
+		TERATHON_API vec_float VecLog(const vec_float& x);
+
+		TERATHON_API exv_float ExvArcsin(const exv_float& y);
+		TERATHON_API exv_float ExvArccos(const exv_float& x);
+		TERATHON_API exv_float ExvArctan(const exv_float& x);
+		TERATHON_API exv_float ExvArctan(const exv_float& y, const exv_float& x);
+		TERATHON_API exv_float ExvExp(const exv_float& x);
+		TERATHON_API exv_float ExvLog(const exv_float& x);
+
+	#endif
+
 	inline float Pow(float base, float exponent)
 	{
 		return (Exp(Log(base) * exponent));
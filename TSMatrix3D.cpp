@@ -8,11 +8,114 @@
 
 
 #include "TSMatrix3D.h"
+#include "TSSimdDispatch.h"
 
 
 using namespace Terathon;
 
 
+namespace
+{
+	// The batch inverse holds the nine entries of four or eight matrices in separate registers, in the same
+	// column-major order as the storage of Matrix3D, so the entries of one matrix are spread across a single lane.
+
+	template <typename type>
+	inline type AdjugateMatrix3DBatch(const type *e, type *r)
+	{
+		// The rows of the adjugate are the cross products of the columns (e0, e1, e2), (e3, e4, e5), and (e6, e7, e8),
+		// and the determinant is the dot product of the last row with the last column.
+
+		r[0] = e[4] * e[8] - e[5] * e[7];
+		r[3] = e[5] * e[6] - e[3] * e[8];
+		r[6] = e[3] * e[7] - e[4] * e[6];
+		r[1] = e[7] * e[2] - e[8] * e[1];
+		r[4] = e[8] * e[0] - e[6] * e[2];
+		r[7] = e[6] * e[1] - e[7] * e[0];
+		r[2] = e[1] * e[5] - e[2] * e[4];
+		r[5] = e[2] * e[3] - e[0] * e[5];
+		r[8] = e[0] * e[4] - e[1] * e[3];
+
+		return (r[2] * e[6] + r[5] * e[7] + r[8] * e[8]);
+	}
+
+	#if defined(TERATHON_AVX)
+
+		inline void LoadMatrixBatch(const Matrix3D *m, exv_float *e)
+		{
+			alignas(32) float	last[8];
+
+			ExvTranspose4D(ExvFloat(VecLoadUnaligned(&m[0](0,0)), VecLoadUnaligned(&m[4](0,0))), ExvFloat(VecLoadUnaligned(&m[1](0,0)), VecLoadUnaligned(&m[5](0,0))),
+			               ExvFloat(VecLoadUnaligned(&m[2](0,0)), VecLoadUnaligned(&m[6](0,0))), ExvFloat(VecLoadUnaligned(&m[3](0,0)), VecLoadUnaligned(&m[7](0,0))), &e[0], &e[1], &e[2], &e[3]);
+			ExvTranspose4D(ExvFloat(VecLoadUnaligned(&m[0](1,1)), VecLoadUnaligned(&m[4](1,1))), ExvFloat(VecLoadUnaligned(&m[1](1,1)), VecLoadUnaligned(&m[5](1,1))),
+			               ExvFloat(VecLoadUnaligned(&m[2](1,1)), VecLoadUnaligned(&m[6](1,1))), ExvFloat(VecLoadUnaligned(&m[3](1,1)), VecLoadUnaligned(&m[7](1,1))), &e[4], &e[5], &e[6], &e[7]);
+
+			for (machine k = 0; k < 8; k++)
+			{
+				last[k] = m[k](2,2);
+			}
+
+			e[8] = ExvLoad(last);
+		}
+
+		inline void StoreMatrixBatch(const exv_float *e, Matrix3D *m)
+		{
+			exv_float			a[4], b[4];
+			alignas(32) float	last[8];
+
+			ExvTranspose4D(e[0], e[1], e[2], e[3], &a[0], &a[1], &a[2], &a[3]);
+			ExvTranspose4D(e[4], e[5], e[6], e[7], &b[0], &b[1], &b[2], &b[3]);
+			ExvStore(e[8], last);
+
+			for (machine k = 0; k < 4; k++)
+			{
+				VecStoreUnaligned(ExvGetVecLo(a[k]), &m[k](0,0));
+				VecStoreUnaligned(ExvGetVecLo(b[k]), &m[k](1,1));
+				m[k](2,2) = last[k];
+
+				VecStoreUnaligned(ExvGetVecHi(a[k]), &m[k + 4](0,0));
+				VecStoreUnaligned(ExvGetVecHi(b[k]), &m[k + 4](1,1));
+				m[k + 4](2,2) = last[k + 4];
+			}
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		inline void LoadMatrixBatch(const Matrix3D *m, vec_float *e)
+		{
+			alignas(16) float	last[4];
+
+			VecTranspose4D(VecLoadUnaligned(&m[0](0,0)), VecLoadUnaligned(&m[1](0,0)), VecLoadUnaligned(&m[2](0,0)), VecLoadUnaligned(&m[3](0,0)), &e[0], &e[1], &e[2], &e[3]);
+			VecTranspose4D(VecLoadUnaligned(&m[0](1,1)), VecLoadUnaligned(&m[1](1,1)), VecLoadUnaligned(&m[2](1,1)), VecLoadUnaligned(&m[3](1,1)), &e[4], &e[5], &e[6], &e[7]);
+
+			for (machine k = 0; k < 4; k++)
+			{
+				last[k] = m[k](2,2);
+			}
+
+			e[8] = VecLoad(last);
+		}
+
+		inline void StoreMatrixBatch(const vec_float *e, Matrix3D *m)
+		{
+			vec_float			a[4], b[4];
+			alignas(16) float	last[4];
+
+			VecTranspose4D(e[0], e[1], e[2], e[3], &a[0], &a[1], &a[2], &a[3]);
+			VecTranspose4D(e[4], e[5], e[6], e[7], &b[0], &b[1], &b[2], &b[3]);
+			VecStore(e[8], last);
+
+			for (machine k = 0; k < 4; k++)
+			{
+				VecStoreUnaligned(a[k], &m[k](0,0));
+				VecStoreUnaligned(b[k], &m[k](1,1));
+				m[k](2,2) = last[k];
+			}
+		}
+
+	#endif
+}
+
+
 alignas(64) const ConstMatrix3D Matrix3D::identity = {{{1.0F, 0.0F, 0.0F}, {0.0F, 1.0F, 0.0F}, {0.0F, 0.0F, 1.0F}}};
 alignas(64) const ConstTransform2D Transform2D::identity = {{{1.0F, 0.0F, 0.0F}, {0.0F, 1.0F, 0.0F}, {0.0F, 0.0F, 1.0F}}};
 
@@ -282,37 +385,161 @@ Matrix3D Terathon::operator /(const Matrix3D& m, float s)
 
 float Terathon::Determinant(const Matrix3D& m)
 {
-	return (m(0,0) * (m(1,1) * m(2,2) - m(1,2) * m(2,1)) - m(0,1) * (m(1,0) * m(2,2) - m(1,2) * m(2,0)) + m(0,2) * (m(1,0) * m(2,1) - m(1,1) * m(2,0)));
+	#ifndef TERATHON_NO_SIMD
+
+		float	result;
+
+		// The columns of a Matrix3D are not padded, so they are loaded without reading past the last entry.
+
+		vec_float a = VecLoad3D(&m(0,0));
+		vec_float b = VecLoad3D(&m(0,1));
+		vec_float c = VecLoad3D(&m(0,2));
+
+		VecStoreX(VecDot3D(VecCross3D(a, b), c), &result);
+		return (result);
+
+	#else
+
+		return (m(0,0) * (m(1,1) * m(2,2) - m(1,2) * m(2,1)) - m(0,1) * (m(1,0) * m(2,2) - m(1,2) * m(2,0)) + m(0,2) * (m(1,0) * m(2,1) - m(1,1) * m(2,0)));
+
+	#endif
 }
 
 Matrix3D Terathon::Inverse(const Matrix3D& m)
 {
-	const Vector3D& a = m[0];
-	const Vector3D& b = m[1];
-	const Vector3D& c = m[2];
+	#ifndef TERATHON_NO_SIMD
+
+		Matrix3D	result;
+		vec_float	x, y, z, w;
+
+		vec_float a = VecLoad3D(&m(0,0));
+		vec_float b = VecLoad3D(&m(0,1));
+		vec_float c = VecLoad3D(&m(0,2));
+
+		vec_float g0 = VecCross3D(b, c);
+		vec_float g1 = VecCross3D(c, a);
+		vec_float g2 = VecCross3D(a, b);
+
+		vec_float invDet = VecSmearX(VecDivScalar(VecLoadScalarConstant<0x3F800000>(), VecDot3D(g2, c)));
 
-	Bivector3D g0 = b ^ c;
-	Bivector3D g1 = c ^ a;
-	Bivector3D g2 = a ^ b;
+		// The cross products are the rows of the inverse, so they are transposed into columns for storage.
 
-	float invDet = 1.0F / (g2 ^ c);
+		VecTranspose4D(g0 * invDet, g1 * invDet, g2 * invDet, VecFloatGetZero(), &x, &y, &z, &w);
+		VecStore3D(x, &result(0,0));
+		VecStore3D(y, &result(0,1));
+		VecStore3D(z, &result(0,2));
+		return (result);
 
-	return (Matrix3D(g0.x * invDet, g0.y * invDet, g0.z * invDet,
-	                 g1.x * invDet, g1.y * invDet, g1.z * invDet,
-	                 g2.x * invDet, g2.y * invDet, g2.z * invDet));
+	#else
+
+		const Vector3D& a = m[0];
+		const Vector3D& b = m[1];
+		const Vector3D& c = m[2];
+
+		Bivector3D g0 = b ^ c;
+		Bivector3D g1 = c ^ a;
+		Bivector3D g2 = a ^ b;
+
+		float invDet = 1.0F / (g2 ^ c);
+
+		return (Matrix3D(g0.x * invDet, g0.y * invDet, g0.z * invDet,
+		                 g1.x * invDet, g1.y * invDet, g1.z * invDet,
+		                 g2.x * invDet, g2.y * invDet, g2.z * invDet));
+
+	#endif
 }
 
 Matrix3D Terathon::Adjugate(const Matrix3D& m)
 {
-	const Vector3D& a = m[0];
-	const Vector3D& b = m[1];
-	const Vector3D& c = m[2];
+	#ifndef TERATHON_NO_SIMD
+
+		Matrix3D	result;
+		vec_float	x, y, z, w;
+
+		vec_float a = VecLoad3D(&m(0,0));
+		vec_float b = VecLoad3D(&m(0,1));
+		vec_float c = VecLoad3D(&m(0,2));
+
+		VecTranspose4D(VecCross3D(b, c), VecCross3D(c, a), VecCross3D(a, b), VecFloatGetZero(), &x, &y, &z, &w);
+		VecStore3D(x, &result(0,0));
+		VecStore3D(y, &result(0,1));
+		VecStore3D(z, &result(0,2));
+		return (result);
+
+	#else
+
+		const Vector3D& a = m[0];
+		const Vector3D& b = m[1];
+		const Vector3D& c = m[2];
+
+		Bivector3D g0 = b ^ c;
+		Bivector3D g1 = c ^ a;
+		Bivector3D g2 = a ^ b;
+
+		return (Matrix3D(g0.x, g0.y, g0.z, g1.x, g1.y, g1.z, g2.x, g2.y, g2.z));
+
+	#endif
+}
+
+void Terathon::Inverse(const Matrix3D *m, Matrix3D *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->InverseMatrix3DArray(m, result, count);
+			return;
+		}
+
+	#endif
 
-	Bivector3D g0 = b ^ c;
-	Bivector3D g1 = c ^ a;
-	Bivector3D g2 = a ^ b;
+	machine i = 0;
 
-	return (Matrix3D(g0.x, g0.y, g0.z, g1.x, g1.y, g1.z, g2.x, g2.y, g2.z));
+	#if defined(TERATHON_AVX)
+
+		const exv_float one = ExvLoadVectorConstant<0x3F800000>();
+
+		for (; i + 8 <= count; i += 8)
+		{
+			exv_float	e[9], r[9];
+
+			LoadMatrixBatch(m + i, e);
+			exv_float invDet = one / AdjugateMatrix3DBatch(e, r);
+
+			for (machine k = 0; k < 9; k++)
+			{
+				r[k] = r[k] * invDet;
+			}
+
+			StoreMatrixBatch(r, result + i);
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		const vec_float one = VecLoadVectorConstant<0x3F800000>();
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	e[9], r[9];
+
+			LoadMatrixBatch(m + i, e);
+			vec_float invDet = one / AdjugateMatrix3DBatch(e, r);
+
+			for (machine k = 0; k < 9; k++)
+			{
+				r[k] = r[k] * invDet;
+			}
+
+			StoreMatrixBatch(r, result + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		result[i] = Inverse(m[i]);
+	}
 }
 
 
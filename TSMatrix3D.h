@@ -256,6 +256,13 @@ namespace Terathon
 
 	TERATHON_API Matrix3D Adjugate(const Matrix3D& m);
 
+	/// \brief Calculates the inverses of the $count$ matrices in the array $m$ and stores them in the array $result$.
+	/// Four or eight matrices are inverted at a time with the SIMD kernels. The $m$ and $result$ arrays may be the same,
+	/// but they must not otherwise overlap. If any matrix is singular, then its inverse is undefined.
+	/// \related Matrix3D
+
+	TERATHON_API void Inverse(const Matrix3D *m, Matrix3D *result, machine count);
+
 
 	// ==============================================
 	//	Transform2D
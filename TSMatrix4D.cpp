@@ -8,11 +8,578 @@
 
 
 #include "TSMatrix4D.h"
+#include "TSSimdDispatch.h"
 
 
 using namespace Terathon;
 
 
+namespace
+{
+	template <bool point>
+	inline void TransformScalar(const Transform3D& m, float x, float y, float z, float *rx, float *ry, float *rz)
+	{
+		// The terms are added in the same order as in the batch kernels so that a result does not depend
+		// on the position of the point in the array or on the vector width of the kernels.
+
+		float a = m(0,0) * x;
+		float b = m(1,0) * x;
+		float c = m(2,0) * x;
+
+		if (point)
+		{
+			a += m(0,3);
+			b += m(1,3);
+			c += m(2,3);
+		}
+
+		*rx = a + m(0,1) * y + m(0,2) * z;
+		*ry = b + m(1,1) * y + m(1,2) * z;
+		*rz = c + m(2,1) * y + m(2,2) * z;
+	}
+
+	#ifndef TERATHON_NO_SIMD
+
+		// The batch kernels keep the twelve matrix entries smeared across all lanes and
+		// transform one point per lane with the x, y, and z coordinates in separate registers.
+
+		#if defined(TERATHON_AVX)
+
+			void LoadTransformBatch(const Transform3D& m, exv_float *c)
+			{
+				for (machine k = 0; k < 12; k++) c[k] = ExvLoadSmearScalar(&m(k >> 2, k & 3));
+			}
+
+			template <bool point>
+			inline void TransformBatch(const exv_float *c, exv_float& x, exv_float& y, exv_float& z)
+			{
+				exv_float rx = (point) ? ExvMadd(c[0], x, c[3]) : ExvMul(c[0], x);
+				exv_float ry = (point) ? ExvMadd(c[4], x, c[7]) : ExvMul(c[4], x);
+				exv_float rz = (point) ? ExvMadd(c[8], x, c[11]) : ExvMul(c[8], x);
+
+				x = ExvMadd(c[2], z, ExvMadd(c[1], y, rx));
+				rz = ExvMadd(c[10], z, ExvMadd(c[9], y, rz));
+				y = ExvMadd(c[6], z, ExvMadd(c[5], y, ry));
+				z = rz;
+			}
+
+			inline void TransformBatch4D(const exv_float *c, exv_float& x, exv_float& y, exv_float& z, const exv_float& w)
+			{
+				exv_float rx = ExvMadd(c[3], w, ExvMadd(c[2], z, ExvMadd(c[1], y, ExvMul(c[0], x))));
+				exv_float ry = ExvMadd(c[7], w, ExvMadd(c[6], z, ExvMadd(c[5], y, ExvMul(c[4], x))));
+				z = ExvMadd(c[11], w, ExvMadd(c[10], z, ExvMadd(c[9], y, ExvMul(c[8], x))));
+				x = rx;
+				y = ry;
+			}
+
+		#else
+
+			void LoadTransformBatch(const Transform3D& m, vec_float *c)
+			{
+				for (machine k = 0; k < 12; k++) c[k] = VecLoadSmearScalar(&m(k >> 2, k & 3));
+			}
+
+			template <bool point>
+			inline void TransformBatch(const vec_float *c, vec_float& x, vec_float& y, vec_float& z)
+			{
+				vec_float rx = (point) ? VecMadd(c[0], x, c[3]) : VecMul(c[0], x);
+				vec_float ry = (point) ? VecMadd(c[4], x, c[7]) : VecMul(c[4], x);
+				vec_float rz = (point) ? VecMadd(c[8], x, c[11]) : VecMul(c[8], x);
+
+				x = VecMadd(c[2], z, VecMadd(c[1], y, rx));
+				rz = VecMadd(c[10], z, VecMadd(c[9], y, rz));
+				y = VecMadd(c[6], z, VecMadd(c[5], y, ry));
+				z = rz;
+			}
+
+			inline void TransformBatch4D(const vec_float *c, vec_float& x, vec_float& y, vec_float& z, const vec_float& w)
+			{
+				vec_float rx = VecMadd(c[3], w, VecMadd(c[2], z, VecMadd(c[1], y, VecMul(c[0], x))));
+				vec_float ry = VecMadd(c[7], w, VecMadd(c[6], z, VecMadd(c[5], y, VecMul(c[4], x))));
+				z = VecMadd(c[11], w, VecMadd(c[10], z, VecMadd(c[9], y, VecMul(c[8], x))));
+				x = rx;
+				y = ry;
+			}
+
+		#endif
+
+		#if defined(TERATHON_AVX512)
+
+			void LoadTransformBatch(const Transform3D& m, hexv_float *c)
+			{
+				for (machine k = 0; k < 12; k++) c[k] = HexvLoadSmearScalar(&m(k >> 2, k & 3));
+			}
+
+			template <bool point>
+			inline void TransformBatch(const hexv_float *c, hexv_float& x, hexv_float& y, hexv_float& z)
+			{
+				hexv_float rx = (point) ? HexvMadd(c[0], x, c[3]) : HexvMul(c[0], x);
+				hexv_float ry = (point) ? HexvMadd(c[4], x, c[7]) : HexvMul(c[4], x);
+				hexv_float rz = (point) ? HexvMadd(c[8], x, c[11]) : HexvMul(c[8], x);
+
+				x = HexvMadd(c[2], z, HexvMadd(c[1], y, rx));
+				rz = HexvMadd(c[10], z, HexvMadd(c[9], y, rz));
+				y = HexvMadd(c[6], z, HexvMadd(c[5], y, ry));
+				z = rz;
+			}
+
+			inline void TransformBatch4D(const hexv_float *c, hexv_float& x, hexv_float& y, hexv_float& z, const hexv_float& w)
+			{
+				hexv_float rx = HexvMadd(c[3], w, HexvMadd(c[2], z, HexvMadd(c[1], y, HexvMul(c[0], x))));
+				hexv_float ry = HexvMadd(c[7], w, HexvMadd(c[6], z, HexvMadd(c[5], y, HexvMul(c[4], x))));
+				z = HexvMadd(c[11], w, HexvMadd(c[10], z, HexvMadd(c[9], y, HexvMul(c[8], x))));
+				x = rx;
+				y = ry;
+			}
+
+		#endif
+
+	#endif
+
+	template <bool point>
+	void TransformArray3D(const Transform3D& m, const float *in, float *out, machine count)
+	{
+		machine i = 0;
+
+		#if defined(TERATHON_AVX512)
+
+			hexv_float	c[12];
+
+			LoadTransformBatch(m, c);
+			for (; i + 16 <= count; i += 16)
+			{
+				hexv_float	x, y, z;
+
+				HexvLoadDeinterleave3D(in, &x, &y, &z);
+				TransformBatch<point>(c, x, y, z);
+				HexvStoreInterleave3D(x, y, z, out);
+
+				in += 48;
+				out += 48;
+			}
+
+		#elif defined(TERATHON_AVX)
+
+			exv_float	c[12];
+
+			LoadTransformBatch(m, c);
+			for (; i + 8 <= count; i += 8)
+			{
+				exv_float	x, y, z;
+
+				ExvLoadDeinterleave3D(in, &x, &y, &z);
+				TransformBatch<point>(c, x, y, z);
+				ExvStoreInterleave3D(x, y, z, out);
+
+				in += 24;
+				out += 24;
+			}
+
+		#elif !defined(TERATHON_NO_SIMD)
+
+			vec_float	c[12];
+
+			LoadTransformBatch(m, c);
+			for (; i + 4 <= count; i += 4)
+			{
+				vec_float	x, y, z;
+
+				VecLoadDeinterleave3D(in, &x, &y, &z);
+				TransformBatch<point>(c, x, y, z);
+				VecStoreInterleave3D(x, y, z, out);
+
+				in += 12;
+				out += 12;
+			}
+
+		#endif
+
+		for (; i < count; i++)
+		{
+			TransformScalar<point>(m, in[0], in[1], in[2], &out[0], &out[1], &out[2]);
+			in += 3;
+			out += 3;
+		}
+	}
+
+	template <bool point>
+	void TransformArray3D(const Transform3D& m, const char *in, machine inStride, char *out, machine outStride, machine count)
+	{
+		machine i = 0;
+
+		#if defined(TERATHON_AVX)
+
+			exv_float			c[12];
+			alignas(32) float	buffer[3][8];
+
+			LoadTransformBatch(m, c);
+			for (; i + 8 <= count; i += 8)
+			{
+				for (machine k = 0; k < 8; k++)
+				{
+					const float *p = reinterpret_cast<const float *>(in + k * inStride);
+					buffer[0][k] = p[0];
+					buffer[1][k] = p[1];
+					buffer[2][k] = p[2];
+				}
+
+				exv_float x = ExvLoad(buffer[0]);
+				exv_float y = ExvLoad(buffer[1]);
+				exv_float z = ExvLoad(buffer[2]);
+				TransformBatch<point>(c, x, y, z);
+				ExvStore(x, buffer[0]);
+				ExvStore(y, buffer[1]);
+				ExvStore(z, buffer[2]);
+
+				for (machine k = 0; k < 8; k++)
+				{
+					float *p = reinterpret_cast<float *>(out + k * outStride);
+					p[0] = buffer[0][k];
+					p[1] = buffer[1][k];
+					p[2] = buffer[2][k];
+				}
+
+				in += inStride * 8;
+				out += outStride * 8;
+			}
+
+		#elif !defined(TERATHON_NO_SIMD)
+
+			vec_float			c[12];
+			alignas(16) float	buffer[3][4];
+
+			LoadTransformBatch(m, c);
+			for (; i + 4 <= count; i += 4)
+			{
+				for (machine k = 0; k < 4; k++)
+				{
+					const float *p = reinterpret_cast<const float *>(in + k * inStride);
+					buffer[0][k] = p[0];
+					buffer[1][k] = p[1];
+					buffer[2][k] = p[2];
+				}
+
+				vec_float x = VecLoad(buffer[0]);
+				vec_float y = VecLoad(buffer[1]);
+				vec_float z = VecLoad(buffer[2]);
+				TransformBatch<point>(c, x, y, z);
+				VecStore(x, buffer[0]);
+				VecStore(y, buffer[1]);
+				VecStore(z, buffer[2]);
+
+				for (machine k = 0; k < 4; k++)
+				{
+					float *p = reinterpret_cast<float *>(out + k * outStride);
+					p[0] = buffer[0][k];
+					p[1] = buffer[1][k];
+					p[2] = buffer[2][k];
+				}
+
+				in += inStride * 4;
+				out += outStride * 4;
+			}
+
+		#endif
+
+		for (; i < count; i++)
+		{
+			const float *p = reinterpret_cast<const float *>(in);
+			float *q = reinterpret_cast<float *>(out);
+			TransformScalar<point>(m, p[0], p[1], p[2], &q[0], &q[1], &q[2]);
+
+			in += inStride;
+			out += outStride;
+		}
+	}
+
+	void TransformArray4D(const Transform3D& m, const float *in, float *out, machine count)
+	{
+		machine i = 0;
+
+		// Each 128-bit lane holds one homogeneous point, so transposing the 4x4 blocks in every lane
+		// gathers the x, y, z, and w coordinates of the points into separate registers. The points end up
+		// in a permuted order across lanes, but the same transpose puts them back where they came from.
+
+		#if defined(TERATHON_AVX512)
+
+			hexv_float	c[12];
+
+			LoadTransformBatch(m, c);
+			for (; i + 16 <= count; i += 16)
+			{
+				hexv_float	x, y, z, w;
+
+				HexvTranspose4D(HexvLoadUnaligned(in), HexvLoadUnaligned(in + 16), HexvLoadUnaligned(in + 32), HexvLoadUnaligned(in + 48), &x, &y, &z, &w);
+				TransformBatch4D(c, x, y, z, w);
+				HexvTranspose4D(x, y, z, w, &x, &y, &z, &w);
+				HexvStoreUnaligned(x, out);
+				HexvStoreUnaligned(y, out + 16);
+				HexvStoreUnaligned(z, out + 32);
+				HexvStoreUnaligned(w, out + 48);
+
+				in += 64;
+				out += 64;
+			}
+
+		#elif defined(TERATHON_AVX)
+
+			exv_float	c[12];
+
+			LoadTransformBatch(m, c);
+			for (; i + 8 <= count; i += 8)
+			{
+				exv_float	x, y, z, w;
+
+				ExvTranspose4D(ExvLoadUnaligned(in), ExvLoadUnaligned(in + 8), ExvLoadUnaligned(in + 16), ExvLoadUnaligned(in + 24), &x, &y, &z, &w);
+				TransformBatch4D(c, x, y, z, w);
+				ExvTranspose4D(x, y, z, w, &x, &y, &z, &w);
+				ExvStoreUnaligned(x, out);
+				ExvStoreUnaligned(y, out + 8);
+				ExvStoreUnaligned(z, out + 16);
+				ExvStoreUnaligned(w, out + 24);
+
+				in += 32;
+				out += 32;
+			}
+
+		#elif !defined(TERATHON_NO_SIMD)
+
+			vec_float	c[12];
+
+			LoadTransformBatch(m, c);
+			for (; i + 4 <= count; i += 4)
+			{
+				vec_float	x, y, z, w;
+
+				VecTranspose4D(VecLoadUnaligned(in), VecLoadUnaligned(in + 4), VecLoadUnaligned(in + 8), VecLoadUnaligned(in + 12), &x, &y, &z, &w);
+				TransformBatch4D(c, x, y, z, w);
+				VecTranspose4D(x, y, z, w, &x, &y, &z, &w);
+				VecStoreUnaligned(x, out);
+				VecStoreUnaligned(y, out + 4);
+				VecStoreUnaligned(z, out + 8);
+				VecStoreUnaligned(w, out + 12);
+
+				in += 16;
+				out += 16;
+			}
+
+		#endif
+
+		for (; i < count; i++)
+		{
+			float x = in[0];
+			float y = in[1];
+			float z = in[2];
+			float w = in[3];
+
+			out[0] = m(0,0) * x + m(0,1) * y + m(0,2) * z + m(0,3) * w;
+			out[1] = m(1,0) * x + m(1,1) * y + m(1,2) * z + m(1,3) * w;
+			out[2] = m(2,0) * x + m(2,1) * y + m(2,2) * z + m(2,3) * w;
+			out[3] = w;
+
+			in += 4;
+			out += 4;
+		}
+	}
+
+	template <bool point>
+	void TransformArray3D(const Transform3D& m, const float *inX, const float *inY, const float *inZ, float *outX, float *outY, float *outZ, machine count)
+	{
+		machine i = 0;
+
+		#if defined(TERATHON_AVX512)
+
+			hexv_float		c[12];
+
+			LoadTransformBatch(m, c);
+			for (; i + 16 <= count; i += 16)
+			{
+				hexv_float x = HexvLoadUnaligned(inX + i);
+				hexv_float y = HexvLoadUnaligned(inY + i);
+				hexv_float z = HexvLoadUnaligned(inZ + i);
+				TransformBatch<point>(c, x, y, z);
+				HexvStoreUnaligned(x, outX + i);
+				HexvStoreUnaligned(y, outY + i);
+				HexvStoreUnaligned(z, outZ + i);
+			}
+
+			if (i < count)
+			{
+				hexv_mask mask = HexvMaskGetFirst(count - i);
+				hexv_float x = HexvMaskLoad(inX + i, mask);
+				hexv_float y = HexvMaskLoad(inY + i, mask);
+				hexv_float z = HexvMaskLoad(inZ + i, mask);
+				TransformBatch<point>(c, x, y, z);
+				HexvMaskStore(x, outX + i, mask);
+				HexvMaskStore(y, outY + i, mask);
+				HexvMaskStore(z, outZ + i, mask);
+				i = count;
+			}
+
+		#elif defined(TERATHON_AVX)
+
+			exv_float		c[12];
+
+			LoadTransformBatch(m, c);
+			for (; i + 8 <= count; i += 8)
+			{
+				exv_float x = ExvLoadUnaligned(inX + i);
+				exv_float y = ExvLoadUnaligned(inY + i);
+				exv_float z = ExvLoadUnaligned(inZ + i);
+				TransformBatch<point>(c, x, y, z);
+				ExvStoreUnaligned(x, outX + i);
+				ExvStoreUnaligned(y, outY + i);
+				ExvStoreUnaligned(z, outZ + i);
+			}
+
+		#elif !defined(TERATHON_NO_SIMD)
+
+			vec_float		c[12];
+
+			LoadTransformBatch(m, c);
+			for (; i + 4 <= count; i += 4)
+			{
+				vec_float x = VecLoadUnaligned(inX + i);
+				vec_float y = VecLoadUnaligned(inY + i);
+				vec_float z = VecLoadUnaligned(inZ + i);
+				TransformBatch<point>(c, x, y, z);
+				VecStoreUnaligned(x, outX + i);
+				VecStoreUnaligned(y, outY + i);
+				VecStoreUnaligned(z, outZ + i);
+			}
+
+		#endif
+
+		for (; i < count; i++)
+		{
+			TransformScalar<point>(m, inX[i], inY[i], inZ[i], &outX[i], &outY[i], &outZ[i]);
+		}
+	}
+
+	// The batch inverse holds each entry of the 3x4 parts of four or eight transforms in a separate register,
+	// where e[i][j] is the entry in row i and column j, and it performs the same operations as the scalar
+	// implementation of Inverse(const Transform3D&).
+
+	template <typename type>
+	inline void InverseTransformBatch(const type (*e)[4], const type& one, type (*r)[4])
+	{
+		type sx = e[1][0] * e[2][1] - e[2][0] * e[1][1];
+		type sy = e[2][0] * e[0][1] - e[0][0] * e[2][1];
+		type sz = e[0][0] * e[1][1] - e[1][0] * e[0][1];
+		type tx = e[1][2] * e[2][3] - e[2][2] * e[1][3];
+		type ty = e[2][2] * e[0][3] - e[0][2] * e[2][3];
+		type tz = e[0][2] * e[1][3] - e[1][2] * e[0][3];
+
+		type invDet = one / (sx * e[0][2] + sy * e[1][2] + sz * e[2][2]);
+
+		sx = sx * invDet;
+		sy = sy * invDet;
+		sz = sz * invDet;
+		tx = tx * invDet;
+		ty = ty * invDet;
+		tz = tz * invDet;
+		type vx = e[0][2] * invDet;
+		type vy = e[1][2] * invDet;
+		type vz = e[2][2] * invDet;
+
+		r[0][0] = e[1][1] * vz - e[2][1] * vy;
+		r[0][1] = e[2][1] * vx - e[0][1] * vz;
+		r[0][2] = e[0][1] * vy - e[1][1] * vx;
+		r[0][3] = -(e[0][1] * tx + e[1][1] * ty + e[2][1] * tz);
+		r[1][0] = vy * e[2][0] - vz * e[1][0];
+		r[1][1] = vz * e[0][0] - vx * e[2][0];
+		r[1][2] = vx * e[1][0] - vy * e[0][0];
+		r[1][3] = e[0][0] * tx + e[1][0] * ty + e[2][0] * tz;
+		r[2][0] = sx;
+		r[2][1] = sy;
+		r[2][2] = sz;
+		r[2][3] = -(e[0][3] * sx + e[1][3] * sy + e[2][3] * sz);
+	}
+
+	// The batch inverse of 4x4 matrices holds each of the 16 entries of four or eight matrices in a separate register,
+	// where e[j * 4 + i] is the entry in row i and column j, matching the storage order of Matrix4D. Because every
+	// matrix occupies one lane, the cross products and dot products need no shuffles, and the operations are the
+	// same as those in the scalar implementation of Inverse(const Matrix4D&).
+
+	template <typename type>
+	inline void InverseMatrix4DBatch(const type *e, const type& one, type *r)
+	{
+		const type& x = e[3];
+		const type& y = e[7];
+		const type& z = e[11];
+		const type& w = e[15];
+
+		type sx = e[1] * e[6] - e[2] * e[5];
+		type sy = e[2] * e[4] - e[0] * e[6];
+		type sz = e[0] * e[5] - e[1] * e[4];
+		type tx = e[9] * e[14] - e[10] * e[13];
+		type ty = e[10] * e[12] - e[8] * e[14];
+		type tz = e[8] * e[13] - e[9] * e[12];
+		type ux = e[0] * y - e[4] * x;
+		type uy = e[1] * y - e[5] * x;
+		type uz = e[2] * y - e[6] * x;
+		type vx = e[8] * w - e[12] * z;
+		type vy = e[9] * w - e[13] * z;
+		type vz = e[10] * w - e[14] * z;
+
+		type invDet = one / ((sx * vx + sy * vy + sz * vz) + (tx * ux + ty * uy + tz * uz));
+
+		sx = sx * invDet;
+		sy = sy * invDet;
+		sz = sz * invDet;
+		tx = tx * invDet;
+		ty = ty * invDet;
+		tz = tz * invDet;
+		ux = ux * invDet;
+		uy = uy * invDet;
+		uz = uz * invDet;
+		vx = vx * invDet;
+		vy = vy * invDet;
+		vz = vz * invDet;
+
+		r[0] = (e[5] * vz - e[6] * vy) + tx * y;
+		r[4] = (e[6] * vx - e[4] * vz) + ty * y;
+		r[8] = (e[4] * vy - e[5] * vx) + tz * y;
+		r[12] = -(e[4] * tx + e[5] * ty + e[6] * tz);
+
+		r[1] = (vy * e[2] - vz * e[1]) - tx * x;
+		r[5] = (vz * e[0] - vx * e[2]) - ty * x;
+		r[9] = (vx * e[1] - vy * e[0]) - tz * x;
+		r[13] = e[0] * tx + e[1] * ty + e[2] * tz;
+
+		r[2] = (e[13] * uz - e[14] * uy) + sx * w;
+		r[6] = (e[14] * ux - e[12] * uz) + sy * w;
+		r[10] = (e[12] * uy - e[13] * ux) + sz * w;
+		r[14] = -(e[12] * sx + e[13] * sy + e[14] * sz);
+
+		r[3] = (uy * e[10] - uz * e[9]) - sx * z;
+		r[7] = (uz * e[8] - ux * e[10]) - sy * z;
+		r[11] = (ux * e[9] - uy * e[8]) - sz * z;
+		r[15] = e[8] * sx + e[9] * sy + e[10] * sz;
+	}
+
+	#ifndef TERATHON_NO_SIMD
+
+		// Calculates the columns x, y, and z of the adjugate of the upper-left 3x3 part of a transform, and returns
+		// the determinant in every component. The rows of the adjugate are the cross products of pairs of columns.
+
+		inline vec_float GetAdjugateColumns(const Transform3D& m, vec_float *x, vec_float *y, vec_float *z)
+		{
+			vec_float	w;
+
+			vec_float a = VecLoad(&m(0,0));
+			vec_float b = VecLoad(&m(0,1));
+			vec_float c = VecLoad(&m(0,2));
+
+			vec_float g2 = VecCross3D(a, b);
+			VecTranspose4D(VecCross3D(b, c), VecCross3D(c, a), g2, VecFloatGetZero(), x, y, z, &w);
+			return (VecSmearX(VecDot3D(g2, c)));
+		}
+
+	#endif
+}
+
+
 alignas(64) const ConstMatrix4D Matrix4D::identity = {{{1.0F, 0.0F, 0.0F, 0.0F}, {0.0F, 1.0F, 0.0F, 0.0F}, {0.0F, 0.0F, 1.0F, 0.0F}, {0.0F, 0.0F, 0.0F, 1.0F}}};
 alignas(64) const ConstTransform3D Transform3D::identity = {{{1.0F, 0.0F, 0.0F, 0.0F}, {0.0F, 1.0F, 0.0F, 0.0F}, {0.0F, 0.0F, 1.0F, 0.0F}, {0.0F, 0.0F, 0.0F, 1.0F}}};
 
@@ -218,6 +785,120 @@ Vector4D Terathon::operator *(const Point2D& p, const Matrix4D& m)
 	                 m(0,3) * p.x + m(1,3) * p.y + m(3,3)));
 }
 
+void Terathon::MultiplyMatrices(const Matrix4D& m1, const Matrix4D *m2, Matrix4D *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->MultiplyMatrices4DLeft(&m1, m2, result, count);
+			return;
+		}
+
+	#endif
+
+	#if defined(TERATHON_AVX)
+
+		exv_float a = ExvLoadSmearVec(&m1(0,0));
+		exv_float b = ExvLoadSmearVec(&m1(0,1));
+		exv_float c = ExvLoadSmearVec(&m1(0,2));
+		exv_float d = ExvLoadSmearVec(&m1(0,3));
+
+		for (machine i = 0; i < count; i++)
+		{
+			exv_float p = ExvLoadUnaligned(&m2[i](0,0));
+			exv_float q = ExvLoadUnaligned(&m2[i](0,2));
+			ExvStoreUnaligned(ExvTransformVector4D(a, b, c, d, p), &result[i](0,0));
+			ExvStoreUnaligned(ExvTransformVector4D(a, b, c, d, q), &result[i](0,2));
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		vec_float a = VecLoad(&m1(0,0));
+		vec_float b = VecLoad(&m1(0,1));
+		vec_float c = VecLoad(&m1(0,2));
+		vec_float d = VecLoad(&m1(0,3));
+
+		for (machine i = 0; i < count; i++)
+		{
+			vec_float p = VecLoad(&m2[i](0,0));
+			vec_float q = VecLoad(&m2[i](0,1));
+			vec_float r = VecLoad(&m2[i](0,2));
+			vec_float s = VecLoad(&m2[i](0,3));
+			VecStore(VecTransformVector4D(a, b, c, d, p), &result[i](0,0));
+			VecStore(VecTransformVector4D(a, b, c, d, q), &result[i](0,1));
+			VecStore(VecTransformVector4D(a, b, c, d, r), &result[i](0,2));
+			VecStore(VecTransformVector4D(a, b, c, d, s), &result[i](0,3));
+		}
+
+	#else
+
+		for (machine i = 0; i < count; i++)
+		{
+			result[i] = m1 * m2[i];
+		}
+
+	#endif
+}
+
+void Terathon::MultiplyMatrices(const Matrix4D *m1, const Matrix4D& m2, Matrix4D *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->MultiplyMatrices4DRight(m1, &m2, result, count);
+			return;
+		}
+
+	#endif
+
+	#if defined(TERATHON_AVX)
+
+		exv_float p = ExvLoadUnaligned(&m2(0,0));
+		exv_float q = ExvLoadUnaligned(&m2(0,2));
+
+		for (machine i = 0; i < count; i++)
+		{
+			exv_float a = ExvLoadSmearVec(&m1[i](0,0));
+			exv_float b = ExvLoadSmearVec(&m1[i](0,1));
+			exv_float c = ExvLoadSmearVec(&m1[i](0,2));
+			exv_float d = ExvLoadSmearVec(&m1[i](0,3));
+			ExvStoreUnaligned(ExvTransformVector4D(a, b, c, d, p), &result[i](0,0));
+			ExvStoreUnaligned(ExvTransformVector4D(a, b, c, d, q), &result[i](0,2));
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		vec_float p = VecLoad(&m2(0,0));
+		vec_float q = VecLoad(&m2(0,1));
+		vec_float r = VecLoad(&m2(0,2));
+		vec_float s = VecLoad(&m2(0,3));
+
+		for (machine i = 0; i < count; i++)
+		{
+			vec_float a = VecLoad(&m1[i](0,0));
+			vec_float b = VecLoad(&m1[i](0,1));
+			vec_float c = VecLoad(&m1[i](0,2));
+			vec_float d = VecLoad(&m1[i](0,3));
+			VecStore(VecTransformVector4D(a, b, c, d, p), &result[i](0,0));
+			VecStore(VecTransformVector4D(a, b, c, d, q), &result[i](0,1));
+			VecStore(VecTransformVector4D(a, b, c, d, r), &result[i](0,2));
+			VecStore(VecTransformVector4D(a, b, c, d, s), &result[i](0,3));
+		}
+
+	#else
+
+		for (machine i = 0; i < count; i++)
+		{
+			result[i] = m1[i] * m2;
+		}
+
+	#endif
+}
+
 float Terathon::Determinant(const Matrix4D& m)
 {
 	const Vector3D& a = reinterpret_cast<const Vector3D&>(m[0]);
@@ -321,6 +1002,172 @@ Matrix4D Terathon::Inverse(const Matrix4D& m)
 	#endif
 }
 
+void Terathon::Inverse(const Matrix4D *m, Matrix4D *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->InverseMatrix4DArray(m, result, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		const exv_float one = ExvLoadVectorConstant<0x3F800000>();
+
+		for (; i + 8 <= count; i += 8)
+		{
+			exv_float	e[16], r[16];
+
+			// Each column is transposed on load so that the entries of the eight matrices are gathered into
+			// separate registers, and the same transpose puts the columns of the inverses back in place.
+
+			const Matrix4D *M = m + i;
+			for (machine j = 0; j < 4; j++)
+			{
+				ExvTranspose4D(ExvFloat(VecLoad(&M[0](0,j)), VecLoad(&M[4](0,j))), ExvFloat(VecLoad(&M[1](0,j)), VecLoad(&M[5](0,j))),
+				               ExvFloat(VecLoad(&M[2](0,j)), VecLoad(&M[6](0,j))), ExvFloat(VecLoad(&M[3](0,j)), VecLoad(&M[7](0,j))), &e[j * 4], &e[j * 4 + 1], &e[j * 4 + 2], &e[j * 4 + 3]);
+			}
+
+			InverseMatrix4DBatch(e, one, r);
+
+			Matrix4D *R = result + i;
+			for (machine j = 0; j < 4; j++)
+			{
+				exv_float	a, b, c, d;
+
+				ExvTranspose4D(r[j * 4], r[j * 4 + 1], r[j * 4 + 2], r[j * 4 + 3], &a, &b, &c, &d);
+				VecStore(ExvGetVecLo(a), &R[0](0,j));
+				VecStore(ExvGetVecLo(b), &R[1](0,j));
+				VecStore(ExvGetVecLo(c), &R[2](0,j));
+				VecStore(ExvGetVecLo(d), &R[3](0,j));
+				VecStore(ExvGetVecHi(a), &R[4](0,j));
+				VecStore(ExvGetVecHi(b), &R[5](0,j));
+				VecStore(ExvGetVecHi(c), &R[6](0,j));
+				VecStore(ExvGetVecHi(d), &R[7](0,j));
+			}
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		const vec_float one = VecLoadVectorConstant<0x3F800000>();
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	e[16], r[16];
+
+			const Matrix4D *M = m + i;
+			for (machine j = 0; j < 4; j++)
+			{
+				VecTranspose4D(VecLoad(&M[0](0,j)), VecLoad(&M[1](0,j)), VecLoad(&M[2](0,j)), VecLoad(&M[3](0,j)), &e[j * 4], &e[j * 4 + 1], &e[j * 4 + 2], &e[j * 4 + 3]);
+			}
+
+			InverseMatrix4DBatch(e, one, r);
+
+			Matrix4D *R = result + i;
+			for (machine j = 0; j < 4; j++)
+			{
+				vec_float	a, b, c, d;
+
+				VecTranspose4D(r[j * 4], r[j * 4 + 1], r[j * 4 + 2], r[j * 4 + 3], &a, &b, &c, &d);
+				VecStore(a, &R[0](0,j));
+				VecStore(b, &R[1](0,j));
+				VecStore(c, &R[2](0,j));
+				VecStore(d, &R[3](0,j));
+			}
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		result[i] = Inverse(m[i]);
+	}
+}
+
+void Terathon::Inverse(const float *const *m, float *const *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->InverseMatrix4DColumns(m, result, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		const exv_float one = ExvLoadVectorConstant<0x3F800000>();
+
+		for (; i + 8 <= count; i += 8)
+		{
+			exv_float	e[16], r[16];
+
+			for (machine k = 0; k < 16; k++)
+			{
+				e[k] = ExvLoadUnaligned(m[k] + i);
+			}
+
+			InverseMatrix4DBatch(e, one, r);
+
+			for (machine k = 0; k < 16; k++)
+			{
+				ExvStoreUnaligned(r[k], result[k] + i);
+			}
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		const vec_float one = VecLoadVectorConstant<0x3F800000>();
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	e[16], r[16];
+
+			for (machine k = 0; k < 16; k++)
+			{
+				e[k] = VecLoadUnaligned(m[k] + i);
+			}
+
+			InverseMatrix4DBatch(e, one, r);
+
+			for (machine k = 0; k < 16; k++)
+			{
+				VecStoreUnaligned(r[k], result[k] + i);
+			}
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		float	e[16], r[16];
+
+		for (machine k = 0; k < 16; k++)
+		{
+			e[k] = m[k][i];
+		}
+
+		InverseMatrix4DBatch(e, 1.0F, r);
+
+		for (machine k = 0; k < 16; k++)
+		{
+			result[k][i] = r[k];
+		}
+	}
+}
+
 Matrix4D Terathon::Adjugate(const Matrix4D& m)
 {
 	const Vector3D& a = reinterpret_cast<const Vector3D&>(m[0]);
@@ -916,6 +1763,290 @@ Matrix3D Terathon::Transform(const Transform3D& m1, const Matrix3D& m2)
 	                 m1(2,0) * m2(0,2) + m1(2,1) * m2(1,2) + m1(2,2) * m2(2,2)));
 }
 
+void Terathon::TransformPoints(const Transform3D& m, const Point3D *in, Point3D *out, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->TransformPointsTransform3D(&m, in, out, count);
+			return;
+		}
+
+	#endif
+
+	TransformArray3D<true>(m, &in->x, &out->x, count);
+}
+
+void Terathon::TransformVectors(const Transform3D& m, const Vector3D *in, Vector3D *out, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->TransformVectorsTransform3D(&m, in, out, count);
+			return;
+		}
+
+	#endif
+
+	TransformArray3D<false>(m, &in->x, &out->x, count);
+}
+
+void Terathon::TransformPoints(const Transform3D& m, const FlatPoint3D *in, FlatPoint3D *out, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->TransformFlatPointsTransform3D(&m, in, out, count);
+			return;
+		}
+
+	#endif
+
+	TransformArray4D(m, &in->x, &out->x, count);
+}
+
+void Terathon::TransformPoints(const Transform3D& m, const Point3D *in, machine inStride, Point3D *out, machine outStride, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->TransformPointsStridedTransform3D(&m, in, inStride, out, outStride, count);
+			return;
+		}
+
+	#endif
+
+	if ((inStride == sizeof(Point3D)) && (outStride == sizeof(Point3D)))
+	{
+		TransformArray3D<true>(m, &in->x, &out->x, count);
+	}
+	else
+	{
+		TransformArray3D<true>(m, reinterpret_cast<const char *>(in), inStride, reinterpret_cast<char *>(out), outStride, count);
+	}
+}
+
+void Terathon::TransformVectors(const Transform3D& m, const Vector3D *in, machine inStride, Vector3D *out, machine outStride, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->TransformVectorsStridedTransform3D(&m, in, inStride, out, outStride, count);
+			return;
+		}
+
+	#endif
+
+	if ((inStride == sizeof(Vector3D)) && (outStride == sizeof(Vector3D)))
+	{
+		TransformArray3D<false>(m, &in->x, &out->x, count);
+	}
+	else
+	{
+		TransformArray3D<false>(m, reinterpret_cast<const char *>(in), inStride, reinterpret_cast<char *>(out), outStride, count);
+	}
+}
+
+void Terathon::TransformPoints(const Transform3D& m, const float *inX, const float *inY, const float *inZ, float *outX, float *outY, float *outZ, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->TransformPointsSoaTransform3D(&m, inX, inY, inZ, outX, outY, outZ, count);
+			return;
+		}
+
+	#endif
+
+	TransformArray3D<true>(m, inX, inY, inZ, outX, outY, outZ, count);
+}
+
+void Terathon::TransformVectors(const Transform3D& m, const float *inX, const float *inY, const float *inZ, float *outX, float *outY, float *outZ, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->TransformVectorsSoaTransform3D(&m, inX, inY, inZ, outX, outY, outZ, count);
+			return;
+		}
+
+	#endif
+
+	TransformArray3D<false>(m, inX, inY, inZ, outX, outY, outZ, count);
+}
+
+void Terathon::StoreTransformMatrices(const Transform3D *transform, float *matrix, machine count, uint32 flags)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->StoreTransformMatricesTransform3D(transform, matrix, count, flags);
+			return;
+		}
+
+	#endif
+
+	machine size = (flags & kMatrixStore3x4) ? 12 : 16;
+
+	#ifndef TERATHON_NO_SIMD
+
+		for (machine k = 0; k < count; k += 4)
+		{
+			vec_float	entry[3][4];
+
+			machine n = (count - k < 4) ? count - k : 4;
+			const Transform3D *m = transform + k;
+
+			for (machine j = 0; j < 4; j++)
+			{
+				vec_float	column[4];
+				vec_float	w;
+
+				for (machine a = 0; a < 4; a++)
+				{
+					column[a] = VecLoad(&m[(a < n) ? a : n - 1](0,j));
+				}
+
+				VecTranspose4D(column[0], column[1], column[2], column[3], &entry[0][j], &entry[1][j], &entry[2][j], &w);
+			}
+
+			StoreTransformMatrices(entry, matrix + k * size, n, flags);
+		}
+
+	#else
+
+		bool rowMajor = ((flags & kMatrixStoreRowMajor) != 0);
+		machine rowCount = (flags & kMatrixStore3x4) ? 3 : 4;
+
+		for (machine k = 0; k < count; k++)
+		{
+			const Transform3D& m = transform[k];
+			float *f = matrix + k * size;
+
+			for (machine i = 0; i < rowCount; i++)
+			{
+				for (machine j = 0; j < 4; j++)
+				{
+					f[(rowMajor) ? i * 4 + j : j * rowCount + i] = m(i,j);
+				}
+			}
+		}
+
+	#endif
+}
+
+#ifndef TERATHON_NO_SIMD
+
+	void Terathon::StoreTransformMatrices(const vec_float (*entry)[4], float *matrix, machine count, uint32 flags)
+	{
+		vec_float	row[4];
+
+		bool stream = ((flags & kMatrixStoreNontemporal) != 0);
+
+		if (flags & kMatrixStoreRowMajor)
+		{
+			machine size = (flags & kMatrixStore3x4) ? 12 : 16;
+			alignas(16) static const float unit[4] = {0.0F, 0.0F, 0.0F, 1.0F};
+
+			for (machine i = 0; i < 3; i++)
+			{
+				VecTranspose4D(entry[i][0], entry[i][1], entry[i][2], entry[i][3], &row[0], &row[1], &row[2], &row[3]);
+
+				for (machine k = 0; k < count; k++)
+				{
+					float *f = matrix + k * size + i * 4;
+					if (stream)
+					{
+						VecStoreNontemporal(row[k], f);
+					}
+					else
+					{
+						VecStoreUnaligned(row[k], f);
+					}
+				}
+			}
+
+			if (size == 16)
+			{
+				for (machine k = 0; k < count; k++)
+				{
+					float *f = matrix + k * 16 + 12;
+					if (stream)
+					{
+						VecStoreNontemporal(VecLoad(unit), f);
+					}
+					else
+					{
+						VecStoreUnaligned(VecLoad(unit), f);
+					}
+				}
+			}
+		}
+		else
+		{
+			vec_float zero = VecFloatGetZero();
+
+			if (flags & kMatrixStore3x4)
+			{
+				for (machine j = 0; j < 4; j++)
+				{
+					VecTranspose4D(entry[0][j], entry[1][j], entry[2][j], zero, &row[0], &row[1], &row[2], &row[3]);
+
+					for (machine k = 0; k < count; k++)
+					{
+						VecStore3D(row[k], matrix + k * 12 + j * 3);
+					}
+				}
+
+				stream = false;
+			}
+			else
+			{
+				for (machine j = 0; j < 4; j++)
+				{
+					vec_float w = (j == 3) ? VecLoadVectorConstant<0x3F800000>() : zero;
+					VecTranspose4D(entry[0][j], entry[1][j], entry[2][j], w, &row[0], &row[1], &row[2], &row[3]);
+
+					for (machine k = 0; k < count; k++)
+					{
+						float *f = matrix + k * 16 + j * 4;
+						if (stream)
+						{
+							VecStoreNontemporal(row[k], f);
+						}
+						else
+						{
+							VecStoreUnaligned(row[k], f);
+						}
+					}
+				}
+			}
+		}
+
+		if (stream)
+		{
+			VecStoreFence();
+		}
+	}
+
+#endif
+
 #ifndef TERATHON_NO_SIMD
 
 	vec_float Terathon::TransformVector3D(const Transform3D& m, vec_float v)
@@ -933,30 +2064,32 @@ Matrix3D Terathon::Transform(const Transform3D& m1, const Matrix3D& m2)
 
 float Terathon::Determinant(const Transform3D& m)
 {
-	return (m(0,0) * (m(1,1) * m(2,2) - m(1,2) * m(2,1)) - m(0,1) * (m(1,0) * m(2,2) - m(1,2) * m(2,0)) + m(0,2) * (m(1,0) * m(2,1) - m(1,1) * m(2,0)));
+	#ifndef TERATHON_NO_SIMD
+
+		float	result;
+
+		VecStoreX(VecDot3D(VecCross3D(VecLoad(&m(0,0)), VecLoad(&m(0,1))), VecLoad(&m(0,2))), &result);
+		return (result);
+
+	#else
+
+		return (m(0,0) * (m(1,1) * m(2,2) - m(1,2) * m(2,1)) - m(0,1) * (m(1,0) * m(2,2) - m(1,2) * m(2,0)) + m(0,2) * (m(1,0) * m(2,1) - m(1,1) * m(2,0)));
+
+	#endif
 }
 
 Transform3D Terathon::Inverse(const Transform3D& m)
 {
 	// See FGED1, Section 2.6.
 
-	#ifdef TERATHON_SSE
+	#ifndef TERATHON_NO_SIMD
 
 		Transform3D		result;
+		vec_float		a, b, c, d;
 
-		vec_float a = VecLoad(&m(0,0));
-		vec_float b = VecLoad(&m(0,1));
-		vec_float c = VecLoad(&m(0,2));
-		vec_float d = VecLoad(&m(0,3));
-
-		vec_float t0 = VecShuffle<1,0,1,0>(a, b);
-		vec_float t1 = VecShuffle<1,0,1,0>(c, d);
-		vec_float t2 = VecShuffle<3,2,3,2>(a, b);
-		vec_float t3 = VecShuffle<3,2,3,2>(c, d);
+		// Transposing the columns produces the rows of the 3x4 part of the transform in a, b, and c.
 
-		a = VecShuffle<2,0,2,0>(t0, t1);
-		b = VecShuffle<3,1,3,1>(t0, t1);
-		c = VecShuffle<2,0,2,0>(t2, t3);
+		VecTranspose4D(VecLoad(&m(0,0)), VecLoad(&m(0,1)), VecLoad(&m(0,2)), VecLoad(&m(0,3)), &a, &b, &c, &d);
 
 		vec_float x = VecSmearW(a);
 		vec_float y = VecSmearW(b);
@@ -1003,23 +2136,12 @@ Transform3D Terathon::Inverse(const Transform3D& m)
 
 Transform3D Terathon::InverseUnitDet(const Transform3D& m)
 {
-	#ifdef TERATHON_SSE
+	#ifndef TERATHON_NO_SIMD
 
 		Transform3D		result;
+		vec_float		r0, r1, r2, r3;
 
-		vec_float a = VecLoad(&m(0,0));
-		vec_float b = VecLoad(&m(0,1));
-		vec_float c = VecLoad(&m(0,2));
-		vec_float d = VecLoad(&m(0,3));
-
-		vec_float t0 = VecShuffle<1,0,1,0>(a, b);
-		vec_float t1 = VecShuffle<1,0,1,0>(c, d);
-		vec_float t2 = VecShuffle<3,2,3,2>(a, b);
-		vec_float t3 = VecShuffle<3,2,3,2>(c, d);
-
-		vec_float r0 = VecShuffle<2,0,2,0>(t0, t1);
-		vec_float r1 = VecShuffle<3,1,3,1>(t0, t1);
-		vec_float r2 = VecShuffle<2,0,2,0>(t2, t3);
+		VecTranspose4D(VecLoad(&m(0,0)), VecLoad(&m(0,1)), VecLoad(&m(0,2)), VecLoad(&m(0,3)), &r0, &r1, &r2, &r3);
 
 		vec_float s = VecCross3D(r0, r1);
 		vec_float h = r0 * VecSmearW(r1) - r1 * VecSmearW(r0);
@@ -1050,59 +2172,223 @@ Transform3D Terathon::InverseUnitDet(const Transform3D& m)
 
 Matrix3D Terathon::InverseUnitDet3D(const Transform3D& m)
 {
-	const Vector3D& a = m[0];
-	const Vector3D& b = m[1];
-	const Vector3D& c = m[2];
+	#ifndef TERATHON_NO_SIMD
+
+		Matrix3D	result;
+		vec_float	x, y, z, w;
+
+		vec_float a = VecLoad(&m(0,0));
+		vec_float b = VecLoad(&m(0,1));
+		vec_float c = VecLoad(&m(0,2));
+
+		VecTranspose4D(VecCross3D(b, c), VecCross3D(c, a), VecCross3D(a, b), VecFloatGetZero(), &x, &y, &z, &w);
+		VecStore3D(x, &result(0,0));
+		VecStore3D(y, &result(0,1));
+		VecStore3D(z, &result(0,2));
+		return (result);
+
+	#else
+
+		const Vector3D& a = m[0];
+		const Vector3D& b = m[1];
+		const Vector3D& c = m[2];
 
-	Bivector3D g0 = b ^ c;
-	Bivector3D g1 = c ^ a;
-	Bivector3D g2 = a ^ b;
+		Bivector3D g0 = b ^ c;
+		Bivector3D g1 = c ^ a;
+		Bivector3D g2 = a ^ b;
 
-	return (Matrix3D(g0.x, g0.y, g0.z, g1.x, g1.y, g1.z, g2.x, g2.y, g2.z));
+		return (Matrix3D(g0.x, g0.y, g0.z, g1.x, g1.y, g1.z, g2.x, g2.y, g2.z));
+
+	#endif
 }
 
 Vector3D Terathon::InverseTransform(const Transform3D& m, const Vector3D& v)
 {
-	const Vector3D& a = m[0];
-	const Vector3D& b = m[1];
-	const Vector3D& c = m[2];
+	#ifndef TERATHON_NO_SIMD
 
-	Bivector3D s = a ^ b;
-	float invDet = 1.0F / (s ^ c);
+		Vector3D	result;
+		vec_float	x, y, z;
+
+		vec_float det = GetAdjugateColumns(m, &x, &y, &z);
+		VecStore3D(VecDiv(VecTransformVector3D(x, y, z, VecLoad3D(&v.x)), det), &result.x);
+		return (result);
 
-	return (Vector3D((b ^ c ^ v) * invDet, (c ^ a ^ v) * invDet, (s ^ v) * invDet));
+	#else
+
+		const Vector3D& a = m[0];
+		const Vector3D& b = m[1];
+		const Vector3D& c = m[2];
+
+		Bivector3D s = a ^ b;
+		float invDet = 1.0F / (s ^ c);
+
+		return (Vector3D((b ^ c ^ v) * invDet, (c ^ a ^ v) * invDet, (s ^ v) * invDet));
+
+	#endif
 }
 
 Point3D Terathon::InverseTransform(const Transform3D& m, const Point3D& p)
 {
-	const Vector3D& a = m[0];
-	const Vector3D& b = m[1];
-	const Vector3D& c = m[2];
-	const Vector3D& d = m[3];
+	#ifndef TERATHON_NO_SIMD
 
-	Bivector3D s = a ^ b;
-	float invDet = 1.0F / (s ^ c);
+		Point3D		result;
+		vec_float	x, y, z;
 
-	Vector3D q = p - d;
-	return (Point3D((b ^ c ^ q) * invDet, (c ^ a ^ q) * invDet, (s ^ q) * invDet));
+		vec_float det = GetAdjugateColumns(m, &x, &y, &z);
+		vec_float q = VecLoad3D(&p.x) - VecLoad(&m(0,3));
+		VecStore3D(VecDiv(VecTransformVector3D(x, y, z, q), det), &result.x);
+		return (result);
+
+	#else
+
+		const Vector3D& a = m[0];
+		const Vector3D& b = m[1];
+		const Vector3D& c = m[2];
+		const Vector3D& d = m[3];
+
+		Bivector3D s = a ^ b;
+		float invDet = 1.0F / (s ^ c);
+
+		Vector3D q = p - d;
+		return (Point3D((b ^ c ^ q) * invDet, (c ^ a ^ q) * invDet, (s ^ q) * invDet));
+
+	#endif
 }
 
 Vector3D Terathon::InverseUnitDetTransform(const Transform3D& m, const Vector3D& v)
 {
-	const Vector3D& a = m[0];
-	const Vector3D& b = m[1];
-	const Vector3D& c = m[2];
+	#ifndef TERATHON_NO_SIMD
+
+		Vector3D	result;
+		vec_float	x, y, z;
+
+		GetAdjugateColumns(m, &x, &y, &z);
+		VecStore3D(VecTransformVector3D(x, y, z, VecLoad3D(&v.x)), &result.x);
+		return (result);
+
+	#else
 
-	return (Vector3D(b ^ c ^ v, c ^ a ^ v, a ^ b ^ v));
+		const Vector3D& a = m[0];
+		const Vector3D& b = m[1];
+		const Vector3D& c = m[2];
+
+		return (Vector3D(b ^ c ^ v, c ^ a ^ v, a ^ b ^ v));
+
+	#endif
 }
 
 Point3D Terathon::InverseUnitDetTransform(const Transform3D& m, const Point3D& p)
 {
-	const Vector3D& a = m[0];
-	const Vector3D& b = m[1];
-	const Vector3D& c = m[2];
-	const Vector3D& d = m[3];
+	#ifndef TERATHON_NO_SIMD
+
+		Point3D		result;
+		vec_float	x, y, z;
+
+		GetAdjugateColumns(m, &x, &y, &z);
+		VecStore3D(VecTransformVector3D(x, y, z, VecLoad3D(&p.x) - VecLoad(&m(0,3))), &result.x);
+		return (result);
+
+	#else
+
+		const Vector3D& a = m[0];
+		const Vector3D& b = m[1];
+		const Vector3D& c = m[2];
+		const Vector3D& d = m[3];
+
+		Vector3D q = p - d;
+		return (Point3D(b ^ c ^ q, c ^ a ^ q, a ^ b ^ q));
+
+	#endif
+}
+
+void Terathon::Inverse(const Transform3D *m, Transform3D *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->InverseTransform3DArray(m, result, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		const exv_float zero = ExvFloatGetZero();
+		const exv_float one = ExvLoadVectorConstant<0x3F800000>();
+
+		for (; i + 8 <= count; i += 8)
+		{
+			exv_float	e[3][4], r[3][4];
+
+			const Transform3D *M = m + i;
+			for (machine j = 0; j < 4; j++)
+			{
+				exv_float	w;
+
+				ExvTranspose4D(ExvFloat(VecLoad(&M[0](0,j)), VecLoad(&M[4](0,j))), ExvFloat(VecLoad(&M[1](0,j)), VecLoad(&M[5](0,j))),
+				               ExvFloat(VecLoad(&M[2](0,j)), VecLoad(&M[6](0,j))), ExvFloat(VecLoad(&M[3](0,j)), VecLoad(&M[7](0,j))), &e[0][j], &e[1][j], &e[2][j], &w);
+			}
+
+			InverseTransformBatch(e, one, r);
+
+			Transform3D *R = result + i;
+			for (machine j = 0; j < 4; j++)
+			{
+				exv_float	a, b, c, d;
+
+				ExvTranspose4D(r[0][j], r[1][j], r[2][j], (j < 3) ? zero : one, &a, &b, &c, &d);
+				VecStore(ExvGetVecLo(a), &R[0](0,j));
+				VecStore(ExvGetVecLo(b), &R[1](0,j));
+				VecStore(ExvGetVecLo(c), &R[2](0,j));
+				VecStore(ExvGetVecLo(d), &R[3](0,j));
+				VecStore(ExvGetVecHi(a), &R[4](0,j));
+				VecStore(ExvGetVecHi(b), &R[5](0,j));
+				VecStore(ExvGetVecHi(c), &R[6](0,j));
+				VecStore(ExvGetVecHi(d), &R[7](0,j));
+			}
+		}
 
-	Vector3D q = p - d;
-	return (Point3D(b ^ c ^ q, c ^ a ^ q, a ^ b ^ q));
+	#elif !defined(TERATHON_NO_SIMD)
+
+		const vec_float zero = VecFloatGetZero();
+		const vec_float one = VecLoadVectorConstant<0x3F800000>();
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	e[3][4], r[3][4];
+
+			const Transform3D *M = m + i;
+			for (machine j = 0; j < 4; j++)
+			{
+				vec_float	w;
+
+				VecTranspose4D(VecLoad(&M[0](0,j)), VecLoad(&M[1](0,j)), VecLoad(&M[2](0,j)), VecLoad(&M[3](0,j)), &e[0][j], &e[1][j], &e[2][j], &w);
+			}
+
+			InverseTransformBatch(e, one, r);
+
+			Transform3D *R = result + i;
+			for (machine j = 0; j < 4; j++)
+			{
+				vec_float	a, b, c, d;
+
+				VecTranspose4D(r[0][j], r[1][j], r[2][j], (j < 3) ? zero : one, &a, &b, &c, &d);
+				VecStore(a, &R[0](0,j));
+				VecStore(b, &R[1](0,j));
+				VecStore(c, &R[2](0,j));
+				VecStore(d, &R[3](0,j));
+			}
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		result[i] = Inverse(m[i]);
+	}
 }
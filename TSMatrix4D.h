@@ -186,6 +186,18 @@ namespace Terathon
 	TERATHON_API Vector4D operator *(const Matrix4D& m, const Point2D& p);
 	TERATHON_API Vector4D operator *(const Point2D& p, const Matrix4D& m);
 
+	/// \brief Calculates the products of the matrix $m1$ with each of the $count$ matrices in the array $m2$ and stores them in the array $result$.
+	/// The $m2$ and $result$ arrays may be the same, but they must not otherwise overlap.
+	/// \related Matrix4D
+
+	TERATHON_API void MultiplyMatrices(const Matrix4D& m1, const Matrix4D *m2, Matrix4D *result, machine count);
+
+	/// \brief Calculates the products of each of the $count$ matrices in the array $m1$ with the matrix $m2$ and stores them in the array $result$.
+	/// The $m1$ and $result$ arrays may be the same, but they must not otherwise overlap.
+	/// \related Matrix4D
+
+	TERATHON_API void MultiplyMatrices(const Matrix4D *m1, const Matrix4D& m2, Matrix4D *result, machine count);
+
 	/// \brief Returns the determinant of the matrix $m$.
 	/// \related Matrix4D
 
@@ -196,6 +208,22 @@ namespace Terathon
 
 	TERATHON_API Matrix4D Inverse(const Matrix4D& m);
 
+	/// \brief Calculates the inverses of the $count$ matrices in the array $m$ and stores them in the array $result$.
+	/// Four or eight matrices are inverted at a time with the SIMD kernels after their columns are transposed so that
+	/// each register holds one entry of every matrix. The $m$ and $result$ arrays may be the same, but they must not
+	/// otherwise overlap. If any matrix is singular, then its inverse is undefined.
+	/// \related Matrix4D
+
+	TERATHON_API void Inverse(const Matrix4D *m, Matrix4D *result, machine count);
+
+	/// \brief Calculates the inverses of $count$ matrices stored in structure-of-arrays layout.
+	/// Each of $m$ and $result$ points to 16 arrays, and the array with index 4<i>j</i>&#x202F;+&#x202F;<i>i</i> holds the entries
+	/// in row <i>i</i> and column <i>j</i>, which is the same order in which the entries of a Matrix4D are stored.
+	/// Each output array may be the same as the corresponding input array.
+	/// \related Matrix4D
+
+	TERATHON_API void Inverse(const float *const *m, float *const *result, machine count);
+
 	/// \brief Returns the adjugate of the matrix $m$.
 	/// \related Matrix4D
 
@@ -448,11 +476,73 @@ namespace Terathon
 	TERATHON_API Transform3D Scale(const Transform3D& m, const Vector3D& v);
 	TERATHON_API Matrix3D Transform(const Transform3D& m1, const Matrix3D& m2);
 
+	/// \brief Transforms the $count$ points in the array $in$ by the transform $m$ and stores the results in the array $out$.
+	/// The $in$ and $out$ arrays may be the same, but they must not otherwise overlap.
+	/// \related Transform3D
+
+	TERATHON_API void TransformPoints(const Transform3D& m, const Point3D *in, Point3D *out, machine count);
+
+	/// \brief Transforms the $count$ vectors in the array $in$ by the transform $m$ and stores the results in the array $out$.
+	/// The $in$ and $out$ arrays may be the same, but they must not otherwise overlap.
+	/// \related Transform3D
+
+	TERATHON_API void TransformVectors(const Transform3D& m, const Vector3D *in, Vector3D *out, machine count);
+
+	/// \brief Transforms the $count$ flat points in the array $in$ by the transform $m$ and stores the results in the array $out$.
+	/// The <i>w</i> coordinate of each flat point is preserved, and it multiplies the translation of $m$.
+	/// The $in$ and $out$ arrays may be the same, but they must not otherwise overlap.
+	/// \related Transform3D
+
+	TERATHON_API void TransformPoints(const Transform3D& m, const FlatPoint3D *in, FlatPoint3D *out, machine count);
+
+	/// \brief Transforms $count$ points by the transform $m$, where consecutive input and output points are separated by $inStride$ and $outStride$ bytes.
+	/// \related Transform3D
+
+	TERATHON_API void TransformPoints(const Transform3D& m, const Point3D *in, machine inStride, Point3D *out, machine outStride, machine count);
+
+	/// \brief Transforms $count$ vectors by the transform $m$, where consecutive input and output vectors are separated by $inStride$ and $outStride$ bytes.
+	/// \related Transform3D
+
+	TERATHON_API void TransformVectors(const Transform3D& m, const Vector3D *in, machine inStride, Vector3D *out, machine outStride, machine count);
+
+	/// \brief Transforms $count$ points stored in structure-of-arrays layout by the transform $m$.
+	/// Each output array may be the same as the corresponding input array.
+	/// \related Transform3D
+
+	TERATHON_API void TransformPoints(const Transform3D& m, const float *inX, const float *inY, const float *inZ, float *outX, float *outY, float *outZ, machine count);
+
+	/// \brief Transforms $count$ vectors stored in structure-of-arrays layout by the transform $m$.
+	/// Each output array may be the same as the corresponding input array.
+	/// \related Transform3D
+
+	TERATHON_API void TransformVectors(const Transform3D& m, const float *inX, const float *inY, const float *inZ, float *outX, float *outY, float *outZ, machine count);
+
+	/// \brief Flags that specify the layout used by the StoreTransformMatrices() functions.
+
+	enum : uint32
+	{
+		kMatrixStoreRowMajor		= 1 << 0,		///< Each matrix is stored in row-major order instead of column-major order.
+		kMatrixStore3x4				= 1 << 1,		///< The fourth row of each matrix is omitted, so each matrix occupies 12 floats instead of 16.
+		kMatrixStoreNontemporal		= 1 << 2		///< The matrices are written with non-temporal stores that bypass the cache. The buffer must be 16-byte aligned, and this flag is ignored for the column-major 3&#x202F;&times;&#x202F;4 layout.
+	};
+
+	/// \brief Stores the $count$ transforms in the array $transform$ in the float buffer $matrix$ using the layout specified by $flags$.
+	/// The $flags$ parameter can be a combination (through logical OR) of the $kMatrixStore$ flags. Matrices are stored contiguously,
+	/// each occupying 16 floats, or 12 floats if the $kMatrixStore3x4$ flag is specified.
+	/// \related Transform3D
+
+	TERATHON_API void StoreTransformMatrices(const Transform3D *transform, float *matrix, machine count, uint32 flags = 0);
+
 	#ifndef TERATHON_NO_SIMD
 
 		TERATHON_API vec_float TransformVector3D(const Transform3D& m, vec_float v);
 		TERATHON_API vec_float TransformPoint3D(const Transform3D& m, vec_float p);
 
+		// Stores up to four 3D transforms whose entries are given in structure-of-arrays form. The value
+		// entry[i][j] holds the (i,j) entries of the transforms, and count must be in the range [1, 4].
+
+		TERATHON_API void StoreTransformMatrices(const vec_float (*entry)[4], float *matrix, machine count, uint32 flags);
+
 	#endif
 
 	/// \brief Returns the determinant of the transform $m$.
@@ -476,6 +566,13 @@ namespace Terathon
 	TERATHON_API Vector3D InverseUnitDetTransform(const Transform3D& m, const Vector3D& v);
 	TERATHON_API Point3D InverseUnitDetTransform(const Transform3D& m, const Point3D& p);
 
+	/// \brief Calculates the inverses of the $count$ transforms in the array $m$ and stores them in the array $result$.
+	/// Four or eight transforms are inverted at a time with the SIMD kernels. The $m$ and $result$ arrays may be the same,
+	/// but they must not otherwise overlap. If any transform is singular, then its inverse is undefined.
+	/// \related Transform3D
+
+	TERATHON_API void Inverse(const Transform3D *m, Transform3D *result, machine count);
+
 
 	// ==============================================
 	//	POD Structures
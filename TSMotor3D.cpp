@@ -8,6 +8,7 @@
 
 
 #include "TSMotor3D.h"
+#include "TSSimdDispatch.h"
 
 
 using namespace Terathon;
@@ -16,6 +17,84 @@ using namespace Terathon;
 alignas(32) const ConstMotor3D Motor3D::identity = {0.0F, 0.0F, 0.0F, 1.0F, 0.0F, 0.0F, 0.0F, 0.0F};
 
 
+#ifndef TERATHON_NO_SIMD
+
+	namespace
+	{
+		// These follow the scalar Line3D and Plane3D transforms operation for operation, so they
+		// produce identical results when the compiler does not fuse the multiplies and adds.
+
+		inline void VecTransformLine(const vec_float& v, const vec_float& m, const vec_float& lv, const vec_float& lm, vec_float *rv, vec_float *rm)
+		{
+			vec_float vw = VecSmearW(v);
+			vec_float mw = VecSmearW(m);
+
+			vec_float a = VecCross3D(v, lv);
+			*rv = lv + (VecCross3D(v, a) + a * vw) * VecLoadVectorConstant<0x40000000>();
+
+			vec_float d = VecCross3D(v, lm) + VecCross3D(m, lv);
+			*rm = lm + (a * mw + d * vw + VecCross3D(v, d) + VecCross3D(m, a)) * VecLoadVectorConstant<0x40000000>();
+		}
+
+		inline vec_float VecTransformPlane(const vec_float& v, const vec_float& m, const vec_float& g, vec_float *rw)
+		{
+			vec_float vw = VecSmearW(v);
+			vec_float mw = VecSmearW(m);
+			vec_float two = VecLoadVectorConstant<0x40000000>();
+
+			vec_float b = VecCross3D(m, g) + g * mw;
+			vec_float bv = VecDot3D(b, v);
+			vec_float mg = VecDot3D(m, g);
+
+			vec_float a = VecCross3D(v, g) * two;
+			*rw = VecSmearW(g) + (bv - mg * vw) * two;
+			return (g + (VecCross3D(v, a) + a * vw));
+		}
+	}
+
+#endif
+
+
+namespace
+{
+	// Calculates c * P[0] + s * P[1] + tc * P[2] + ts * P[3] for the coefficients of a MotorInterpolator.
+
+	inline void CombineMotors(const Motor3D *P, float c, float s, float t, Motor3D *result)
+	{
+		float tc = t * c;
+		float ts = t * s;
+
+		#if defined(TERATHON_AVX)
+
+			exv_float r = ExvMul(ExvLoadUnaligned(&P[0].v.x), ExvLoadSmearScalar(&c));
+			r = ExvMadd(ExvLoadUnaligned(&P[1].v.x), ExvLoadSmearScalar(&s), r);
+			r = ExvMadd(ExvLoadUnaligned(&P[2].v.x), ExvLoadSmearScalar(&tc), r);
+			ExvStoreUnaligned(ExvMadd(ExvLoadUnaligned(&P[3].v.x), ExvLoadSmearScalar(&ts), r), &result->v.x);
+
+		#elif !defined(TERATHON_NO_SIMD)
+
+			vec_float vc = VecLoadSmearScalar(&c);
+			vec_float vs = VecLoadSmearScalar(&s);
+			vec_float vtc = VecLoadSmearScalar(&tc);
+			vec_float vts = VecLoadSmearScalar(&ts);
+
+			vec_float v = VecMadd(VecLoadUnaligned(&P[1].v.x), vs, VecLoadUnaligned(&P[0].v.x) * vc);
+			vec_float m = VecMadd(VecLoadUnaligned(&P[1].m.x), vs, VecLoadUnaligned(&P[0].m.x) * vc);
+			v = VecMadd(VecLoadUnaligned(&P[2].v.x), vtc, v);
+			m = VecMadd(VecLoadUnaligned(&P[2].m.x), vtc, m);
+			VecStoreUnaligned(VecMadd(VecLoadUnaligned(&P[3].v.x), vts, v), &result->v.x);
+			VecStoreUnaligned(VecMadd(VecLoadUnaligned(&P[3].m.x), vts, m), &result->m.x);
+
+		#else
+
+			result->v = P[0].v * c + P[1].v * s + P[2].v * tc + P[3].v * ts;
+			result->m = P[0].m * c + P[1].m * s + P[2].m * tc + P[3].m * ts;
+
+		#endif
+	}
+}
+
+
 Vector3D Motor3D::GetDirectionX(void) const
 {
 	float A00 = 1.0F - (v.y * v.y + v.z * v.z) * 2.0F;
@@ -168,38 +247,116 @@ Motor3D& Motor3D::SetTransformMatrix(const Transform3D& M)
 
 Motor3D Terathon::operator *(const Motor3D& a, const Motor3D& b)
 {
-	return (Motor3D(a.v.w * b.v.x + a.v.x * b.v.w + a.v.y * b.v.z - a.v.z * b.v.y,
-	                a.v.w * b.v.y + a.v.y * b.v.w + a.v.z * b.v.x - a.v.x * b.v.z,
-	                a.v.w * b.v.z + a.v.z * b.v.w + a.v.x * b.v.y - a.v.y * b.v.x,
-	                a.v.w * b.v.w - a.v.x * b.v.x - a.v.y * b.v.y - a.v.z * b.v.z,
-	                a.m.w * b.v.x + a.m.x * b.v.w + a.m.y * b.v.z - a.m.z * b.v.y + b.m.w * a.v.x + b.m.x * a.v.w - b.m.y * a.v.z + b.m.z * a.v.y,
-	                a.m.w * b.v.y - a.m.x * b.v.z + a.m.y * b.v.w + a.m.z * b.v.x + b.m.w * a.v.y + b.m.x * a.v.z + b.m.y * a.v.w - b.m.z * a.v.x,
-	                a.m.w * b.v.z + a.m.x * b.v.y - a.m.y * b.v.x + a.m.z * b.v.w + b.m.w * a.v.z - b.m.x * a.v.y + b.m.y * a.v.x + b.m.z * a.v.w,
-	                a.m.w * b.v.w - a.m.x * b.v.x - a.m.y * b.v.y - a.m.z * b.v.z + b.m.w * a.v.w - b.m.x * a.v.x - b.m.y * a.v.y - b.m.z * a.v.z));
+	#ifndef TERATHON_NO_SIMD
+
+		Motor3D		result;
+
+		#if defined(TERATHON_AVX)
+
+			// The weight of the product is a.v * b.v, and the bulk is a.m * b.v + a.v * b.m.
+
+			exv_float qa = ExvLoadUnaligned(&a.v.x);
+			exv_float qb = ExvLoadUnaligned(&b.v.x);
+
+			exv_float r = ExvQuaternionProduct(qa, ExvSmearVecLo(qb));
+			exv_float t = ExvQuaternionProduct(ExvSmearVecLo(qa), qb);
+
+			ExvStoreUnaligned(ExvAdd(r, ExvZeroVecLo(t)), &result.v.x);
+
+		#else
+
+			vec_float av = VecLoadUnaligned(&a.v.x);
+			vec_float am = VecLoadUnaligned(&a.m.x);
+			vec_float bv = VecLoadUnaligned(&b.v.x);
+			vec_float bm = VecLoadUnaligned(&b.m.x);
+
+			VecStoreUnaligned(VecQuaternionProduct(av, bv), &result.v.x);
+			VecStoreUnaligned(VecAdd(VecQuaternionProduct(am, bv), VecQuaternionProduct(av, bm)), &result.m.x);
+
+		#endif
+
+		return (result);
+
+	#else
+
+		return (Motor3D(a.v.w * b.v.x + a.v.x * b.v.w + a.v.y * b.v.z - a.v.z * b.v.y,
+		                a.v.w * b.v.y + a.v.y * b.v.w + a.v.z * b.v.x - a.v.x * b.v.z,
+		                a.v.w * b.v.z + a.v.z * b.v.w + a.v.x * b.v.y - a.v.y * b.v.x,
+		                a.v.w * b.v.w - a.v.x * b.v.x - a.v.y * b.v.y - a.v.z * b.v.z,
+		                a.m.w * b.v.x + a.m.x * b.v.w + a.m.y * b.v.z - a.m.z * b.v.y + b.m.w * a.v.x + b.m.x * a.v.w - b.m.y * a.v.z + b.m.z * a.v.y,
+		                a.m.w * b.v.y - a.m.x * b.v.z + a.m.y * b.v.w + a.m.z * b.v.x + b.m.w * a.v.y + b.m.x * a.v.z + b.m.y * a.v.w - b.m.z * a.v.x,
+		                a.m.w * b.v.z + a.m.x * b.v.y - a.m.y * b.v.x + a.m.z * b.v.w + b.m.w * a.v.z - b.m.x * a.v.y + b.m.y * a.v.x + b.m.z * a.v.w,
+		                a.m.w * b.v.w - a.m.x * b.v.x - a.m.y * b.v.y - a.m.z * b.v.z + b.m.w * a.v.w - b.m.x * a.v.x - b.m.y * a.v.y - b.m.z * a.v.z));
+
+	#endif
 }
 
 Motor3D Terathon::operator *(const Motor3D& Q, const Quaternion& r)
 {
-	return (Motor3D(Q.v.w * r.x + Q.v.x * r.w + Q.v.y * r.z - Q.v.z * r.y,
-	                Q.v.w * r.y - Q.v.x * r.z + Q.v.y * r.w + Q.v.z * r.x,
-	                Q.v.w * r.z + Q.v.x * r.y - Q.v.y * r.x + Q.v.z * r.w,
-	                Q.v.w * r.w - Q.v.x * r.x - Q.v.y * r.y - Q.v.z * r.z,
-	                Q.m.w * r.x + Q.m.x * r.w + Q.m.y * r.z - Q.m.z * r.y,
-	                Q.m.w * r.y - Q.m.x * r.z + Q.m.y * r.w + Q.m.z * r.x,
-	                Q.m.w * r.z + Q.m.x * r.y - Q.m.y * r.x + Q.m.z * r.w,
-	                Q.m.w * r.w - Q.m.x * r.x - Q.m.y * r.y - Q.m.z * r.z));
+	#ifndef TERATHON_NO_SIMD
+
+		Motor3D		result;
+
+		#if defined(TERATHON_AVX)
+
+			ExvStoreUnaligned(ExvQuaternionProduct(ExvLoadUnaligned(&Q.v.x), ExvLoadSmearVec(&r.x)), &result.v.x);
+
+		#else
+
+			vec_float q = VecLoadUnaligned(&r.x);
+			VecStoreUnaligned(VecQuaternionProduct(VecLoadUnaligned(&Q.v.x), q), &result.v.x);
+			VecStoreUnaligned(VecQuaternionProduct(VecLoadUnaligned(&Q.m.x), q), &result.m.x);
+
+		#endif
+
+		return (result);
+
+	#else
+
+		return (Motor3D(Q.v.w * r.x + Q.v.x * r.w + Q.v.y * r.z - Q.v.z * r.y,
+		                Q.v.w * r.y - Q.v.x * r.z + Q.v.y * r.w + Q.v.z * r.x,
+		                Q.v.w * r.z + Q.v.x * r.y - Q.v.y * r.x + Q.v.z * r.w,
+		                Q.v.w * r.w - Q.v.x * r.x - Q.v.y * r.y - Q.v.z * r.z,
+		                Q.m.w * r.x + Q.m.x * r.w + Q.m.y * r.z - Q.m.z * r.y,
+		                Q.m.w * r.y - Q.m.x * r.z + Q.m.y * r.w + Q.m.z * r.x,
+		                Q.m.w * r.z + Q.m.x * r.y - Q.m.y * r.x + Q.m.z * r.w,
+		                Q.m.w * r.w - Q.m.x * r.x - Q.m.y * r.y - Q.m.z * r.z));
+
+	#endif
 }
 
 Motor3D Terathon::operator *(const Quaternion& r, const Motor3D& Q)
 {
-	return (Motor3D(r.w * Q.v.x + r.x * Q.v.w + r.y * Q.v.z - r.z * Q.v.y,
-	                r.w * Q.v.y - r.x * Q.v.z + r.y * Q.v.w + r.z * Q.v.x,
-	                r.w * Q.v.z + r.x * Q.v.y - r.y * Q.v.x + r.z * Q.v.w,
-	                r.w * Q.v.w - r.x * Q.v.x - r.y * Q.v.y - r.z * Q.v.z,
-	                r.w * Q.m.x + r.x * Q.m.w + r.y * Q.m.z - r.z * Q.m.y,
-	                r.w * Q.m.y - r.x * Q.m.z + r.y * Q.m.w + r.z * Q.m.x,
-	                r.w * Q.m.z + r.x * Q.m.y - r.y * Q.m.x + r.z * Q.m.w,
-	                r.w * Q.m.w - r.x * Q.m.x - r.y * Q.m.y - r.z * Q.m.z));
+	#ifndef TERATHON_NO_SIMD
+
+		Motor3D		result;
+
+		#if defined(TERATHON_AVX)
+
+			ExvStoreUnaligned(ExvQuaternionProduct(ExvLoadSmearVec(&r.x), ExvLoadUnaligned(&Q.v.x)), &result.v.x);
+
+		#else
+
+			vec_float q = VecLoadUnaligned(&r.x);
+			VecStoreUnaligned(VecQuaternionProduct(q, VecLoadUnaligned(&Q.v.x)), &result.v.x);
+			VecStoreUnaligned(VecQuaternionProduct(q, VecLoadUnaligned(&Q.m.x)), &result.m.x);
+
+		#endif
+
+		return (result);
+
+	#else
+
+		return (Motor3D(r.w * Q.v.x + r.x * Q.v.w + r.y * Q.v.z - r.z * Q.v.y,
+		                r.w * Q.v.y - r.x * Q.v.z + r.y * Q.v.w + r.z * Q.v.x,
+		                r.w * Q.v.z + r.x * Q.v.y - r.y * Q.v.x + r.z * Q.v.w,
+		                r.w * Q.v.w - r.x * Q.v.x - r.y * Q.v.y - r.z * Q.v.z,
+		                r.w * Q.m.x + r.x * Q.m.w + r.y * Q.m.z - r.z * Q.m.y,
+		                r.w * Q.m.y - r.x * Q.m.z + r.y * Q.m.w + r.z * Q.m.x,
+		                r.w * Q.m.z + r.x * Q.m.y - r.y * Q.m.x + r.z * Q.m.w,
+		                r.w * Q.m.w - r.x * Q.m.x - r.y * Q.m.y - r.z * Q.m.z));
+
+	#endif
 }
 
 Motor3D Terathon::Sqrt(const Motor3D& Q)
@@ -210,6 +367,64 @@ Motor3D Terathon::Sqrt(const Motor3D& Q)
 	return (Motor3D(Q.v.x * b, Q.v.y * b, Q.v.z * b, Q.v.w * b + b, (Q.v.x * a + Q.m.x) * b, (Q.v.y * a + Q.m.y) * b, (Q.v.z * a + Q.m.z) * b, Q.m.w * (b * 0.5F)));
 }
 
+Line3D Terathon::Log(const Motor3D& Q)
+{
+	// With s = sin(a) and c = cos(a) for the half angle a, the weight is s times the axis direction, and
+	// the bulk is combined from the moment and the displacement as in MakeScrew(). The factor k = a / s
+	// scales both, and the displacement along the axis is recovered from the scalar coordinate. The term
+	// (kc - 1) / s^2 stays bounded as s goes to zero, where it approaches -1/3.
+
+	float f = (Q.v.w < 0.0F) ? -1.0F : 1.0F;
+	float vx = Q.v.x * f;
+	float vy = Q.v.y * f;
+	float vz = Q.v.z * f;
+	float c = Q.v.w * f;
+	float w = Q.m.w * f;
+
+	float s2 = vx * vx + vy * vy + vz * vz;
+	if (s2 > 1.0e-12F)
+	{
+		float r = InverseSqrt(s2);
+		float k = Arctan(s2 * r, c) * r;
+		float h = w * (k * c - 1.0F) * (r * r);
+		float g = k * f;
+
+		return (Line3D(vx * k, vy * k, vz * k, Q.m.x * g + vx * h, Q.m.y * g + vy * h, Q.m.z * g + vz * h));
+	}
+
+	float h = w * -0.33333333F;
+	return (Line3D(vx, vy, vz, Q.m.x * f + vx * h, Q.m.y * f + vy * h, Q.m.z * f + vz * h));
+}
+
+Motor3D Terathon::Exp(const Line3D& B)
+{
+	// This inverts Log(). The factor k = sin(a) / a scales the line, and the term (c - k) / a^2 that
+	// couples the direction into the moment stays bounded as a goes to zero, where it approaches -1/3.
+
+	float u = B.v.x * B.m.x + B.v.y * B.m.y + B.v.z * B.m.z;
+	float a2 = B.v.x * B.v.x + B.v.y * B.v.y + B.v.z * B.v.z;
+
+	if (a2 > 1.0e-12F)
+	{
+		float	c, s;
+
+		float r = InverseSqrt(a2);
+		CosSin(a2 * r, &c, &s);
+
+		float k = s * r;
+		float h = u * (c - k) * (r * r);
+		return (Motor3D(B.v.x * k, B.v.y * k, B.v.z * k, c, B.m.x * k + B.v.x * h, B.m.y * k + B.v.y * h, B.m.z * k + B.v.z * h, -u * k));
+	}
+
+	float h = u * -0.33333333F;
+	return (Motor3D(B.v.x, B.v.y, B.v.z, 1.0F, B.m.x + B.v.x * h, B.m.y + B.v.y * h, B.m.z + B.v.z * h, -u));
+}
+
+Motor3D Terathon::Sclerp(const Motor3D& Q0, const Motor3D& Q1, float t)
+{
+	return (Q0 * Exp(Log(~Q0 * Q1) * t));
+}
+
 FlatPoint3D Terathon::Transform(const FlatPoint3D& p, const Motor3D& Q)
 {
 	#ifdef TERATHON_SSE
@@ -268,23 +483,501 @@ Line3D Terathon::Transform(const Line3D& l, const Motor3D& Q)
 {
 	Line3D		result;
 
-	Bivector3D a = !Q.v.xyz ^ l.v;
-	result.v = l.v + ((Q.v.xyz ^ a) + !a * Q.v.w) * 2.0F;
+	#ifndef TERATHON_NO_SIMD
+
+		vec_float	rv, rm;
+
+		VecTransformLine(VecLoadUnaligned(&Q.v.x), VecLoadUnaligned(&Q.m.x), VecLoad3D(&l.v.x), VecLoad3D(&l.m.x), &rv, &rm);
+		VecStore3D(rv, &result.v.x);
+		VecStore3D(rm, &result.m.x);
+
+	#else
+
+		Bivector3D a = !Q.v.xyz ^ l.v;
+		result.v = l.v + ((Q.v.xyz ^ a) + !a * Q.v.w) * 2.0F;
+
+		Vector3D b = Q.v.xyz ^ l.m;
+		Vector3D c = Q.m.xyz ^ !l.v;
+		Vector3D d = b + c;
+		result.m = l.m + (a * Q.m.w + !d * Q.v.w + (!Q.v.xyz ^ d) + !(Q.m.xyz ^ a)) * 2.0F;
 
-	Vector3D b = Q.v.xyz ^ l.m;
-	Vector3D c = Q.m.xyz ^ !l.v;
-	Vector3D d = b + c;
-	result.m = l.m + (a * Q.m.w + !d * Q.v.w + (!Q.v.xyz ^ d) + !(Q.m.xyz ^ a)) * 2.0F;
+	#endif
 
 	return (result);
 }
 
 Plane3D Terathon::Transform(const Plane3D& g, const Motor3D& Q)
 {
-	Vector3D b = (Q.m.xyz ^ g.xyz) + !g.xyz * Q.m.w;
-	float bv = b.x * Q.v.x + b.y * Q.v.y + b.z * Q.v.z;
-	float mg = Q.m.x * g.x + Q.m.y * g.y + Q.m.z * g.z;
+	#ifndef TERATHON_NO_SIMD
+
+		Plane3D		result;
+		vec_float	rw;
+
+		VecStore3D(VecTransformPlane(VecLoadUnaligned(&Q.v.x), VecLoadUnaligned(&Q.m.x), VecLoadUnaligned(&g.x), &rw), &result.x);
+		VecStoreX(rw, &result.w);
+		return (result);
+
+	#else
+
+		Vector3D b = (Q.m.xyz ^ g.xyz) + !g.xyz * Q.m.w;
+		float bv = b.x * Q.v.x + b.y * Q.v.y + b.z * Q.v.z;
+		float mg = Q.m.x * g.x + Q.m.y * g.y + Q.m.z * g.z;
+
+		Vector3D a = (Q.v.xyz ^ g.xyz) * 2.0F;
+		return (Plane3D(g.xyz + ((!Q.v.xyz ^ a) + !a * Q.v.w), g.w + (bv - mg * Q.v.w) * 2.0F));
+
+	#endif
+}
+
+void Terathon::TransformPoints(const Motor3D& Q, const Point3D *in, Point3D *out, machine count)
+{
+	// The sandwich product is an affine function of the point, so the motor is converted to the
+	// equivalent matrix once, and the batch kernels for Transform3D do the per-point work.
+
+	TransformPoints(Q.GetTransformMatrix(), in, out, count);
+}
+
+void Terathon::TransformPoints(const Motor3D& Q, const FlatPoint3D *in, FlatPoint3D *out, machine count)
+{
+	TransformPoints(Q.GetTransformMatrix(), in, out, count);
+}
+
+void Terathon::TransformVectors(const Motor3D& Q, const Vector3D *in, Vector3D *out, machine count)
+{
+	TransformVectors(Q.GetTransformMatrix(), in, out, count);
+}
+
+void Terathon::TransformLines(const Motor3D& Q, const Line3D *in, Line3D *out, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->TransformLinesMotor3D(&Q, in, out, count);
+			return;
+		}
+
+	#endif
+
+	#ifndef TERATHON_NO_SIMD
+
+		vec_float v = VecLoadUnaligned(&Q.v.x);
+		vec_float m = VecLoadUnaligned(&Q.m.x);
+
+		for (machine k = 0; k < count; k++)
+		{
+			vec_float	rv, rm;
+
+			VecTransformLine(v, m, VecLoad3D(&in[k].v.x), VecLoad3D(&in[k].m.x), &rv, &rm);
+			VecStore3D(rv, &out[k].v.x);
+			VecStore3D(rm, &out[k].m.x);
+		}
+
+	#else
+
+		for (machine k = 0; k < count; k++)
+		{
+			out[k] = Transform(in[k], Q);
+		}
+
+	#endif
+}
+
+void Terathon::TransformPlanes(const Motor3D& Q, const Plane3D *in, Plane3D *out, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->TransformPlanesMotor3D(&Q, in, out, count);
+			return;
+		}
+
+	#endif
+
+	#ifndef TERATHON_NO_SIMD
+
+		vec_float v = VecLoadUnaligned(&Q.v.x);
+		vec_float m = VecLoadUnaligned(&Q.m.x);
+
+		for (machine k = 0; k < count; k++)
+		{
+			vec_float	rw;
+
+			vec_float g = VecTransformPlane(v, m, VecLoadUnaligned(&in[k].x), &rw);
+			VecStore3D(g, &out[k].x);
+			VecStoreX(rw, &out[k].w);
+		}
+
+	#else
+
+		for (machine k = 0; k < count; k++)
+		{
+			out[k] = Transform(in[k], Q);
+		}
+
+	#endif
+}
+
+void Terathon::StoreTransformMatrices(const Motor3D *motor, float *matrix, machine count, uint32 flags)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->StoreTransformMatricesMotor3D(motor, matrix, count, flags);
+			return;
+		}
+
+	#endif
+
+	machine size = (flags & kMatrixStore3x4) ? 12 : 16;
+
+	#ifndef TERATHON_NO_SIMD
+
+		const vec_float one = VecLoadVectorConstant<0x3F800000>();
+		const vec_float two = VecLoadVectorConstant<0x40000000>();
+
+		for (machine k = 0; k < count; k += 4)
+		{
+			vec_float	v[4], m[4];
+			vec_float	entry[3][4];
+
+			machine n = (count - k < 4) ? count - k : 4;
+			const Motor3D *Q = motor + k;
+
+			for (machine a = 0; a < 4; a++)
+			{
+				const Motor3D& q = Q[(a < n) ? a : n - 1];
+				v[a] = VecLoadUnaligned(&q.v.x);
+				m[a] = VecLoadUnaligned(&q.m.x);
+			}
+
+			VecTranspose4D(v[0], v[1], v[2], v[3], &v[0], &v[1], &v[2], &v[3]);
+			VecTranspose4D(m[0], m[1], m[2], m[3], &m[0], &m[1], &m[2], &m[3]);
+
+			vec_float vx2 = v[0] * v[0];
+			vec_float vy2 = v[1] * v[1];
+			vec_float vz2 = v[2] * v[2];
+
+			vec_float A01 = v[0] * v[1];
+			vec_float A02 = v[2] * v[0];
+			vec_float A12 = v[1] * v[2];
+			vec_float A03 = v[1] * m[2] - v[2] * m[1];
+			vec_float A13 = v[2] * m[0] - v[0] * m[2];
+			vec_float A23 = v[0] * m[1] - v[1] * m[0];
+
+			vec_float B01 = v[2] * v[3];
+			vec_float B20 = v[1] * v[3];
+			vec_float B12 = v[0] * v[3];
+			vec_float B03 = m[0] * v[3] - v[0] * m[3];
+			vec_float B13 = m[1] * v[3] - v[1] * m[3];
+			vec_float B23 = m[2] * v[3] - v[2] * m[3];
+
+			entry[0][0] = one - (vy2 + vz2) * two;
+			entry[0][1] = (A01 - B01) * two;
+			entry[0][2] = (A02 + B20) * two;
+			entry[0][3] = (A03 + B03) * two;
+			entry[1][0] = (A01 + B01) * two;
+			entry[1][1] = one - (vz2 + vx2) * two;
+			entry[1][2] = (A12 - B12) * two;
+			entry[1][3] = (A13 + B13) * two;
+			entry[2][0] = (A02 - B20) * two;
+			entry[2][1] = (A12 + B12) * two;
+			entry[2][2] = one - (vx2 + vy2) * two;
+			entry[2][3] = (A23 + B23) * two;
+
+			StoreTransformMatrices(entry, matrix + k * size, n, flags);
+		}
+
+	#else
+
+		for (machine k = 0; k < count; k++)
+		{
+			Transform3D M = motor[k].GetTransformMatrix();
+			StoreTransformMatrices(&M, matrix + k * size, 1, flags);
+		}
+
+	#endif
+}
+
+void Terathon::SetTransformMatrices(const Transform3D *matrix, Motor3D *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->SetTransformMatricesMotor3D(matrix, result, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#ifndef TERATHON_NO_SIMD
+
+		const vec_float half = VecLoadVectorConstant<0x3F000000>();
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	entry[4][4], v[4], m[4];
+
+			const Transform3D *M = matrix + i;
+			for (machine j = 0; j < 4; j++)
+			{
+				VecTranspose4D(VecLoad(&M[0](0,j)), VecLoad(&M[1](0,j)), VecLoad(&M[2](0,j)), VecLoad(&M[3](0,j)), &entry[0][j], &entry[1][j], &entry[2][j], &entry[3][j]);
+			}
+
+			VecSetRotationMatrix(entry, v);
+
+			vec_float tx = entry[0][3] * half;
+			vec_float ty = entry[1][3] * half;
+			vec_float tz = entry[2][3] * half;
+
+			m[0] = v[3] * tx + v[2] * ty - v[1] * tz;
+			m[1] = v[3] * ty + v[0] * tz - v[2] * tx;
+			m[2] = v[3] * tz + v[1] * tx - v[0] * ty;
+			m[3] = VecNegate(v[0] * tx + v[1] * ty + v[2] * tz);
+
+			VecTranspose4D(v[0], v[1], v[2], v[3], &v[0], &v[1], &v[2], &v[3]);
+			VecTranspose4D(m[0], m[1], m[2], m[3], &m[0], &m[1], &m[2], &m[3]);
+
+			Motor3D *Q = result + i;
+			for (machine a = 0; a < 4; a++)
+			{
+				VecStoreUnaligned(v[a], &Q[a].v.x);
+				VecStoreUnaligned(m[a], &Q[a].m.x);
+			}
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		result[i].SetTransformMatrix(matrix[i]);
+	}
+}
+
+void Terathon::DecomposeTransform(const Transform3D& m, Motor3D *motor, Vector3D *scale, Vector3D *shear)
+{
+	Vector3D	t;
+	Quaternion	v;
+
+	DecomposeTransform(m, &t, &v, scale, shear);
+
+	float tx = t.x * 0.5F;
+	float ty = t.y * 0.5F;
+	float tz = t.z * 0.5F;
+
+	motor->Set(v, Quaternion(v.w * tx + v.z * ty - v.y * tz, v.w * ty + v.x * tz - v.z * tx, v.w * tz + v.y * tx - v.x * ty, -v.x * tx - v.y * ty - v.z * tz));
+}
+
+Transform3D Terathon::ComposeTransform(const Motor3D& motor, const Vector3D& scale)
+{
+	return (ComposeTransform(Vector3D(motor.GetPosition()), motor.v, scale));
+}
+
+Transform3D Terathon::ComposeTransform(const Motor3D& motor, const Vector3D& scale, const Vector3D& shear)
+{
+	return (ComposeTransform(Vector3D(motor.GetPosition()), motor.v, scale, shear));
+}
+
+void Terathon::PropagateMotors(const Motor3D *localMotor, const int32 *parentIndex, Motor3D *worldMotor, Transform3D *worldTransform, machine count, machine start)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->PropagateMotors(localMotor, parentIndex, worldMotor, worldTransform, count, start);
+			return;
+		}
+
+	#endif
+
+	machine index = start;
+	machine end = start + count;
+
+	#if defined(TERATHON_AVX)
+
+		while (index + 1 < end)
+		{
+			int32 parent1 = parentIndex[index];
+			int32 parent2 = parentIndex[index + 1];
+
+			if ((parent1 >= 0) && (parent2 >= 0) && (parent2 != int32(index)))
+			{
+				// The two nodes are independent, so their products are calculated together with
+				// one node in each half of the registers. See operator *(const Motor3D&, const Motor3D&).
+
+				const Motor3D& a1 = worldMotor[parent1];
+				const Motor3D& a2 = worldMotor[parent2];
+				const Motor3D& b1 = localMotor[index];
+				const Motor3D& b2 = localMotor[index + 1];
+
+				exv_float av = ExvFloat(VecLoadUnaligned(&a1.v.x), VecLoadUnaligned(&a2.v.x));
+				exv_float am = ExvFloat(VecLoadUnaligned(&a1.m.x), VecLoadUnaligned(&a2.m.x));
+				exv_float bv = ExvFloat(VecLoadUnaligned(&b1.v.x), VecLoadUnaligned(&b2.v.x));
+				exv_float bm = ExvFloat(VecLoadUnaligned(&b1.m.x), VecLoadUnaligned(&b2.m.x));
+
+				exv_float v = ExvQuaternionProduct(av, bv);
+				exv_float m = ExvAdd(ExvQuaternionProduct(am, bv), ExvQuaternionProduct(av, bm));
+
+				Motor3D& c1 = worldMotor[index];
+				Motor3D& c2 = worldMotor[index + 1];
+
+				VecStoreUnaligned(ExvGetVecLo(v), &c1.v.x);
+				VecStoreUnaligned(ExvGetVecLo(m), &c1.m.x);
+				VecStoreUnaligned(ExvGetVecHi(v), &c2.v.x);
+				VecStoreUnaligned(ExvGetVecHi(m), &c2.m.x);
+				index += 2;
+			}
+			else
+			{
+				worldMotor[index] = (parent1 >= 0) ? worldMotor[parent1] * localMotor[index] : localMotor[index];
+				index++;
+			}
+		}
+
+	#endif
+
+	for (; index < end; index++)
+	{
+		int32 parent = parentIndex[index];
+		worldMotor[index] = (parent >= 0) ? worldMotor[parent] * localMotor[index] : localMotor[index];
+	}
+
+	if (worldTransform)
+	{
+		for (index = start; index < end; index++)
+		{
+			worldTransform[index] = worldMotor[index].GetTransformMatrix();
+		}
+	}
+}
+
+
+void MotorInterpolator::Set(const Motor3D& Q0, const Motor3D& Q1)
+{
+	// The relative motor is exp(B) for the line B = Log(~Q0 * Q1), and evaluating the interpolator at t
+	// calculates Q0 * exp(tB). Writing exp(tB) in terms of the unitized screw axis with direction u and
+	// moment w, the half angle a, and the half displacement h gives
+	//
+	//    exp(tB) = cos(ta) 1 + sin(ta) (u + w) + t cos(ta) h u - t sin(ta) h,
+	//
+	// where the first term is the antiscalar, the products with u in the third term are bulk, and the
+	// last term is scalar. Premultiplying each of the four motors by Q0 produces the coefficients.
+
+	Line3D B = Log(~Q0 * Q1);
+
+	float a2 = B.v.x * B.v.x + B.v.y * B.v.y + B.v.z * B.v.z;
+	if (a2 > 1.0e-12F)
+	{
+		float r = InverseSqrt(a2);
+		Vector3D u = B.v * r;
+		float h = u.x * B.m.x + u.y * B.m.y + u.z * B.m.z;
+
+		halfAngle = a2 * r;
+		halfDisplacement = h;
+		screwAxis.Set(u.x, u.y, u.z, (B.m.x - u.x * h) * r, (B.m.y - u.y * h) * r, (B.m.z - u.z * h) * r);
+	}
+	else
+	{
+		float h2 = B.m.x * B.m.x + B.m.y * B.m.y + B.m.z * B.m.z;
+		float r = (h2 > 1.0e-24F) ? InverseSqrt(h2) : 0.0F;
+
+		halfAngle = 0.0F;
+		halfDisplacement = h2 * r;
+		screwAxis.Set(B.m.x * r, B.m.y * r, B.m.z * r, 0.0F, 0.0F, 0.0F);
+	}
+
+	const Vector3D& u = screwAxis.v;
+	const Bivector3D& w = screwAxis.m;
+	float h = halfDisplacement;
+
+	coefficient[0] = Q0;
+	coefficient[1] = Q0 * Motor3D(u.x, u.y, u.z, 0.0F, w.x, w.y, w.z, 0.0F);
+	coefficient[2] = Q0 * Motor3D(0.0F, 0.0F, 0.0F, 0.0F, u.x * h, u.y * h, u.z * h, 0.0F);
+	coefficient[3] = Q0 * Motor3D(0.0F, 0.0F, 0.0F, 0.0F, 0.0F, 0.0F, 0.0F, -h);
+}
+
+Motor3D MotorInterpolator::Evaluate(float t) const
+{
+	Motor3D		result;
+	float		c, s;
+
+	CosSin(t * halfAngle, &c, &s);
+	CombineMotors(coefficient, c, s, t, &result);
+	return (result);
+}
+
+void MotorInterpolator::Evaluate(const float *t, Motor3D *result, machine count) const
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->EvaluateMotorInterpolator(this, t, result, count);
+			return;
+		}
+
+	#endif
+
+	alignas(32) float	x[64], c[64], s[64];
+
+	for (machine k = 0; k < count; k += 64)
+	{
+		machine n = (count - k < 64) ? count - k : 64;
+
+		for (machine a = 0; a < n; a++)
+		{
+			x[a] = t[k + a] * halfAngle;
+		}
+
+		CosSin(x, c, s, n);
+
+		for (machine a = 0; a < n; a++)
+		{
+			CombineMotors(coefficient, c[a], s[a], t[k + a], &result[k + a]);
+		}
+	}
+}
+
+void Terathon::EvaluateMotorInterpolators(const MotorInterpolator *interpolator, const float *t, Motor3D *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->EvaluateMotorInterpolators(interpolator, t, result, count);
+			return;
+		}
+
+	#endif
+
+	alignas(32) float	x[64], c[64], s[64];
+
+	for (machine k = 0; k < count; k += 64)
+	{
+		machine n = (count - k < 64) ? count - k : 64;
+
+		for (machine a = 0; a < n; a++)
+		{
+			x[a] = t[k + a] * interpolator[k + a].halfAngle;
+		}
+
+		CosSin(x, c, s, n);
 
-	Vector3D a = (Q.v.xyz ^ g.xyz) * 2.0F;
-	return (Plane3D(g.xyz + ((!Q.v.xyz ^ a) + !a * Q.v.w), g.w + (bv - mg * Q.v.w) * 2.0F));
+		for (machine a = 0; a < n; a++)
+		{
+			CombineMotors(interpolator[k + a].coefficient, c[a], s[a], t[k + a], &result[k + a]);
+		}
+	}
 }
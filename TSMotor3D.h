@@ -389,6 +389,49 @@ namespace Terathon
 
 	TERATHON_API Motor3D Sqrt(const Motor3D& Q);
 
+	// ==============================================
+	//	Logarithm and exponential
+	// ==============================================
+
+	/// \brief Returns the logarithm of a unitized 3D motor.
+	///
+	/// The $Log()$ function returns the line <i>B</i> for which Exp(<i>B</i>) is the motor $Q$. For a screw motion through the
+	/// angle &phi; about the unitized line <i>L</i> with displacement <i>d</i> along that line, as constructed by the
+	/// Motor3D::MakeScrew() function, the logarithm is (&phi;&#x202F;/&#x202F;2)<i>L</i> with (<i>d</i>&#x202F;/&#x202F;2)<i>L<sub>v</sub></i>
+	/// added to its moment. For a pure translation by the offset <i>t</i>, the direction of the logarithm is zero and its moment
+	/// is <i>t</i>&#x202F;/&#x202F;2.
+	///
+	/// Because <i>Q</i> and &minus;<i>Q</i> represent the same motion, the logarithm is calculated for whichever of the two
+	/// has a nonnegative antiscalar coordinate, so the angle of rotation that it represents is never greater than &pi;.
+	///
+	/// The motor $Q$ must be unitized and satisfy the geometric constraint.
+	/// \related Motor3D
+	/// \also Exp(const Line3D&)
+
+	TERATHON_API Line3D Log(const Motor3D& Q);
+
+	/// \brief Returns the exponential of a 3D line, which is a unitized motor.
+	///
+	/// The $Exp()$ function is the inverse of the Log(const Motor3D&) function. The line $B$ does not need to be unitized,
+	/// and the magnitude of its direction is half the angle of rotation.
+	/// \related Motor3D
+	/// \also Log(const Motor3D&)
+
+	TERATHON_API Motor3D Exp(const Line3D& B);
+
+	/// \brief Interpolates between two unitized 3D motors along a screw path.
+	/// \param Q0		The motor returned when $t$ is 0.
+	/// \param Q1		The motor returned when $t$ is 1.
+	/// \param t		The interpolation parameter.
+	///
+	/// The $Sclerp()$ function performs screw linear interpolation, which rotates about and translates along the single
+	/// screw axis that carries $Q0$ to $Q1$ at constant angular and linear speed. The path always takes the shorter way around.
+	/// When many values of $t$ are evaluated for the same pair of motors, the $MotorInterpolator$ class is much faster.
+	/// \related Motor3D
+	/// \also MotorInterpolator
+
+	TERATHON_API Motor3D Sclerp(const Motor3D& Q0, const Motor3D& Q1, float t);
+
 	// ==============================================
 	//	Transformations
 	// ==============================================
@@ -429,6 +472,98 @@ namespace Terathon
 
 	TERATHON_API Plane3D Transform(const Plane3D& g, const Motor3D& Q);
 
+	/// \brief Transforms the $count$ Euclidean points in the array $in$ with the motor $Q$ and stores the results in the array $out$.
+	/// The motor is converted to a matrix once, and the points are then transformed in groups by the SIMD batch kernels.
+	/// The $in$ and $out$ arrays may be the same, but they must not otherwise overlap.
+	/// \related Motor3D
+
+	TERATHON_API void TransformPoints(const Motor3D& Q, const Point3D *in, Point3D *out, machine count);
+
+	/// \brief Transforms the $count$ flat points in the array $in$ with the motor $Q$ and stores the results in the array $out$.
+	/// The $in$ and $out$ arrays may be the same, but they must not otherwise overlap.
+	/// \related Motor3D
+
+	TERATHON_API void TransformPoints(const Motor3D& Q, const FlatPoint3D *in, FlatPoint3D *out, machine count);
+
+	/// \brief Transforms the $count$ vectors in the array $in$ with the motor $Q$ and stores the results in the array $out$.
+	/// The $in$ and $out$ arrays may be the same, but they must not otherwise overlap.
+	/// \related Motor3D
+
+	TERATHON_API void TransformVectors(const Motor3D& Q, const Vector3D *in, Vector3D *out, machine count);
+
+	/// \brief Transforms the $count$ lines in the array $in$ with the motor $Q$ and stores the results in the array $out$.
+	/// Each result is identical to the one returned by the Transform() function for a single line unless the library is compiled
+	/// with FMA, in which case the compiler may fuse multiplies and adds differently in the two functions, and each component
+	/// then agrees to within a few roundings of the largest term in its sum.
+	/// The $in$ and $out$ arrays may be the same, but they must not otherwise overlap.
+	/// \related Motor3D
+
+	TERATHON_API void TransformLines(const Motor3D& Q, const Line3D *in, Line3D *out, machine count);
+
+	/// \brief Transforms the $count$ planes in the array $in$ with the motor $Q$ and stores the results in the array $out$.
+	/// Each result is identical to the one returned by the Transform() function for a single plane unless the library is compiled
+	/// with FMA, in which case the compiler may fuse multiplies and adds differently in the two functions, and each component
+	/// then agrees to within a few roundings of the largest term in its sum.
+	/// The $in$ and $out$ arrays may be the same, but they must not otherwise overlap.
+	/// \related Motor3D
+
+	TERATHON_API void TransformPlanes(const Motor3D& Q, const Plane3D *in, Plane3D *out, machine count);
+
+	/// \brief Calculates world-space motors for the nodes of a transform hierarchy.
+	/// \param localMotor		An array containing the motor for each node relative to its parent.
+	/// \param parentIndex		An array containing the index of the parent of each node, or a negative value for a root node.
+	/// \param worldMotor		An array that receives the world-space motor for each node.
+	/// \param worldTransform	An array that receives the transform matrix for each world-space motor. This can be $nullptr$.
+	/// \param count			The number of nodes to process.
+	/// \param start			The index of the first node to process.
+	///
+	/// The $PropagateMotors()$ function calculates the world-space motor of each node as the product of the world-space
+	/// motor of its parent and its local motor. The nodes must be topologically sorted so that every parent index is less
+	/// than the index of its child. With AVX, consecutive nodes that do not depend on each other, such as siblings,
+	/// are multiplied in pairs.
+	///
+	/// The nodes processed by a single call are those with indexes in the range [$start$,&#x202F;$start$&#x202F;+&#x202F;$count$).
+	/// The world-space motors of parents outside this range must already have been calculated. If the nodes are stored
+	/// in depth-first order, then each subtree occupies a contiguous range, and separate subtrees can be processed on
+	/// separate threads once the nodes above them have been processed.
+	///
+	/// \related Motor3D
+
+	TERATHON_API void PropagateMotors(const Motor3D *localMotor, const int32 *parentIndex, Motor3D *worldMotor, Transform3D *worldTransform, machine count, machine start = 0);
+
+	/// \brief Converts the $count$ motors in the array $motor$ to transform matrices and stores them in the float buffer $matrix$.
+	/// The layout of the matrices is specified by $flags$, which can be a combination (through logical OR) of the $kMatrixStore$ flags.
+	/// Each matrix is the same as the one returned by the Motor3D::GetTransformMatrix() function unless the library is compiled with FMA,
+	/// in which case the compiler may fuse multiplies and adds differently in the two functions, and each entry then agrees to within
+	/// a few roundings of the largest term in its sum. Four motors are converted at a time with the SIMD kernels.
+	/// \related Motor3D
+
+	TERATHON_API void StoreTransformMatrices(const Motor3D *motor, float *matrix, machine count, uint32 flags = 0);
+
+	/// \brief Converts the $count$ rigid transforms in the array $matrix$ to motors and stores them in the array $result$.
+	/// Each motor matches the one produced by the Motor3D::SetTransformMatrix() function to within the tolerance
+	/// documented for the SetRotationMatrices() function, scaled by the length of the translation for the bulk components,
+	/// and four matrices are converted at a time with the SIMD kernels.
+	/// \related Motor3D
+
+	TERATHON_API void SetTransformMatrices(const Transform3D *matrix, Motor3D *result, machine count);
+
+	/// \brief Decomposes the transform $m$ into a motor, a scale, and a shear, as described for the DecomposeTransform() function
+	/// that returns a quaternion. The motor performs the rotation followed by the translation. The $shear$ parameter can be $nullptr$.
+	/// \related Motor3D
+
+	TERATHON_API void DecomposeTransform(const Transform3D& m, Motor3D *motor, Vector3D *scale, Vector3D *shear = nullptr);
+
+	/// \brief Returns the transform that applies a scale followed by the unitized motor $motor$.
+	/// \related Motor3D
+
+	TERATHON_API Transform3D ComposeTransform(const Motor3D& motor, const Vector3D& scale);
+
+	/// \brief Returns the transform that applies a shear and a scale followed by the unitized motor $motor$.
+	/// \related Motor3D
+
+	TERATHON_API Transform3D ComposeTransform(const Motor3D& motor, const Vector3D& scale, const Vector3D& shear);
+
 	// ==============================================
 	//	Reverses
 	// ==============================================
@@ -486,6 +621,79 @@ namespace Terathon
 	}
 
 
+
+	// ==============================================
+	//	MotorInterpolator
+	// ==============================================
+
+	/// \brief Performs repeated screw linear interpolation between two 3D motors.
+	///
+	/// The $MotorInterpolator$ class caches the screw axis, angle, and displacement that carry one motor to another. The result
+	/// of the Sclerp() function is a linear combination of four motors whose weights are cos&#x202F;&theta;, sin&#x202F;&theta;,
+	/// <i>t</i>&#x202F;cos&#x202F;&theta;, and <i>t</i>&#x202F;sin&#x202F;&theta;, where &theta; is <i>t</i> times half the screw angle,
+	/// and those motors are precomputed so that each evaluation costs one call to CosSin() plus four multiply-adds per component.
+	///
+	/// \also Motor3D
+
+	class MotorInterpolator
+	{
+		public:
+
+			Motor3D			coefficient[4];			///< The motors weighted by cos&#x202F;&theta;, sin&#x202F;&theta;, <i>t</i>&#x202F;cos&#x202F;&theta;, and <i>t</i>&#x202F;sin&#x202F;&theta;.
+			Line3D			screwAxis;				///< The unitized screw axis. For a pure translation, the direction is the direction of translation and the moment is zero.
+			float			halfAngle;				///< Half the angle of rotation about the screw axis.
+			float			halfDisplacement;		///< Half the displacement along the screw axis.
+
+			/// \brief Default constructor that leaves the interpolator uninitialized.
+
+			inline MotorInterpolator() = default;
+
+			/// \brief Constructor that initializes the interpolator with two motors.
+			/// \param Q0		The motor returned when the interpolation parameter is 0.
+			/// \param Q1		The motor returned when the interpolation parameter is 1.
+
+			MotorInterpolator(const Motor3D& Q0, const Motor3D& Q1)
+			{
+				Set(Q0, Q1);
+			}
+
+			/// \brief Returns the total angle of rotation about the screw axis, in radians.
+
+			float GetScrewAngle(void) const
+			{
+				return (halfAngle * 2.0F);
+			}
+
+			/// \brief Returns the total displacement along the screw axis.
+
+			float GetScrewDisplacement(void) const
+			{
+				return (halfDisplacement * 2.0F);
+			}
+
+			/// \brief Initializes the interpolator with two unitized motors.
+			/// \param Q0		The motor returned when the interpolation parameter is 0.
+			/// \param Q1		The motor returned when the interpolation parameter is 1.
+
+			TERATHON_API void Set(const Motor3D& Q0, const Motor3D& Q1);
+
+			/// \brief Returns the interpolated motor for the parameter $t$.
+			///
+			/// The result is the same as the value returned by Sclerp(Q0, Q1, t) to within rounding error.
+
+			TERATHON_API Motor3D Evaluate(float t) const;
+
+			/// \brief Evaluates the interpolator for the $count$ parameters in the array $t$ and stores the results in the array $result$.
+
+			TERATHON_API void Evaluate(const float *t, Motor3D *result, machine count) const;
+	};
+
+	/// \brief Evaluates the $count$ interpolators in the array $interpolator$ and stores the results in the array $result$.
+	/// The interpolator at index <i>k</i> is evaluated with the parameter at index <i>k</i> in the array $t$.
+	/// \related MotorInterpolator
+
+	TERATHON_API void EvaluateMotorInterpolators(const MotorInterpolator *interpolator, const float *t, Motor3D *result, machine count);
+
 	// ==============================================
 	//	POD Structures
 	// ==============================================
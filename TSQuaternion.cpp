@@ -8,6 +8,7 @@
 
 
 #include "TSQuaternion.h"
+#include "TSSimdDispatch.h"
 
 
 using namespace Terathon;
@@ -16,6 +17,907 @@ using namespace Terathon;
 alignas(16) const ConstQuaternion Quaternion::identity = {0.0F, 0.0F, 0.0F, 1.0F};
 
 
+
+namespace
+{
+	enum
+	{
+		kInterpolateNlerp,
+		kInterpolateSlerp,
+		kInterpolateCorrectedNlerp
+	};
+
+	// The corrected parameter is t + t(t - 1/2)(t - 1)k, where k is a quadratic polynomial in (t - 1/2)^2 whose
+	// coefficients are polynomials in the absolute value d of the dot product. The coefficients were fit to the
+	// parameter that makes a normalized linear interpolation land on the spherical linear interpolation.
+
+	inline float GetCorrectedParameter(float t, float d)
+	{
+		float u = t - 0.5F;
+		float q = u * u;
+
+		float a = ((-0.942353129F * d + 2.28903496F) * d - 2.23711637F) * d + 0.832544416F;
+		float b = ((-0.079839516F * d + 0.349328155F) * d - 1.12706024F) * d + 0.858208151F;
+		float c = (2.46473071F * d - 3.31998456F) * d + 1.08595892F;
+
+		return (t + t * u * (t - 1.0F) * ((c * q + a) * q + b));
+	}
+
+	Quaternion Interpolate(const Quaternion& q1, const Quaternion& q2, float t, int32 mode)
+	{
+		float d = Dot(q1, q2);
+		float f = (d < 0.0F) ? -1.0F : 1.0F;
+		Quaternion q = q2 * f;
+		d *= f;
+
+		if (mode == kInterpolateSlerp)
+		{
+			// The part of q perpendicular to q1 has magnitude sin(a) for the angle a between them,
+			// so only one call to CosSin() is needed for the two weights.
+
+			Quaternion u = q - q1 * d;
+			float u2 = SquaredMag(u);
+			if (u2 > 1.0e-12F)
+			{
+				float	c, s;
+
+				float r = InverseSqrt(u2);
+				CosSin(Arctan(u2 * r, d) * t, &c, &s);
+				return (q1 * c + u * (s * r));
+			}
+
+			return (q1 + u * t);
+		}
+
+		if (mode == kInterpolateCorrectedNlerp)
+		{
+			t = GetCorrectedParameter(t, d);
+		}
+
+		Quaternion r = q1 + (q - q1) * t;
+		return (r * InverseMag(r));
+	}
+
+	#ifndef TERATHON_NO_SIMD
+
+		// The vector kernels operate on four quaternions stored with one component per register.
+
+		inline vec_float VecGetCorrectedParameter(const vec_float& t, const vec_float& d)
+		{
+			vec_float u = t - VecLoadVectorConstant<0x3F000000>();
+			vec_float q = u * u;
+
+			vec_float a = VecMadd(VecMadd(VecMadd(VecLoadVectorConstant<0xBF713E0E>(), d, VecLoadVectorConstant<0x40127F8C>()), d, VecLoadVectorConstant<0xC00F2CEA>()), d, VecLoadVectorConstant<0x3F5521A1>());
+			vec_float b = VecMadd(VecMadd(VecMadd(VecLoadVectorConstant<0xBDA382E6>(), d, VecLoadVectorConstant<0x3EB2DB24>()), d, VecLoadVectorConstant<0xBF904383>()), d, VecLoadVectorConstant<0x3F5BB388>());
+			vec_float c = VecMadd(VecMadd(VecLoadVectorConstant<0x401DBE26>(), d, VecLoadVectorConstant<0xC0547AA1>()), d, VecLoadVectorConstant<0x3F8B00B4>());
+
+			return (VecMadd(t * u * (t - VecLoadVectorConstant<0x3F800000>()), VecMadd(VecMadd(c, q, a), q, b), t));
+		}
+
+		inline void VecInterpolate(const vec_float *q1, const vec_float *q2, const vec_float& t, vec_float *result, int32 mode)
+		{
+			vec_float	q[4];
+
+			vec_float d = q1[0] * q2[0] + q1[1] * q2[1] + q1[2] * q2[2] + q1[3] * q2[3];
+			vec_float sign = VecAnd(d, VecFloatGetMinusZero());
+			d = VecXor(d, sign);
+
+			for (machine k = 0; k < 4; k++)
+			{
+				q[k] = VecXor(q2[k], sign);
+			}
+
+			if (mode == kInterpolateSlerp)
+			{
+				vec_float	u[4], c, s;
+
+				for (machine k = 0; k < 4; k++)
+				{
+					u[k] = q[k] - q1[k] * d;
+				}
+
+				vec_float u2 = u[0] * u[0] + u[1] * u[1] + u[2] * u[2] + u[3] * u[3];
+				vec_float mask = VecMaskCmpgt(u2, VecLoadVectorConstant<0x2B8CBCCC>());
+				vec_float r = VecInverseSqrt(VecMax(u2, VecLoadVectorConstant<0x2B8CBCCC>()));
+
+				VecCosSin(VecArctan(u2 * r, d) * t, &c, &s);
+				c = VecSelect(VecLoadVectorConstant<0x3F800000>(), c, mask);
+				s = VecSelect(t, s * r, mask);
+
+				for (machine k = 0; k < 4; k++)
+				{
+					result[k] = q1[k] * c + u[k] * s;
+				}
+			}
+			else
+			{
+				vec_float x = (mode == kInterpolateCorrectedNlerp) ? VecGetCorrectedParameter(t, d) : t;
+
+				for (machine k = 0; k < 4; k++)
+				{
+					q[k] = q1[k] + (q[k] - q1[k]) * x;
+				}
+
+				vec_float r = VecInverseSqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+
+				for (machine k = 0; k < 4; k++)
+				{
+					result[k] = q[k] * r;
+				}
+			}
+		}
+
+		inline void VecLoadQuaternions(const Quaternion *q, vec_float *v)
+		{
+			VecTranspose4D(VecLoadUnaligned(&q[0].x), VecLoadUnaligned(&q[1].x), VecLoadUnaligned(&q[2].x), VecLoadUnaligned(&q[3].x), &v[0], &v[1], &v[2], &v[3]);
+		}
+
+		inline void VecStoreQuaternions(const vec_float *v, Quaternion *q)
+		{
+			vec_float	a, b, c, d;
+
+			VecTranspose4D(v[0], v[1], v[2], v[3], &a, &b, &c, &d);
+			VecStoreUnaligned(a, &q[0].x);
+			VecStoreUnaligned(b, &q[1].x);
+			VecStoreUnaligned(c, &q[2].x);
+			VecStoreUnaligned(d, &q[3].x);
+		}
+
+	#endif
+
+	#if defined(TERATHON_AVX)
+
+		inline exv_float ExvGetCorrectedParameter(const exv_float& t, const exv_float& d)
+		{
+			exv_float u = t - ExvLoadVectorConstant<0x3F000000>();
+			exv_float q = u * u;
+
+			exv_float a = ExvMadd(ExvMadd(ExvMadd(ExvLoadVectorConstant<0xBF713E0E>(), d, ExvLoadVectorConstant<0x40127F8C>()), d, ExvLoadVectorConstant<0xC00F2CEA>()), d, ExvLoadVectorConstant<0x3F5521A1>());
+			exv_float b = ExvMadd(ExvMadd(ExvMadd(ExvLoadVectorConstant<0xBDA382E6>(), d, ExvLoadVectorConstant<0x3EB2DB24>()), d, ExvLoadVectorConstant<0xBF904383>()), d, ExvLoadVectorConstant<0x3F5BB388>());
+			exv_float c = ExvMadd(ExvMadd(ExvLoadVectorConstant<0x401DBE26>(), d, ExvLoadVectorConstant<0xC0547AA1>()), d, ExvLoadVectorConstant<0x3F8B00B4>());
+
+			return (ExvMadd(t * u * (t - ExvLoadVectorConstant<0x3F800000>()), ExvMadd(ExvMadd(c, q, a), q, b), t));
+		}
+
+		inline void ExvInterpolate(const exv_float *q1, const exv_float *q2, const exv_float& t, exv_float *result, int32 mode)
+		{
+			exv_float	q[4];
+
+			exv_float d = q1[0] * q2[0] + q1[1] * q2[1] + q1[2] * q2[2] + q1[3] * q2[3];
+			exv_float sign = ExvAnd(d, ExvFloatGetMinusZero());
+			d = ExvXor(d, sign);
+
+			for (machine k = 0; k < 4; k++)
+			{
+				q[k] = ExvXor(q2[k], sign);
+			}
+
+			if (mode == kInterpolateSlerp)
+			{
+				exv_float	u[4], c, s;
+
+				for (machine k = 0; k < 4; k++)
+				{
+					u[k] = q[k] - q1[k] * d;
+				}
+
+				exv_float u2 = u[0] * u[0] + u[1] * u[1] + u[2] * u[2] + u[3] * u[3];
+				exv_float mask = ExvMaskCmpgt(u2, ExvLoadVectorConstant<0x2B8CBCCC>());
+				exv_float r = ExvInverseSqrt(ExvMax(u2, ExvLoadVectorConstant<0x2B8CBCCC>()));
+
+				ExvCosSin(ExvArctan(u2 * r, d) * t, &c, &s);
+				c = ExvSelect(ExvLoadVectorConstant<0x3F800000>(), c, mask);
+				s = ExvSelect(t, s * r, mask);
+
+				for (machine k = 0; k < 4; k++)
+				{
+					result[k] = q1[k] * c + u[k] * s;
+				}
+			}
+			else
+			{
+				exv_float x = (mode == kInterpolateCorrectedNlerp) ? ExvGetCorrectedParameter(t, d) : t;
+
+				for (machine k = 0; k < 4; k++)
+				{
+					q[k] = q1[k] + (q[k] - q1[k]) * x;
+				}
+
+				exv_float r = ExvInverseSqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+
+				for (machine k = 0; k < 4; k++)
+				{
+					result[k] = q[k] * r;
+				}
+			}
+		}
+
+	#endif
+
+	template <int32 mode>
+	void InterpolateQuaternions(const Quaternion *q1, const Quaternion *q2, const float *t, Quaternion *result, machine count)
+	{
+		machine i = 0;
+
+		#if defined(TERATHON_AVX)
+
+			for (; i + 8 <= count; i += 8)
+			{
+				vec_float	lo[4], hi[4];
+				exv_float	a[4], b[4], r[4];
+
+				VecLoadQuaternions(q1 + i, lo);
+				VecLoadQuaternions(q1 + i + 4, hi);
+
+				for (machine k = 0; k < 4; k++)
+				{
+					a[k] = ExvFloat(lo[k], hi[k]);
+				}
+
+				VecLoadQuaternions(q2 + i, lo);
+				VecLoadQuaternions(q2 + i + 4, hi);
+
+				for (machine k = 0; k < 4; k++)
+				{
+					b[k] = ExvFloat(lo[k], hi[k]);
+				}
+
+				ExvInterpolate(a, b, ExvLoadUnaligned(t + i), r, mode);
+
+				for (machine k = 0; k < 4; k++)
+				{
+					lo[k] = ExvGetVecLo(r[k]);
+					hi[k] = ExvGetVecHi(r[k]);
+				}
+
+				VecStoreQuaternions(lo, result + i);
+				VecStoreQuaternions(hi, result + i + 4);
+			}
+
+		#elif !defined(TERATHON_NO_SIMD)
+
+			for (; i + 4 <= count; i += 4)
+			{
+				vec_float	a[4], b[4], r[4];
+
+				VecLoadQuaternions(q1 + i, a);
+				VecLoadQuaternions(q2 + i, b);
+				VecInterpolate(a, b, VecLoadUnaligned(t + i), r, mode);
+				VecStoreQuaternions(r, result + i);
+			}
+
+		#endif
+
+		for (; i < count; i++)
+		{
+			result[i] = Interpolate(q1[i], q2[i], t[i], mode);
+		}
+	}
+
+	template <int32 mode>
+	void InterpolateQuaternions(const float *const *q1, const float *const *q2, const float *t, float *const *result, machine count)
+	{
+		machine i = 0;
+
+		#if defined(TERATHON_AVX)
+
+			for (; i + 8 <= count; i += 8)
+			{
+				exv_float	a[4], b[4], r[4];
+
+				for (machine k = 0; k < 4; k++)
+				{
+					a[k] = ExvLoadUnaligned(q1[k] + i);
+					b[k] = ExvLoadUnaligned(q2[k] + i);
+				}
+
+				ExvInterpolate(a, b, ExvLoadUnaligned(t + i), r, mode);
+
+				for (machine k = 0; k < 4; k++)
+				{
+					ExvStoreUnaligned(r[k], result[k] + i);
+				}
+			}
+
+		#elif !defined(TERATHON_NO_SIMD)
+
+			for (; i + 4 <= count; i += 4)
+			{
+				vec_float	a[4], b[4], r[4];
+
+				for (machine k = 0; k < 4; k++)
+				{
+					a[k] = VecLoadUnaligned(q1[k] + i);
+					b[k] = VecLoadUnaligned(q2[k] + i);
+				}
+
+				VecInterpolate(a, b, VecLoadUnaligned(t + i), r, mode);
+
+				for (machine k = 0; k < 4; k++)
+				{
+					VecStoreUnaligned(r[k], result[k] + i);
+				}
+			}
+
+		#endif
+
+		for (; i < count; i++)
+		{
+			Quaternion q = Interpolate(Quaternion(q1[0][i], q1[1][i], q1[2][i], q1[3][i]), Quaternion(q2[0][i], q2[1][i], q2[2][i], q2[3][i]), t[i], mode);
+
+			result[0][i] = q.x;
+			result[1][i] = q.y;
+			result[2][i] = q.z;
+			result[3][i] = q.w;
+		}
+	}
+
+	// The batch kernels below perform the same operations as the scalar Transform() and GetRotationMatrix()
+	// functions on four or eight quaternions at a time, where q holds the x, y, z, and w components in separate
+	// registers. Doubling is done by adding a value to itself, which is exact and avoids a constant for each type.
+
+	template <typename type>
+	inline void TransformVectorBatch(const type *q, type& x, type& y, type& z)
+	{
+		type ux = q[1] * z - q[2] * y;
+		type uy = q[2] * x - q[0] * z;
+		type uz = q[0] * y - q[1] * x;
+		ux = ux + ux;
+		uy = uy + uy;
+		uz = uz + uz;
+
+		x = (q[1] * uz - q[2] * uy) + ux * q[3] + x;
+		y = (q[2] * ux - q[0] * uz) + uy * q[3] + y;
+		z = (q[0] * uy - q[1] * ux) + uz * q[3] + z;
+	}
+
+	template <typename type>
+	inline void GetRotationMatrixBatch(const type *q, const type& one, type *entry)
+	{
+		type x2 = q[0] * q[0];
+		type y2 = q[1] * q[1];
+		type z2 = q[2] * q[2];
+		type xy = q[0] * q[1];
+		type zx = q[2] * q[0];
+		type yz = q[1] * q[2];
+		type wx = q[3] * q[0];
+		type wy = q[3] * q[1];
+		type wz = q[3] * q[2];
+
+		type a = y2 + z2, b = xy + wz, c = zx - wy;
+		type d = xy - wz, e = x2 + z2, f = yz + wx;
+		type g = zx + wy, h = yz - wx, k = x2 + y2;
+
+		// The entries are stored in column-major order to match the layout of Matrix3D.
+
+		entry[0] = one - (a + a);
+		entry[1] = b + b;
+		entry[2] = c + c;
+		entry[3] = d + d;
+		entry[4] = one - (e + e);
+		entry[5] = f + f;
+		entry[6] = g + g;
+		entry[7] = h + h;
+		entry[8] = one - (k + k);
+	}
+
+	// The symmetric eigensolver applies five sweeps of cyclic Jacobi rotations to the upper triangle of a 3x3 matrix.
+	// Each rotation uses the approximate half-angle cosine and sine from the quaternion formulation of McAdams et al.,
+	// falling back to a rotation of pi/4 when the exact angle would be too large, so no trigonometric functions are
+	// needed and every lane of a batch performs the same operations. The constants are the threshold (3 + 2 sqrt(2)),
+	// cos(pi/8), sin(pi/8), and sqrt(1/2), followed by one, zero, and the length below which a column is treated
+	// as zero by the QR step of the singular value decomposition.
+
+	const float kEigenConstant[7] = {5.828427125F, 0.923879533F, 0.382683432F, 0.707106781F, 1.0F, 0.0F, 1.0e-18F};
+
+	inline bool EigenLess(float a, float b)
+	{
+		return (a < b);
+	}
+
+	inline float EigenSelect(float a, float b, bool mask)
+	{
+		return ((mask) ? b : a);
+	}
+
+	inline float EigenAbs(float x)
+	{
+		return (Fabs(x));
+	}
+
+	inline float EigenMax(float a, float b)
+	{
+		return (Fmax(a, b));
+	}
+
+	inline float EigenSqrt(float x)
+	{
+		return (Sqrt(x));
+	}
+
+	inline float EigenInverseSqrt(float x)
+	{
+		return (InverseSqrt(x));
+	}
+
+	#ifndef TERATHON_NO_SIMD
+
+		inline vec_float EigenLess(const vec_float& a, const vec_float& b)
+		{
+			return (VecMaskCmplt(a, b));
+		}
+
+		inline vec_float EigenSelect(const vec_float& a, const vec_float& b, const vec_float& mask)
+		{
+			return (VecSelect(a, b, mask));
+		}
+
+		inline vec_float EigenAbs(const vec_float& x)
+		{
+			return (VecAndc(x, VecFloatGetMinusZero()));
+		}
+
+		inline vec_float EigenMax(const vec_float& a, const vec_float& b)
+		{
+			return (VecMax(a, b));
+		}
+
+		inline vec_float EigenSqrt(const vec_float& x)
+		{
+			return (VecSqrt(x));
+		}
+
+		inline vec_float EigenInverseSqrt(const vec_float& x)
+		{
+			return (VecInverseSqrt(x));
+		}
+
+	#endif
+
+	#if defined(TERATHON_AVX)
+
+		inline exv_float EigenLess(const exv_float& a, const exv_float& b)
+		{
+			return (ExvMaskCmplt(a, b));
+		}
+
+		inline exv_float EigenSelect(const exv_float& a, const exv_float& b, const exv_float& mask)
+		{
+			return (ExvSelect(a, b, mask));
+		}
+
+		inline exv_float EigenAbs(const exv_float& x)
+		{
+			return (ExvAndc(x, ExvFloatGetMinusZero()));
+		}
+
+		inline exv_float EigenMax(const exv_float& a, const exv_float& b)
+		{
+			return (ExvMax(a, b));
+		}
+
+		inline exv_float EigenSqrt(const exv_float& x)
+		{
+			return (ExvSqrt(x));
+		}
+
+		inline exv_float EigenInverseSqrt(const exv_float& x)
+		{
+			return (ExvInverseSqrt(x));
+		}
+
+	#endif
+
+	// Multiplies the quaternion v on the right by ch + sh e_k, where (p,q,k) is a cyclic permutation of (0,1,2).
+	// The corresponding matrix rotates the p axis toward the q axis.
+
+	template <typename type>
+	inline void ApplyGivensQuaternion(const type& ch, const type& sh, type& vp, type& vq, type& vk, type& vw)
+	{
+		type x = vp, y = vq, z = vk;
+		vp = ch * x + sh * y;
+		vq = ch * y - sh * x;
+		vk = ch * z + sh * vw;
+		vw = ch * vw - sh * z;
+	}
+
+	// Applies the rotation in the (p,q) plane that reduces the entry apq, where k is the remaining index, and
+	// accumulates it into the quaternion v by multiplying on the right by the rotation about the k axis.
+
+	template <typename type>
+	inline void RotateEigensystem(type& app, type& aqq, type& apq, type& apk, type& aqk, type& vp, type& vq, type& vk, type& vw, const type *constant)
+	{
+		type ch = app - aqq;
+		ch = ch + ch;
+		type sh = apq;
+
+		auto mask = EigenLess(constant[0] * sh * sh, ch * ch);
+		type w = EigenInverseSqrt(ch * ch + sh * sh);
+		ch = EigenSelect(constant[1], w * ch, mask);
+		sh = EigenSelect(constant[2], w * sh, mask);
+
+		type c = ch * ch - sh * sh;
+		type s = ch * sh;
+		s = s + s;
+		type cc = c * c;
+		type ss = s * s;
+		type cs = c * s;
+		type d = cs * apq;
+		d = d + d;
+
+		type a = app, b = aqq;
+		app = cc * a + d + ss * b;
+		aqq = ss * a - d + cc * b;
+		apq = cs * (b - a) + (cc - ss) * apq;
+
+		a = apk;
+		apk = c * a + s * aqk;
+		aqk = c * aqk - s * a;
+
+		ApplyGivensQuaternion(ch, sh, vp, vq, vk, vw);
+	}
+
+	// Exchanges the diagonal entries app and aqq when app < aqq by multiplying v by a rotation of pi/2 about the k axis.
+
+	template <typename type>
+	inline void SortEigensystem(type& app, type& aqq, type& vp, type& vq, type& vk, type& vw, const type& s)
+	{
+		auto mask = EigenLess(app, aqq);
+
+		type a = app;
+		app = EigenSelect(app, aqq, mask);
+		aqq = EigenSelect(aqq, a, mask);
+
+		type x = vp, y = vq, z = vk, w = vw;
+		vp = EigenSelect(x, (x + y) * s, mask);
+		vq = EigenSelect(y, (y - x) * s, mask);
+		vk = EigenSelect(z, (z + w) * s, mask);
+		vw = EigenSelect(w, (w - z) * s, mask);
+	}
+
+	// The entries e are stored in column-major order, and only the upper triangle is read. The eigenvalues are
+	// stored in lambda in descending order, and the unit quaternion whose rotation matrix has the corresponding
+	// eigenvectors as its columns is stored in v.
+
+	template <typename type>
+	void CalculateEigensystemBatch(const type *e, const type *constant, type *lambda, type *v)
+	{
+		type a00 = e[0], a11 = e[4], a22 = e[8];
+		type a01 = e[3], a12 = e[7], a02 = e[6];
+
+		v[0] = constant[5];
+		v[1] = constant[5];
+		v[2] = constant[5];
+		v[3] = constant[4];
+
+		for (machine sweep = 0; sweep < 5; sweep++)
+		{
+			RotateEigensystem(a00, a11, a01, a02, a12, v[0], v[1], v[2], v[3], constant);
+			RotateEigensystem(a11, a22, a12, a01, a02, v[1], v[2], v[0], v[3], constant);
+			RotateEigensystem(a22, a00, a02, a12, a01, v[2], v[0], v[1], v[3], constant);
+		}
+
+		SortEigensystem(a00, a11, v[0], v[1], v[2], v[3], constant[3]);
+		SortEigensystem(a11, a22, v[1], v[2], v[0], v[3], constant[3]);
+		SortEigensystem(a00, a11, v[0], v[1], v[2], v[3], constant[3]);
+
+		type r = EigenInverseSqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2] + v[3] * v[3]);
+		for (machine k = 0; k < 4; k++)
+		{
+			v[k] = v[k] * r;
+		}
+
+		lambda[0] = a00;
+		lambda[1] = a11;
+		lambda[2] = a22;
+	}
+
+	// Calculates the Givens rotation that zeroes the entry b[q][p] below the diagonal, where p < q, and applies it
+	// to rows p and q of the matrix b. The half-angle cosine and sine of the rotation are returned in ch and sh.
+
+	template <typename type>
+	inline void CalculateQRGivens(type (*b)[3], machine p, machine q, type& ch, type& sh, const type *constant)
+	{
+		type a1 = b[p][p];
+		type a2 = b[q][p];
+		type rho = EigenSqrt(a1 * a1 + a2 * a2);
+
+		sh = EigenSelect(constant[5], a2, EigenLess(constant[6], rho));
+		ch = EigenAbs(a1) + EigenMax(rho, constant[6]);
+
+		auto mask = EigenLess(a1, constant[5]);
+		type x = ch;
+		ch = EigenSelect(ch, sh, mask);
+		sh = EigenSelect(sh, x, mask);
+
+		type w = EigenInverseSqrt(ch * ch + sh * sh);
+		ch = ch * w;
+		sh = sh * w;
+
+		type c = ch * ch - sh * sh;
+		type s = ch * sh;
+		s = s + s;
+
+		for (machine j = 0; j < 3; j++)
+		{
+			x = b[p][j];
+			b[p][j] = c * x + s * b[q][j];
+			b[q][j] = c * b[q][j] - s * x;
+		}
+	}
+
+	// Calculates the singular value decomposition A = U S V^T of the matrix whose entries e are stored in column-major
+	// order. The quaternion v is the eigensystem rotation of A^T A, and its rotation matrix is also stored in vm. The
+	// product AV is then factored into the rotation u and an upper triangular matrix with Givens rotations, and the
+	// diagonal of that matrix gives the singular values sigma in descending order of magnitude. The last singular
+	// value is negative when the determinant of A is negative, so u and v are always proper rotations.
+
+	template <typename type>
+	void CalculateSingularValueBatch(const type *e, const type *constant, type *u, type *sigma, type *v, type *vm)
+	{
+		type	t[9], lambda[3], b[3][3], ch, sh;
+
+		t[0] = e[0] * e[0] + e[1] * e[1] + e[2] * e[2];
+		t[4] = e[3] * e[3] + e[4] * e[4] + e[5] * e[5];
+		t[8] = e[6] * e[6] + e[7] * e[7] + e[8] * e[8];
+		t[3] = e[0] * e[3] + e[1] * e[4] + e[2] * e[5];
+		t[6] = e[0] * e[6] + e[1] * e[7] + e[2] * e[8];
+		t[7] = e[3] * e[6] + e[4] * e[7] + e[5] * e[8];
+		t[1] = t[3];
+		t[2] = t[6];
+		t[5] = t[7];
+
+		CalculateEigensystemBatch(t, constant, lambda, v);
+		GetRotationMatrixBatch(v, constant[4], vm);
+
+		for (machine i = 0; i < 3; i++)
+		{
+			for (machine j = 0; j < 3; j++)
+			{
+				b[i][j] = e[i] * vm[j * 3] + e[i + 3] * vm[j * 3 + 1] + e[i + 6] * vm[j * 3 + 2];
+			}
+		}
+
+		u[0] = constant[5];
+		u[1] = constant[5];
+		u[2] = constant[5];
+		u[3] = constant[4];
+
+		// The rotation that zeroes b[2][0] turns the 0 axis toward the 2 axis, which is the reverse of the
+		// cyclic direction, so its sine is negated when it is accumulated into u.
+
+		CalculateQRGivens(b, 0, 1, ch, sh, constant);
+		ApplyGivensQuaternion(ch, sh, u[0], u[1], u[2], u[3]);
+		CalculateQRGivens(b, 0, 2, ch, sh, constant);
+		ApplyGivensQuaternion(ch, constant[5] - sh, u[2], u[0], u[1], u[3]);
+		CalculateQRGivens(b, 1, 2, ch, sh, constant);
+		ApplyGivensQuaternion(ch, sh, u[1], u[2], u[0], u[3]);
+
+		type r = EigenInverseSqrt(u[0] * u[0] + u[1] * u[1] + u[2] * u[2] + u[3] * u[3]);
+		for (machine k = 0; k < 4; k++)
+		{
+			u[k] = u[k] * r;
+		}
+
+		sigma[0] = b[0][0];
+		sigma[1] = b[1][1];
+		sigma[2] = b[2][2];
+	}
+
+	// Calculates the polar decomposition A = RS from the singular value decomposition, where the rotation R = UV^T
+	// is stored in q, and the symmetric matrix S = V diag(sigma) V^T is stored in s in column-major order.
+
+	template <typename type>
+	void CalculatePolarDecompositionBatch(const type *e, const type *constant, type *q, type *s)
+	{
+		type	u[4], sigma[3], v[4], vm[9];
+
+		CalculateSingularValueBatch(e, constant, u, sigma, v, vm);
+
+		q[0] = u[0] * v[3] - u[3] * v[0] - u[1] * v[2] + u[2] * v[1];
+		q[1] = u[1] * v[3] - u[3] * v[1] - u[2] * v[0] + u[0] * v[2];
+		q[2] = u[2] * v[3] - u[3] * v[2] - u[0] * v[1] + u[1] * v[0];
+		q[3] = u[3] * v[3] + u[0] * v[0] + u[1] * v[1] + u[2] * v[2];
+
+		for (machine i = 0; i < 3; i++)
+		{
+			type x = vm[i] * sigma[0];
+			type y = vm[i + 3] * sigma[1];
+			type z = vm[i + 6] * sigma[2];
+
+			for (machine j = i; j < 3; j++)
+			{
+				s[j * 3 + i] = x * vm[j] + y * vm[j + 3] + z * vm[j + 6];
+			}
+		}
+
+		s[1] = s[3];
+		s[2] = s[6];
+		s[5] = s[7];
+	}
+
+	// Factors the upper-left 3x3 portion of a transform, whose entries e are stored in column-major order, as RKH,
+	// where R is a rotation, K is the diagonal scale matrix, and H is a unit upper triangular shear matrix. The columns
+	// of R are found by orthonormalizing the first two columns of e in order and taking the cross product of the results,
+	// so a reflection is represented by a negative z scale. The rotation entries r are stored in column-major order,
+	// and the shear holds the (0,1), (0,2), and (1,2) entries of H.
+
+	template <typename type>
+	void DecomposeTransformBatch(const type *e, type *r, type *scale, type *shear)
+	{
+		type n0 = e[0] * e[0] + e[1] * e[1] + e[2] * e[2];
+		type f0 = EigenInverseSqrt(n0);
+		r[0] = e[0] * f0;
+		r[1] = e[1] * f0;
+		r[2] = e[2] * f0;
+
+		type d01 = r[0] * e[3] + r[1] * e[4] + r[2] * e[5];
+		type x = e[3] - r[0] * d01;
+		type y = e[4] - r[1] * d01;
+		type z = e[5] - r[2] * d01;
+
+		type n1 = x * x + y * y + z * z;
+		type f1 = EigenInverseSqrt(n1);
+		r[3] = x * f1;
+		r[4] = y * f1;
+		r[5] = z * f1;
+
+		r[6] = r[1] * r[5] - r[2] * r[4];
+		r[7] = r[2] * r[3] - r[0] * r[5];
+		r[8] = r[0] * r[4] - r[1] * r[3];
+
+		scale[0] = n0 * f0;
+		scale[1] = n1 * f1;
+		scale[2] = r[6] * e[6] + r[7] * e[7] + r[8] * e[8];
+
+		shear[0] = d01 * f0;
+		shear[1] = (r[0] * e[6] + r[1] * e[7] + r[2] * e[8]) * f0;
+		shear[2] = (r[3] * e[6] + r[4] * e[7] + r[5] * e[8]) * f1;
+	}
+
+	// Calculates the entries e of RKH in column-major order, where R is the rotation matrix corresponding to the
+	// quaternion q, and K and H are the scale and shear matrices described for DecomposeTransformBatch().
+
+	template <typename type>
+	void ComposeTransformBatch(const type *q, const type *scale, const type *shear, const type& one, type *e)
+	{
+		type	r[9];
+
+		GetRotationMatrixBatch(q, one, r);
+
+		type a = scale[0] * shear[0];
+		type b = scale[0] * shear[1];
+		type c = scale[1] * shear[2];
+
+		for (machine i = 0; i < 3; i++)
+		{
+			e[i] = r[i] * scale[0];
+			e[i + 3] = r[i] * a + r[i + 3] * scale[1];
+			e[i + 6] = r[i] * b + r[i + 3] * c + r[i + 6] * scale[2];
+		}
+	}
+
+	// The batch load functions gather the entries of several 3x3 matrices into registers holding one entry each,
+	// in the column-major order of Matrix3D, and the store function performs the reverse operation.
+
+	#if defined(TERATHON_AVX)
+
+		inline void LoadMatrix3DBatch(const Matrix3D *m, exv_float *e)
+		{
+			alignas(32) float	last[8];
+
+			ExvTranspose4D(ExvFloat(VecLoadUnaligned(&m[0](0,0)), VecLoadUnaligned(&m[4](0,0))), ExvFloat(VecLoadUnaligned(&m[1](0,0)), VecLoadUnaligned(&m[5](0,0))),
+			               ExvFloat(VecLoadUnaligned(&m[2](0,0)), VecLoadUnaligned(&m[6](0,0))), ExvFloat(VecLoadUnaligned(&m[3](0,0)), VecLoadUnaligned(&m[7](0,0))), &e[0], &e[1], &e[2], &e[3]);
+			ExvTranspose4D(ExvFloat(VecLoadUnaligned(&m[0](1,1)), VecLoadUnaligned(&m[4](1,1))), ExvFloat(VecLoadUnaligned(&m[1](1,1)), VecLoadUnaligned(&m[5](1,1))),
+			               ExvFloat(VecLoadUnaligned(&m[2](1,1)), VecLoadUnaligned(&m[6](1,1))), ExvFloat(VecLoadUnaligned(&m[3](1,1)), VecLoadUnaligned(&m[7](1,1))), &e[4], &e[5], &e[6], &e[7]);
+
+			for (machine k = 0; k < 8; k++)
+			{
+				last[k] = m[k](2,2);
+			}
+
+			e[8] = ExvLoad(last);
+		}
+
+		inline void LoadTransform3DBatch(const Transform3D *m, exv_float *e)
+		{
+			exv_float	w;
+
+			for (machine j = 0; j < 3; j++)
+			{
+				ExvTranspose4D(ExvFloat(VecLoad(&m[0](0,j)), VecLoad(&m[4](0,j))), ExvFloat(VecLoad(&m[1](0,j)), VecLoad(&m[5](0,j))),
+				               ExvFloat(VecLoad(&m[2](0,j)), VecLoad(&m[6](0,j))), ExvFloat(VecLoad(&m[3](0,j)), VecLoad(&m[7](0,j))), &e[j * 3], &e[j * 3 + 1], &e[j * 3 + 2], &w);
+			}
+		}
+
+		inline void StoreMatrix3DBatch(const exv_float *e, Matrix3D *m)
+		{
+			exv_float			a[4], b[4];
+			alignas(32) float	last[8];
+
+			ExvTranspose4D(e[0], e[1], e[2], e[3], &a[0], &a[1], &a[2], &a[3]);
+			ExvTranspose4D(e[4], e[5], e[6], e[7], &b[0], &b[1], &b[2], &b[3]);
+			ExvStore(e[8], last);
+
+			for (machine k = 0; k < 4; k++)
+			{
+				VecStoreUnaligned(ExvGetVecLo(a[k]), &m[k](0,0));
+				VecStoreUnaligned(ExvGetVecLo(b[k]), &m[k](1,1));
+				m[k](2,2) = last[k];
+
+				VecStoreUnaligned(ExvGetVecHi(a[k]), &m[k + 4](0,0));
+				VecStoreUnaligned(ExvGetVecHi(b[k]), &m[k + 4](1,1));
+				m[k + 4](2,2) = last[k + 4];
+			}
+		}
+
+		inline void LoadQuaternionBatch(const Quaternion *q, exv_float *v)
+		{
+			ExvTranspose4D(ExvFloat(VecLoadUnaligned(&q[0].x), VecLoadUnaligned(&q[4].x)), ExvFloat(VecLoadUnaligned(&q[1].x), VecLoadUnaligned(&q[5].x)),
+			               ExvFloat(VecLoadUnaligned(&q[2].x), VecLoadUnaligned(&q[6].x)), ExvFloat(VecLoadUnaligned(&q[3].x), VecLoadUnaligned(&q[7].x)), &v[0], &v[1], &v[2], &v[3]);
+		}
+
+		inline void StoreQuaternionBatch(const exv_float *v, Quaternion *q)
+		{
+			exv_float	a[4];
+
+			ExvTranspose4D(v[0], v[1], v[2], v[3], &a[0], &a[1], &a[2], &a[3]);
+
+			for (machine k = 0; k < 4; k++)
+			{
+				VecStoreUnaligned(ExvGetVecLo(a[k]), &q[k].x);
+				VecStoreUnaligned(ExvGetVecHi(a[k]), &q[k + 4].x);
+			}
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		inline void LoadMatrix3DBatch(const Matrix3D *m, vec_float *e)
+		{
+			alignas(16) float	last[4];
+
+			VecTranspose4D(VecLoadUnaligned(&m[0](0,0)), VecLoadUnaligned(&m[1](0,0)), VecLoadUnaligned(&m[2](0,0)), VecLoadUnaligned(&m[3](0,0)), &e[0], &e[1], &e[2], &e[3]);
+			VecTranspose4D(VecLoadUnaligned(&m[0](1,1)), VecLoadUnaligned(&m[1](1,1)), VecLoadUnaligned(&m[2](1,1)), VecLoadUnaligned(&m[3](1,1)), &e[4], &e[5], &e[6], &e[7]);
+
+			for (machine k = 0; k < 4; k++)
+			{
+				last[k] = m[k](2,2);
+			}
+
+			e[8] = VecLoad(last);
+		}
+
+		inline void LoadTransform3DBatch(const Transform3D *m, vec_float *e)
+		{
+			vec_float	w;
+
+			for (machine j = 0; j < 3; j++)
+			{
+				VecTranspose4D(VecLoad(&m[0](0,j)), VecLoad(&m[1](0,j)), VecLoad(&m[2](0,j)), VecLoad(&m[3](0,j)), &e[j * 3], &e[j * 3 + 1], &e[j * 3 + 2], &w);
+			}
+		}
+
+		inline void StoreMatrix3DBatch(const vec_float *e, Matrix3D *m)
+		{
+			vec_float			a[4], b[4];
+			alignas(16) float	last[4];
+
+			VecTranspose4D(e[0], e[1], e[2], e[3], &a[0], &a[1], &a[2], &a[3]);
+			VecTranspose4D(e[4], e[5], e[6], e[7], &b[0], &b[1], &b[2], &b[3]);
+			VecStore(e[8], last);
+
+			for (machine k = 0; k < 4; k++)
+			{
+				VecStoreUnaligned(a[k], &m[k](0,0));
+				VecStoreUnaligned(b[k], &m[k](1,1));
+				m[k](2,2) = last[k];
+			}
+		}
+
+	#endif
+}
+
+
 Quaternion& Quaternion::operator *=(const Quaternion& q)
 {
 	float a = w * q.x + x * q.w + y * q.z - z * q.y;
@@ -62,49 +964,36 @@ Matrix3D Quaternion::GetRotationMatrix(void) const
 template <class matrix>
 Quaternion& Quaternion::SetRotationMatrix(const matrix& M)
 {
-	// See FGED1, Section 2.7.
+	// See FGED1, Section 2.7. The largest of the four components is calculated with a square root, and the
+	// other three are calculated from sums or differences of off-diagonal entries. All of the candidates are
+	// calculated up front, and the case is chosen by selection instead of branching so that converting many
+	// matrices does not suffer from mispredictions. Each case performs exactly the same operations as it would
+	// in a branching implementation.
 
 	float m00 = M(0,0);
 	float m11 = M(1,1);
 	float m22 = M(2,2);
 	float sum = m00 + m11 + m22;
 
-	if (sum > 0.0F)
-	{
-		w = Sqrt(sum + 1.0F) * 0.5F;
-		float f = 0.25F / w;
-
-		x = (M(2,1) - M(1,2)) * f;
-		y = (M(0,2) - M(2,0)) * f;
-		z = (M(1,0) - M(0,1)) * f;
-	}
-	else if ((m00 > m11) && (m00 > m22))
-	{
-		x = Sqrt(m00 - m11 - m22 + 1.0F) * 0.5F;
-		float f = 0.25F / x;
+	float d21 = M(2,1) - M(1,2);
+	float d02 = M(0,2) - M(2,0);
+	float d10 = M(1,0) - M(0,1);
+	float s10 = M(1,0) + M(0,1);
+	float s02 = M(0,2) + M(2,0);
+	float s21 = M(2,1) + M(1,2);
 
-		y = (M(1,0) + M(0,1)) * f;
-		z = (M(0,2) + M(2,0)) * f;
-		w = (M(2,1) - M(1,2)) * f;
-	}
-	else if (m11 > m22)
-	{
-		y = Sqrt(m11 - m22 - m00 + 1.0F) * 0.5F;
-		float f = 0.25F / y;
+	bool c0 = (sum > 0.0F);
+	bool c1 = (!c0) & (m00 > m11) & (m00 > m22);
+	bool c2 = (!(c0 | c1)) & (m11 > m22);
 
-		x = (M(1,0) + M(0,1)) * f;
-		z = (M(2,1) + M(1,2)) * f;
-		w = (M(0,2) - M(2,0)) * f;
-	}
-	else
-	{
-		z = Sqrt(m22 - m00 - m11 + 1.0F) * 0.5F;
-		float f = 0.25F / z;
+	float t = (c0) ? sum + 1.0F : ((c1) ? m00 - m11 - m22 + 1.0F : ((c2) ? m11 - m22 - m00 + 1.0F : m22 - m00 - m11 + 1.0F));
+	float p = Sqrt(t) * 0.5F;
+	float f = 0.25F / p;
 
-		x = (M(0,2) + M(2,0)) * f;
-		y = (M(2,1) + M(1,2)) * f;
-		w = (M(1,0) - M(0,1)) * f;
-	}
+	x = (c0) ? d21 * f : ((c1) ? p : ((c2) ? s10 * f : s02 * f));
+	y = (c0) ? d02 * f : ((c1) ? s10 * f : ((c2) ? p : s21 * f));
+	z = (c0) ? d10 * f : ((c1) ? s02 * f : ((c2) ? s21 * f : p));
+	w = (c0) ? p : ((c1) ? d21 * f : ((c2) ? d02 * f : d10 * f));
 
 	return (*this);
 }
@@ -115,10 +1004,21 @@ template TERATHON_API Quaternion& Quaternion::SetRotationMatrix(const Transform3
 
 Quaternion Terathon::operator *(const Quaternion& q1, const Quaternion& q2)
 {
-	return (Quaternion(q1.w * q2.x + q1.x * q2.w + q1.y * q2.z - q1.z * q2.y,
-	                   q1.w * q2.y - q1.x * q2.z + q1.y * q2.w + q1.z * q2.x,
-	                   q1.w * q2.z + q1.x * q2.y - q1.y * q2.x + q1.z * q2.w,
-	                   q1.w * q2.w - q1.x * q2.x - q1.y * q2.y - q1.z * q2.z));
+	#ifndef TERATHON_NO_SIMD
+
+		Quaternion		result;
+
+		VecStoreUnaligned(VecQuaternionProduct(VecLoadUnaligned(&q1.x), VecLoadUnaligned(&q2.x)), &result.x);
+		return (result);
+
+	#else
+
+		return (Quaternion(q1.w * q2.x + q1.x * q2.w + q1.y * q2.z - q1.z * q2.y,
+		                   q1.w * q2.y - q1.x * q2.z + q1.y * q2.w + q1.z * q2.x,
+		                   q1.w * q2.z + q1.x * q2.y - q1.y * q2.x + q1.z * q2.w,
+		                   q1.w * q2.w - q1.x * q2.x - q1.y * q2.y - q1.z * q2.z));
+
+	#endif
 }
 
 Quaternion Terathon::operator *(const Quaternion& q, const Bivector3D& v)
@@ -140,3 +1040,890 @@ Vector3D Terathon::Transform(const Vector3D& v, const Quaternion& q)
 	Bivector3D u = (!q.xyz ^ v) * 2.0F;
 	return ((q.xyz ^ u) + !u * q.w + v);
 }
+
+Quaternion Terathon::Nlerp(const Quaternion& q1, const Quaternion& q2, float t)
+{
+	return (Interpolate(q1, q2, t, kInterpolateNlerp));
+}
+
+Quaternion Terathon::Slerp(const Quaternion& q1, const Quaternion& q2, float t)
+{
+	return (Interpolate(q1, q2, t, kInterpolateSlerp));
+}
+
+Quaternion Terathon::CorrectedNlerp(const Quaternion& q1, const Quaternion& q2, float t)
+{
+	return (Interpolate(q1, q2, t, kInterpolateCorrectedNlerp));
+}
+
+void Terathon::Nlerp(const Quaternion *q1, const Quaternion *q2, const float *t, Quaternion *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->NlerpArray(q1, q2, t, result, count);
+			return;
+		}
+
+	#endif
+
+	InterpolateQuaternions<kInterpolateNlerp>(q1, q2, t, result, count);
+}
+
+void Terathon::Slerp(const Quaternion *q1, const Quaternion *q2, const float *t, Quaternion *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->SlerpArray(q1, q2, t, result, count);
+			return;
+		}
+
+	#endif
+
+	InterpolateQuaternions<kInterpolateSlerp>(q1, q2, t, result, count);
+}
+
+void Terathon::CorrectedNlerp(const Quaternion *q1, const Quaternion *q2, const float *t, Quaternion *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->CorrectedNlerpArray(q1, q2, t, result, count);
+			return;
+		}
+
+	#endif
+
+	InterpolateQuaternions<kInterpolateCorrectedNlerp>(q1, q2, t, result, count);
+}
+
+void Terathon::Nlerp(const float *const *q1, const float *const *q2, const float *t, float *const *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->NlerpSoa(q1, q2, t, result, count);
+			return;
+		}
+
+	#endif
+
+	InterpolateQuaternions<kInterpolateNlerp>(q1, q2, t, result, count);
+}
+
+void Terathon::Slerp(const float *const *q1, const float *const *q2, const float *t, float *const *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->SlerpSoa(q1, q2, t, result, count);
+			return;
+		}
+
+	#endif
+
+	InterpolateQuaternions<kInterpolateSlerp>(q1, q2, t, result, count);
+}
+
+void Terathon::CorrectedNlerp(const float *const *q1, const float *const *q2, const float *t, float *const *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->CorrectedNlerpSoa(q1, q2, t, result, count);
+			return;
+		}
+
+	#endif
+
+	InterpolateQuaternions<kInterpolateCorrectedNlerp>(q1, q2, t, result, count);
+}
+
+#ifndef TERATHON_NO_SIMD
+
+	void Terathon::VecSetRotationMatrix(const vec_float (*entry)[4], vec_float *q)
+	{
+		// This is the same selection as in Quaternion::SetRotationMatrix(), but the square root and the
+		// reciprocal are replaced by a single inverse square root, so the results can differ in the last bits.
+
+		const vec_float one = VecLoadVectorConstant<0x3F800000>();
+
+		vec_float m00 = entry[0][0];
+		vec_float m11 = entry[1][1];
+		vec_float m22 = entry[2][2];
+		vec_float sum = m00 + m11 + m22;
+
+		vec_float d21 = entry[2][1] - entry[1][2];
+		vec_float d02 = entry[0][2] - entry[2][0];
+		vec_float d10 = entry[1][0] - entry[0][1];
+		vec_float s10 = entry[1][0] + entry[0][1];
+		vec_float s02 = entry[0][2] + entry[2][0];
+		vec_float s21 = entry[2][1] + entry[1][2];
+
+		vec_float c0 = VecMaskCmpgt(sum, VecFloatGetZero());
+		vec_float c1 = VecAndc(VecAnd(VecMaskCmpgt(m00, m11), VecMaskCmpgt(m00, m22)), c0);
+		vec_float c2 = VecAndc(VecMaskCmpgt(m11, m22), VecOr(c0, c1));
+
+		vec_float t = VecSelect(m22 - m00 - m11 + one, m11 - m22 - m00 + one, c2);
+		t = VecSelect(VecSelect(t, m00 - m11 - m22 + one, c1), sum + one, c0);
+
+		vec_float f = VecInverseSqrt(t) * VecLoadVectorConstant<0x3F000000>();
+		vec_float p = t * f;
+
+		q[0] = VecSelect(VecSelect(VecSelect(s02 * f, s10 * f, c2), p, c1), d21 * f, c0);
+		q[1] = VecSelect(VecSelect(VecSelect(s21 * f, p, c2), s10 * f, c1), d02 * f, c0);
+		q[2] = VecSelect(VecSelect(VecSelect(p, s21 * f, c2), s02 * f, c1), d10 * f, c0);
+		q[3] = VecSelect(VecSelect(VecSelect(d10 * f, d02 * f, c2), d21 * f, c1), p, c0);
+	}
+
+#endif
+
+void Terathon::SetRotationMatrices(const Transform3D *matrix, Quaternion *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->SetRotationMatrices(matrix, result, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#ifndef TERATHON_NO_SIMD
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	entry[4][4], q[4];
+
+			const Transform3D *M = matrix + i;
+			for (machine j = 0; j < 3; j++)
+			{
+				VecTranspose4D(VecLoad(&M[0](0,j)), VecLoad(&M[1](0,j)), VecLoad(&M[2](0,j)), VecLoad(&M[3](0,j)), &entry[0][j], &entry[1][j], &entry[2][j], &entry[3][j]);
+			}
+
+			VecSetRotationMatrix(entry, q);
+			VecStoreQuaternions(q, result + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		result[i].SetRotationMatrix(matrix[i]);
+	}
+}
+
+void Terathon::TransformVectors(const Quaternion& q, const float *inX, const float *inY, const float *inZ, float *outX, float *outY, float *outZ, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->TransformVectorsSoaQuaternion(&q, inX, inY, inZ, outX, outY, outZ, count);
+			return;
+		}
+
+	#endif
+
+	// When every vector is rotated by the same quaternion, it is cheaper to convert the
+	// quaternion to a matrix once and use the batch matrix transform.
+
+	TransformVectors(Transform3D(q.GetRotationMatrix()), inX, inY, inZ, outX, outY, outZ, count);
+}
+
+void Terathon::TransformVectors(const Quaternion *q, const int32 *index, const float *inX, const float *inY, const float *inZ, float *outX, float *outY, float *outZ, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->TransformVectorsIndexedQuaternion(q, index, inX, inY, inZ, outX, outY, outZ, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		for (; i + 8 <= count; i += 8)
+		{
+			exv_float	c[4];
+
+			const int32 *n = index + i;
+			ExvTranspose4D(ExvFloat(VecLoadUnaligned(&q[n[0]].x), VecLoadUnaligned(&q[n[4]].x)), ExvFloat(VecLoadUnaligned(&q[n[1]].x), VecLoadUnaligned(&q[n[5]].x)),
+			               ExvFloat(VecLoadUnaligned(&q[n[2]].x), VecLoadUnaligned(&q[n[6]].x)), ExvFloat(VecLoadUnaligned(&q[n[3]].x), VecLoadUnaligned(&q[n[7]].x)), &c[0], &c[1], &c[2], &c[3]);
+
+			exv_float x = ExvLoadUnaligned(inX + i);
+			exv_float y = ExvLoadUnaligned(inY + i);
+			exv_float z = ExvLoadUnaligned(inZ + i);
+			TransformVectorBatch(c, x, y, z);
+			ExvStoreUnaligned(x, outX + i);
+			ExvStoreUnaligned(y, outY + i);
+			ExvStoreUnaligned(z, outZ + i);
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	c[4];
+
+			const int32 *n = index + i;
+			VecTranspose4D(VecLoadUnaligned(&q[n[0]].x), VecLoadUnaligned(&q[n[1]].x), VecLoadUnaligned(&q[n[2]].x), VecLoadUnaligned(&q[n[3]].x), &c[0], &c[1], &c[2], &c[3]);
+
+			vec_float x = VecLoadUnaligned(inX + i);
+			vec_float y = VecLoadUnaligned(inY + i);
+			vec_float z = VecLoadUnaligned(inZ + i);
+			TransformVectorBatch(c, x, y, z);
+			VecStoreUnaligned(x, outX + i);
+			VecStoreUnaligned(y, outY + i);
+			VecStoreUnaligned(z, outZ + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		Vector3D v = Transform(Vector3D(inX[i], inY[i], inZ[i]), q[index[i]]);
+		outX[i] = v.x;
+		outY[i] = v.y;
+		outZ[i] = v.z;
+	}
+}
+
+void Terathon::GetRotationMatrices(const Quaternion *q, Matrix3D *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->GetRotationMatrices(q, result, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		const exv_float one = ExvLoadVectorConstant<0x3F800000>();
+
+		for (; i + 8 <= count; i += 8)
+		{
+			exv_float	c[4], entry[9], a[4], b[4];
+
+			const Quaternion *p = q + i;
+			ExvTranspose4D(ExvFloat(VecLoadUnaligned(&p[0].x), VecLoadUnaligned(&p[4].x)), ExvFloat(VecLoadUnaligned(&p[1].x), VecLoadUnaligned(&p[5].x)),
+			               ExvFloat(VecLoadUnaligned(&p[2].x), VecLoadUnaligned(&p[6].x)), ExvFloat(VecLoadUnaligned(&p[3].x), VecLoadUnaligned(&p[7].x)), &c[0], &c[1], &c[2], &c[3]);
+			GetRotationMatrixBatch(c, one, entry);
+
+			// Each 128-bit half of the transposed entries holds the first eight floats of one of the
+			// matrices, and the ninth entry is stored separately for each matrix.
+
+			ExvTranspose4D(entry[0], entry[1], entry[2], entry[3], &a[0], &a[1], &a[2], &a[3]);
+			ExvTranspose4D(entry[4], entry[5], entry[6], entry[7], &b[0], &b[1], &b[2], &b[3]);
+
+			alignas(32) float	last[8];
+			ExvStore(entry[8], last);
+
+			Matrix3D *m = result + i;
+			for (machine k = 0; k < 4; k++)
+			{
+				VecStoreUnaligned(ExvGetVecLo(a[k]), &m[k](0,0));
+				VecStoreUnaligned(ExvGetVecLo(b[k]), &m[k](1,1));
+				m[k](2,2) = last[k];
+
+				VecStoreUnaligned(ExvGetVecHi(a[k]), &m[k + 4](0,0));
+				VecStoreUnaligned(ExvGetVecHi(b[k]), &m[k + 4](1,1));
+				m[k + 4](2,2) = last[k + 4];
+			}
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		const vec_float one = VecLoadVectorConstant<0x3F800000>();
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	c[4], entry[9], a[4], b[4];
+
+			VecLoadQuaternions(q + i, c);
+			GetRotationMatrixBatch(c, one, entry);
+
+			VecTranspose4D(entry[0], entry[1], entry[2], entry[3], &a[0], &a[1], &a[2], &a[3]);
+			VecTranspose4D(entry[4], entry[5], entry[6], entry[7], &b[0], &b[1], &b[2], &b[3]);
+
+			alignas(16) float	last[4];
+			VecStore(entry[8], last);
+
+			Matrix3D *m = result + i;
+			for (machine k = 0; k < 4; k++)
+			{
+				VecStoreUnaligned(a[k], &m[k](0,0));
+				VecStoreUnaligned(b[k], &m[k](1,1));
+				m[k](2,2) = last[k];
+			}
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		result[i] = q[i].GetRotationMatrix();
+	}
+}
+
+void Terathon::CalculateEigensystem(const Matrix3D& m, Vector3D *eigenvalues, Quaternion *rotation)
+{
+	float	lambda[3], v[4];
+
+	CalculateEigensystemBatch(&m(0,0), kEigenConstant, lambda, v);
+	eigenvalues->Set(lambda[0], lambda[1], lambda[2]);
+	rotation->Set(v[0], v[1], v[2], v[3]);
+}
+
+void Terathon::CalculateEigensystem(const Matrix3D& m, Vector3D *eigenvalues, Matrix3D *eigenvectors)
+{
+	Quaternion	q;
+
+	CalculateEigensystem(m, eigenvalues, &q);
+	*eigenvectors = q.GetRotationMatrix();
+}
+
+void Terathon::CalculateEigensystems(const Matrix3D *m, Vector3D *eigenvalues, Quaternion *rotation, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->CalculateEigensystems(m, eigenvalues, rotation, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		exv_float	constant[7];
+
+		for (machine k = 0; k < 7; k++)
+		{
+			constant[k] = ExvLoadSmearScalar(&kEigenConstant[k]);
+		}
+
+		for (; i + 8 <= count; i += 8)
+		{
+			exv_float	e[9], lambda[3], v[4];
+
+			LoadMatrix3DBatch(m + i, e);
+			CalculateEigensystemBatch(e, constant, lambda, v);
+			ExvStoreInterleave3D(lambda[0], lambda[1], lambda[2], &eigenvalues[i].x);
+			StoreQuaternionBatch(v, rotation + i);
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		vec_float	constant[7];
+
+		for (machine k = 0; k < 7; k++)
+		{
+			constant[k] = VecLoadSmearScalar(&kEigenConstant[k]);
+		}
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	e[9], lambda[3], v[4];
+
+			LoadMatrix3DBatch(m + i, e);
+			CalculateEigensystemBatch(e, constant, lambda, v);
+			VecStoreInterleave3D(lambda[0], lambda[1], lambda[2], &eigenvalues[i].x);
+			VecStoreQuaternions(v, rotation + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		CalculateEigensystem(m[i], &eigenvalues[i], &rotation[i]);
+	}
+}
+
+void Terathon::CalculateSingularValueDecomposition(const Matrix3D& m, Quaternion *U, Vector3D *S, Quaternion *V)
+{
+	float	u[4], sigma[3], v[4], vm[9];
+
+	CalculateSingularValueBatch(&m(0,0), kEigenConstant, u, sigma, v, vm);
+	U->Set(u[0], u[1], u[2], u[3]);
+	S->Set(sigma[0], sigma[1], sigma[2]);
+	V->Set(v[0], v[1], v[2], v[3]);
+}
+
+void Terathon::CalculateSingularValueDecompositions(const Matrix3D *m, Quaternion *U, Vector3D *S, Quaternion *V, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->CalculateSingularValueDecompositions(m, U, S, V, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		exv_float	constant[7];
+
+		for (machine k = 0; k < 7; k++)
+		{
+			constant[k] = ExvLoadSmearScalar(&kEigenConstant[k]);
+		}
+
+		for (; i + 8 <= count; i += 8)
+		{
+			exv_float	e[9], u[4], sigma[3], v[4], vm[9];
+
+			LoadMatrix3DBatch(m + i, e);
+			CalculateSingularValueBatch(e, constant, u, sigma, v, vm);
+			StoreQuaternionBatch(u, U + i);
+			ExvStoreInterleave3D(sigma[0], sigma[1], sigma[2], &S[i].x);
+			StoreQuaternionBatch(v, V + i);
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		vec_float	constant[7];
+
+		for (machine k = 0; k < 7; k++)
+		{
+			constant[k] = VecLoadSmearScalar(&kEigenConstant[k]);
+		}
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	e[9], u[4], sigma[3], v[4], vm[9];
+
+			LoadMatrix3DBatch(m + i, e);
+			CalculateSingularValueBatch(e, constant, u, sigma, v, vm);
+			VecStoreQuaternions(u, U + i);
+			VecStoreInterleave3D(sigma[0], sigma[1], sigma[2], &S[i].x);
+			VecStoreQuaternions(v, V + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		CalculateSingularValueDecomposition(m[i], &U[i], &S[i], &V[i]);
+	}
+}
+
+void Terathon::CalculatePolarDecomposition(const Matrix3D& m, Quaternion *rotation, Matrix3D *stretch)
+{
+	float	q[4];
+
+	CalculatePolarDecompositionBatch(&m(0,0), kEigenConstant, q, &(*stretch)(0,0));
+	rotation->Set(q[0], q[1], q[2], q[3]);
+}
+
+void Terathon::CalculatePolarDecomposition(const Transform3D& m, Quaternion *rotation, Matrix3D *stretch)
+{
+	CalculatePolarDecomposition(Matrix3D(m(0,0), m(0,1), m(0,2), m(1,0), m(1,1), m(1,2), m(2,0), m(2,1), m(2,2)), rotation, stretch);
+}
+
+void Terathon::CalculatePolarDecompositions(const Matrix3D *m, Quaternion *rotation, Matrix3D *stretch, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->CalculatePolarDecompositionsMatrix3D(m, rotation, stretch, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		exv_float	constant[7];
+
+		for (machine k = 0; k < 7; k++)
+		{
+			constant[k] = ExvLoadSmearScalar(&kEigenConstant[k]);
+		}
+
+		for (; i + 8 <= count; i += 8)
+		{
+			exv_float	e[9], q[4], s[9];
+
+			LoadMatrix3DBatch(m + i, e);
+			CalculatePolarDecompositionBatch(e, constant, q, s);
+			StoreQuaternionBatch(q, rotation + i);
+			StoreMatrix3DBatch(s, stretch + i);
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		vec_float	constant[7];
+
+		for (machine k = 0; k < 7; k++)
+		{
+			constant[k] = VecLoadSmearScalar(&kEigenConstant[k]);
+		}
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	e[9], q[4], s[9];
+
+			LoadMatrix3DBatch(m + i, e);
+			CalculatePolarDecompositionBatch(e, constant, q, s);
+			VecStoreQuaternions(q, rotation + i);
+			StoreMatrix3DBatch(s, stretch + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		CalculatePolarDecomposition(m[i], &rotation[i], &stretch[i]);
+	}
+}
+
+void Terathon::CalculatePolarDecompositions(const Transform3D *m, Quaternion *rotation, Matrix3D *stretch, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->CalculatePolarDecompositionsTransform3D(m, rotation, stretch, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		exv_float	constant[7];
+
+		for (machine k = 0; k < 7; k++)
+		{
+			constant[k] = ExvLoadSmearScalar(&kEigenConstant[k]);
+		}
+
+		for (; i + 8 <= count; i += 8)
+		{
+			exv_float	e[9], q[4], s[9];
+
+			LoadTransform3DBatch(m + i, e);
+			CalculatePolarDecompositionBatch(e, constant, q, s);
+			StoreQuaternionBatch(q, rotation + i);
+			StoreMatrix3DBatch(s, stretch + i);
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		vec_float	constant[7];
+
+		for (machine k = 0; k < 7; k++)
+		{
+			constant[k] = VecLoadSmearScalar(&kEigenConstant[k]);
+		}
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	e[9], q[4], s[9];
+
+			LoadTransform3DBatch(m + i, e);
+			CalculatePolarDecompositionBatch(e, constant, q, s);
+			VecStoreQuaternions(q, rotation + i);
+			StoreMatrix3DBatch(s, stretch + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		CalculatePolarDecomposition(m[i], &rotation[i], &stretch[i]);
+	}
+}
+
+void Terathon::DecomposeTransform(const Transform3D& m, Vector3D *translation, Quaternion *rotation, Vector3D *scale, Vector3D *shear)
+{
+	Matrix3D	r;
+	float		e[9], s[3], h[3];
+
+	for (machine j = 0; j < 3; j++)
+	{
+		e[j * 3] = m(0,j);
+		e[j * 3 + 1] = m(1,j);
+		e[j * 3 + 2] = m(2,j);
+	}
+
+	DecomposeTransformBatch(e, &r(0,0), s, h);
+
+	*translation = m[3];
+	rotation->SetRotationMatrix(r);
+	scale->Set(s[0], s[1], s[2]);
+
+	if (shear)
+	{
+		shear->Set(h[0], h[1], h[2]);
+	}
+}
+
+Transform3D Terathon::ComposeTransform(const Vector3D& translation, const Quaternion& rotation, const Vector3D& scale)
+{
+	return (ComposeTransform(translation, rotation, scale, Vector3D(0.0F, 0.0F, 0.0F)));
+}
+
+Transform3D Terathon::ComposeTransform(const Vector3D& translation, const Quaternion& rotation, const Vector3D& scale, const Vector3D& shear)
+{
+	float	e[9];
+
+	const float q[4] = {rotation.x, rotation.y, rotation.z, rotation.w};
+	const float s[3] = {scale.x, scale.y, scale.z};
+	const float h[3] = {shear.x, shear.y, shear.z};
+	ComposeTransformBatch(q, s, h, 1.0F, e);
+
+	return (Transform3D(e[0], e[3], e[6], translation.x, e[1], e[4], e[7], translation.y, e[2], e[5], e[8], translation.z));
+}
+
+void Terathon::DecomposeTransforms(const Transform3D *m, Vector3D *translation, Quaternion *rotation, Vector3D *scale, Vector3D *shear, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->DecomposeTransforms(m, translation, rotation, scale, shear, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		for (; i + 8 <= count; i += 8)
+		{
+			exv_float	e[9], r[9], s[3], h[3], t[3], w;
+			vec_float	entry[4][4], q[4];
+
+			const Transform3D *M = m + i;
+			LoadTransform3DBatch(M, e);
+			ExvTranspose4D(ExvFloat(VecLoad(&M[0](0,3)), VecLoad(&M[4](0,3))), ExvFloat(VecLoad(&M[1](0,3)), VecLoad(&M[5](0,3))),
+			               ExvFloat(VecLoad(&M[2](0,3)), VecLoad(&M[6](0,3))), ExvFloat(VecLoad(&M[3](0,3)), VecLoad(&M[7](0,3))), &t[0], &t[1], &t[2], &w);
+
+			DecomposeTransformBatch(e, r, s, h);
+			ExvStoreInterleave3D(t[0], t[1], t[2], &translation[i].x);
+			ExvStoreInterleave3D(s[0], s[1], s[2], &scale[i].x);
+
+			if (shear)
+			{
+				ExvStoreInterleave3D(h[0], h[1], h[2], &shear[i].x);
+			}
+
+			// The conversion to quaternions is performed separately on the two halves of the registers.
+
+			for (machine j = 0; j < 9; j++)
+			{
+				entry[j % 3][j / 3] = ExvGetVecLo(r[j]);
+			}
+
+			VecSetRotationMatrix(entry, q);
+			VecStoreQuaternions(q, rotation + i);
+
+			for (machine j = 0; j < 9; j++)
+			{
+				entry[j % 3][j / 3] = ExvGetVecHi(r[j]);
+			}
+
+			VecSetRotationMatrix(entry, q);
+			VecStoreQuaternions(q, rotation + i + 4);
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	e[9], r[9], s[3], h[3], t[3], w, entry[4][4], q[4];
+
+			const Transform3D *M = m + i;
+			LoadTransform3DBatch(M, e);
+			VecTranspose4D(VecLoad(&M[0](0,3)), VecLoad(&M[1](0,3)), VecLoad(&M[2](0,3)), VecLoad(&M[3](0,3)), &t[0], &t[1], &t[2], &w);
+
+			DecomposeTransformBatch(e, r, s, h);
+			VecStoreInterleave3D(t[0], t[1], t[2], &translation[i].x);
+			VecStoreInterleave3D(s[0], s[1], s[2], &scale[i].x);
+
+			if (shear)
+			{
+				VecStoreInterleave3D(h[0], h[1], h[2], &shear[i].x);
+			}
+
+			for (machine j = 0; j < 9; j++)
+			{
+				entry[j % 3][j / 3] = r[j];
+			}
+
+			VecSetRotationMatrix(entry, q);
+			VecStoreQuaternions(q, rotation + i);
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		DecomposeTransform(m[i], &translation[i], &rotation[i], &scale[i], (shear) ? &shear[i] : nullptr);
+	}
+}
+
+void Terathon::ComposeTransforms(const Vector3D *translation, const Quaternion *rotation, const Vector3D *scale, const Vector3D *shear, Transform3D *result, machine count)
+{
+	#ifdef TERATHON_SIMD_DISPATCH
+
+		const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+		if (table)
+		{
+			table->ComposeTransforms(translation, rotation, scale, shear, result, count);
+			return;
+		}
+
+	#endif
+
+	machine i = 0;
+
+	#if defined(TERATHON_AVX)
+
+		const exv_float zero = ExvFloatGetZero();
+		const exv_float one = ExvLoadVectorConstant<0x3F800000>();
+
+		for (; i + 8 <= count; i += 8)
+		{
+			exv_float	q[4], s[3], h[3], t[3], e[9], c[4];
+
+			LoadQuaternionBatch(rotation + i, q);
+			ExvLoadDeinterleave3D(&scale[i].x, &s[0], &s[1], &s[2]);
+			ExvLoadDeinterleave3D(&translation[i].x, &t[0], &t[1], &t[2]);
+
+			if (shear)
+			{
+				ExvLoadDeinterleave3D(&shear[i].x, &h[0], &h[1], &h[2]);
+			}
+			else
+			{
+				h[0] = zero;
+				h[1] = zero;
+				h[2] = zero;
+			}
+
+			ComposeTransformBatch(q, s, h, one, e);
+
+			Transform3D *M = result + i;
+			for (machine j = 0; j < 4; j++)
+			{
+				if (j < 3)
+				{
+					ExvTranspose4D(e[j * 3], e[j * 3 + 1], e[j * 3 + 2], zero, &c[0], &c[1], &c[2], &c[3]);
+				}
+				else
+				{
+					ExvTranspose4D(t[0], t[1], t[2], one, &c[0], &c[1], &c[2], &c[3]);
+				}
+
+				for (machine k = 0; k < 4; k++)
+				{
+					VecStore(ExvGetVecLo(c[k]), &M[k](0,j));
+					VecStore(ExvGetVecHi(c[k]), &M[k + 4](0,j));
+				}
+			}
+		}
+
+	#elif !defined(TERATHON_NO_SIMD)
+
+		const vec_float zero = VecFloatGetZero();
+		const vec_float one = VecLoadVectorConstant<0x3F800000>();
+
+		for (; i + 4 <= count; i += 4)
+		{
+			vec_float	q[4], s[3], h[3], t[3], e[9], c[4];
+
+			VecLoadQuaternions(rotation + i, q);
+			VecLoadDeinterleave3D(&scale[i].x, &s[0], &s[1], &s[2]);
+			VecLoadDeinterleave3D(&translation[i].x, &t[0], &t[1], &t[2]);
+
+			if (shear)
+			{
+				VecLoadDeinterleave3D(&shear[i].x, &h[0], &h[1], &h[2]);
+			}
+			else
+			{
+				h[0] = zero;
+				h[1] = zero;
+				h[2] = zero;
+			}
+
+			ComposeTransformBatch(q, s, h, one, e);
+
+			Transform3D *M = result + i;
+			for (machine j = 0; j < 4; j++)
+			{
+				if (j < 3)
+				{
+					VecTranspose4D(e[j * 3], e[j * 3 + 1], e[j * 3 + 2], zero, &c[0], &c[1], &c[2], &c[3]);
+				}
+				else
+				{
+					VecTranspose4D(t[0], t[1], t[2], one, &c[0], &c[1], &c[2], &c[3]);
+				}
+
+				for (machine k = 0; k < 4; k++)
+				{
+					VecStore(c[k], &M[k](0,j));
+				}
+			}
+		}
+
+	#endif
+
+	for (; i < count; i++)
+	{
+		result[i] = (shear) ? ComposeTransform(translation[i], rotation[i], scale[i], shear[i]) : ComposeTransform(translation[i], rotation[i], scale[i]);
+	}
+}
@@ -616,6 +616,247 @@ namespace Terathon
 
 	TERATHON_API Vector3D Transform(const Vector3D& v, const Quaternion& q);
 
+	/// \brief Rotates $count$ vectors stored in structure-of-arrays layout by the quaternion $q$.
+	/// Each output array may be the same as the corresponding input array. The quaternion is first converted to a matrix,
+	/// so the results can differ from those of the Transform() function in the last bits.
+	/// \related Quaternion
+
+	TERATHON_API void TransformVectors(const Quaternion& q, const float *inX, const float *inY, const float *inZ, float *outX, float *outY, float *outZ, machine count);
+
+	/// \brief Rotates $count$ vectors stored in structure-of-arrays layout, where the vector with index <i>i</i> is rotated
+	/// by the quaternion $q$[$index$[<i>i</i>]]. Each output array may be the same as the corresponding input array.
+	/// \related Quaternion
+
+	TERATHON_API void TransformVectors(const Quaternion *q, const int32 *index, const float *inX, const float *inY, const float *inZ, float *outX, float *outY, float *outZ, machine count);
+
+	// ==============================================
+	//	Matrix conversion
+	// ==============================================
+
+	/// \brief Converts the $count$ unit quaternions in the array $q$ to rotation matrices and stores them in the array $result$.
+	/// Each matrix is the same as the one returned by the Quaternion::GetRotationMatrix() function.
+	/// \related Quaternion
+
+	TERATHON_API void GetRotationMatrices(const Quaternion *q, Matrix3D *result, machine count);
+
+	/// \brief Converts $count$ rotation matrices in the array $matrix$ to quaternions and stores them in the array $result$.
+	///
+	/// The SIMD kernels replace the square root and reciprocal used by Quaternion::SetRotationMatrix() with a single inverse
+	/// square root. For rotation matrices, each component of the result differs from the one produced by
+	/// Quaternion::SetRotationMatrix() by less than 5e-7, and the results are identical when TERATHON_NO_SIMD is defined.
+	///
+	/// \related Quaternion
+
+	TERATHON_API void SetRotationMatrices(const Transform3D *matrix, Quaternion *result, machine count);
+
+	#ifndef TERATHON_NO_SIMD
+
+		TERATHON_API void VecSetRotationMatrix(const vec_float (*entry)[4], vec_float *q);
+
+	#endif
+
+	// ==============================================
+	//	Eigensystem
+	// ==============================================
+
+	/// \brief Calculates the eigenvalues and eigenvectors of the symmetric matrix $m$, where the eigenvectors are
+	/// returned as the columns of the rotation matrix corresponding to the quaternion $rotation$.
+	///
+	/// Only the upper triangle of $m$ is read. The eigenvalues are returned in descending order, and the rotation is a unit
+	/// quaternion whose rotation matrix has the corresponding unit eigenvectors as its columns. A fixed number of Jacobi
+	/// rotations is performed without any trigonometric functions, and the matrix reconstructed from the results differs
+	/// from $m$ by less than 1e-5 times its Frobenius norm. The entries of $m$ should be large enough that their squares
+	/// do not underflow.
+	///
+	/// \related Quaternion
+
+	TERATHON_API void CalculateEigensystem(const Matrix3D& m, Vector3D *eigenvalues, Quaternion *rotation);
+
+	/// \brief Calculates the eigenvalues and eigenvectors of the symmetric matrix $m$, where the eigenvectors are
+	/// returned as the columns of the rotation matrix $eigenvectors$. The results are the same as those of the
+	/// CalculateEigensystem() function that returns a quaternion.
+	/// \related Quaternion
+
+	TERATHON_API void CalculateEigensystem(const Matrix3D& m, Vector3D *eigenvalues, Matrix3D *eigenvectors);
+
+	/// \brief Calculates the eigensystems of the $count$ symmetric matrices in the array $m$ and stores the eigenvalues
+	/// and rotations in the arrays $eigenvalues$ and $rotation$. Each eigensystem satisfies the same error bound as the one
+	/// calculated by the CalculateEigensystem() function, and four or eight matrices are processed at a time with the SIMD kernels.
+	/// \related Quaternion
+
+	TERATHON_API void CalculateEigensystems(const Matrix3D *m, Vector3D *eigenvalues, Quaternion *rotation, machine count);
+
+	// ==============================================
+	//	Singular value decomposition
+	// ==============================================
+
+	/// \brief Calculates the singular value decomposition of the matrix $m$, where the rotations $U$ and $V$ are returned as
+	/// quaternions, and the singular values are returned in $S$.
+	///
+	/// The decomposition <b>M</b>&#x202F;=&#x202F;<b>USV</b><sup>T</sup> is calculated by finding the eigensystem of
+	/// <b>M</b><sup>T</sup><b>M</b> to obtain $V$ and then factoring <b>MV</b> into $U$ and an upper triangular matrix with
+	/// Givens rotations, so it is independent of the column order and uses no branches. The singular values are returned in
+	/// descending order of magnitude, and the last one is negative when the determinant of $m$ is negative so that $U$ and $V$
+	/// are always proper rotations. The entries of <b>M</b><sup>T</sup><b>M</b> should be large enough that their squares do
+	/// not underflow and small enough that their squares do not overflow.
+	///
+	/// \related Quaternion
+
+	TERATHON_API void CalculateSingularValueDecomposition(const Matrix3D& m, Quaternion *U, Vector3D *S, Quaternion *V);
+
+	/// \brief Calculates the singular value decompositions of the $count$ matrices in the array $m$ and stores the results in the
+	/// arrays $U$, $S$, and $V$, as described for the CalculateSingularValueDecomposition() function.
+	/// \related Quaternion
+
+	TERATHON_API void CalculateSingularValueDecompositions(const Matrix3D *m, Quaternion *U, Vector3D *S, Quaternion *V, machine count);
+
+	/// \brief Calculates the polar decomposition of the matrix $m$ into a rotation and a symmetric stretch matrix.
+	///
+	/// The decomposition <b>M</b>&#x202F;=&#x202F;<b>RP</b> is derived from the singular value decomposition
+	/// <b>M</b>&#x202F;=&#x202F;<b>USV</b><sup>T</sup>. The rotation <b>R</b>&#x202F;=&#x202F;<b>UV</b><sup>T</sup> is the
+	/// rotation closest to $m$, and the stretch is <b>P</b>&#x202F;=&#x202F;<b>VSV</b><sup>T</sup>, which has a negative
+	/// eigenvalue when the determinant of $m$ is negative.
+	///
+	/// \related Quaternion
+
+	TERATHON_API void CalculatePolarDecomposition(const Matrix3D& m, Quaternion *rotation, Matrix3D *stretch);
+
+	/// \brief Calculates the polar decomposition of the upper-left 3&#x202F;&times;&#x202F;3 portion of the transform $m$
+	/// into a rotation and a symmetric stretch matrix. The translation is ignored.
+	/// \related Quaternion
+
+	TERATHON_API void CalculatePolarDecomposition(const Transform3D& m, Quaternion *rotation, Matrix3D *stretch);
+
+	/// \brief Calculates the polar decompositions of the $count$ matrices in the array $m$ and stores the results in the arrays
+	/// $rotation$ and $stretch$.
+	/// \related Quaternion
+
+	TERATHON_API void CalculatePolarDecompositions(const Matrix3D *m, Quaternion *rotation, Matrix3D *stretch, machine count);
+
+	/// \brief Calculates the polar decompositions of the upper-left 3&#x202F;&times;&#x202F;3 portions of the $count$
+	/// transforms in the array $m$ and stores the results in the arrays $rotation$ and $stretch$.
+	/// \related Quaternion
+
+	TERATHON_API void CalculatePolarDecompositions(const Transform3D *m, Quaternion *rotation, Matrix3D *stretch, machine count);
+
+	// ==============================================
+	//	Transform decomposition
+	// ==============================================
+
+	/// \brief Decomposes the transform $m$ into a translation, a rotation, a scale, and a shear.
+	/// \param m				The transform to decompose.
+	/// \param translation	Receives the fourth column of the transform.
+	/// \param rotation		Receives the unit quaternion corresponding to the rotation.
+	/// \param scale			Receives the scale along each axis.
+	/// \param shear			Receives the shear. This can be $nullptr$ if the shear is not needed.
+	///
+	/// The upper-left 3&#x202F;&times;&#x202F;3 portion of $m$ is factored as <b>RKH</b>, where <b>R</b> is the rotation,
+	/// <b>K</b> is the diagonal matrix holding the scale, and <b>H</b> is the unit upper triangular matrix whose (0,1), (0,2),
+	/// and (1,2) entries are the <i>x</i>, <i>y</i>, and <i>z</i> components of the shear. The <i>x</i> and <i>y</i> axes of
+	/// the rotation are found by orthonormalizing the first two columns in order, so those columns must be nonzero, and a
+	/// reflection is represented by a negative <i>z</i> scale. The shear is zero for any transform built from a rotation,
+	/// a scale, and a translation.
+	///
+	/// \related Quaternion
+
+	TERATHON_API void DecomposeTransform(const Transform3D& m, Vector3D *translation, Quaternion *rotation, Vector3D *scale, Vector3D *shear = nullptr);
+
+	/// \brief Returns the transform that applies a scale, a rotation, and a translation, in that order.
+	/// \related Quaternion
+
+	TERATHON_API Transform3D ComposeTransform(const Vector3D& translation, const Quaternion& rotation, const Vector3D& scale);
+
+	/// \brief Returns the transform that applies a shear, a scale, a rotation, and a translation, in that order.
+	/// The shear and scale have the meanings described for the DecomposeTransform() function, and composing the results
+	/// of a decomposition reproduces the original transform to within rounding error.
+	/// \related Quaternion
+
+	TERATHON_API Transform3D ComposeTransform(const Vector3D& translation, const Quaternion& rotation, const Vector3D& scale, const Vector3D& shear);
+
+	/// \brief Decomposes the $count$ transforms in the array $m$ and stores the results in the arrays $translation$, $rotation$,
+	/// $scale$, and $shear$, where $shear$ can be $nullptr$. In SIMD builds, the rotations are converted to quaternions in the
+	/// same way as the SetRotationMatrices() function.
+	/// \related Quaternion
+
+	TERATHON_API void DecomposeTransforms(const Transform3D *m, Vector3D *translation, Quaternion *rotation, Vector3D *scale, Vector3D *shear, machine count);
+
+	/// \brief Composes $count$ transforms from the arrays $translation$, $rotation$, $scale$, and $shear$ and stores them in the
+	/// array $result$. If $shear$ is $nullptr$, then the shear is zero for every transform.
+	/// \related Quaternion
+
+	TERATHON_API void ComposeTransforms(const Vector3D *translation, const Quaternion *rotation, const Vector3D *scale, const Vector3D *shear, Transform3D *result, machine count);
+
+	// ==============================================
+	//	Interpolation
+	// ==============================================
+
+	/// \brief Calculates the normalized linear interpolation between two unit quaternions.
+	///
+	/// The interpolation takes the shorter path between $q1$ and $q2$ by negating $q2$ when the dot product of the
+	/// two quaternions is negative.
+	///
+	/// \related Quaternion
+
+	TERATHON_API Quaternion Nlerp(const Quaternion& q1, const Quaternion& q2, float t);
+
+	/// \brief Calculates the spherical linear interpolation between two unit quaternions.
+	///
+	/// The interpolation takes the shorter path between $q1$ and $q2$, and it is calculated with the CosSin() and Arctan()
+	/// functions. The error in the angle of the interpolated rotation is below 1e-6 radians.
+	///
+	/// \related Quaternion
+
+	TERATHON_API Quaternion Slerp(const Quaternion& q1, const Quaternion& q2, float t);
+
+	/// \brief Approximates the spherical linear interpolation between two unit quaternions with a corrected normalized
+	/// linear interpolation, where the parameter $t$ must be in the range [0,&#x202F;1].
+	///
+	/// The parameter of a normalized linear interpolation along the shorter path is adjusted with a polynomial in $t$ and
+	/// the dot product of $q1$ and $q2$. For <i>t</i>&#x202F;&isin;&#x202F;[0,&#x202F;1], the error in the angle of the
+	/// interpolated rotation is below 1.5e-4 radians. The correction is not valid outside this range, where the error can
+	/// exceed 0.3 radians, so Slerp() should be used for extrapolation.
+	///
+	/// \related Quaternion
+
+	TERATHON_API Quaternion CorrectedNlerp(const Quaternion& q1, const Quaternion& q2, float t);
+
+	/// \brief Calculates $count$ normalized linear interpolations between corresponding entries of the arrays $q1$ and $q2$
+	/// with the parameters in the array $t$ and stores the results in the array $result$.
+	/// \related Quaternion
+
+	TERATHON_API void Nlerp(const Quaternion *q1, const Quaternion *q2, const float *t, Quaternion *result, machine count);
+
+	/// \brief Calculates $count$ spherical linear interpolations between corresponding entries of the arrays $q1$ and $q2$
+	/// with the parameters in the array $t$ and stores the results in the array $result$.
+	/// \related Quaternion
+
+	TERATHON_API void Slerp(const Quaternion *q1, const Quaternion *q2, const float *t, Quaternion *result, machine count);
+
+	/// \brief Calculates $count$ corrected normalized linear interpolations between corresponding entries of the arrays $q1$ and $q2$
+	/// with the parameters in the array $t$ and stores the results in the array $result$. Each parameter must be in the range [0,&#x202F;1].
+	/// \related Quaternion
+
+	TERATHON_API void CorrectedNlerp(const Quaternion *q1, const Quaternion *q2, const float *t, Quaternion *result, machine count);
+
+	/// \brief Calculates $count$ normalized linear interpolations for quaternions stored in structure-of-arrays layout.
+	/// Each of $q1$, $q2$, and $result$ points to four arrays holding the <i>x</i>, <i>y</i>, <i>z</i>, and <i>w</i> components.
+	/// \related Quaternion
+
+	TERATHON_API void Nlerp(const float *const *q1, const float *const *q2, const float *t, float *const *result, machine count);
+
+	/// \brief Calculates $count$ spherical linear interpolations for quaternions stored in structure-of-arrays layout.
+	/// Each of $q1$, $q2$, and $result$ points to four arrays holding the <i>x</i>, <i>y</i>, <i>z</i>, and <i>w</i> components.
+	/// \related Quaternion
+
+	TERATHON_API void Slerp(const float *const *q1, const float *const *q2, const float *t, float *const *result, machine count);
+
+	/// \brief Calculates $count$ corrected normalized linear interpolations for quaternions stored in structure-of-arrays layout.
+	/// Each of $q1$, $q2$, and $result$ points to four arrays holding the <i>x</i>, <i>y</i>, <i>z</i>, and <i>w</i> components,
+	/// and each parameter must be in the range [0,&#x202F;1].
+	/// \related Quaternion
+
+	TERATHON_API void CorrectedNlerp(const float *const *q1, const float *const *q2, const float *t, float *const *result, machine count);
+
 
 	// ==============================================
 	//	POD Structures
@@ -0,0 +1,246 @@
+//
+// This file is part of the Terathon Common Library, by Eric Lengyel.
+// Copyright 1999-2025, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+
+#include "TSSimd.h"
+#include "TSSimdDispatch.h"
+
+
+#if defined(TERATHON_SSE)
+
+	#if defined(_MSC_VER)
+
+		#ifdef TERATHON_NO_SYSTEM
+
+			extern "C"
+			{
+				extern void __cdecl __cpuidex(int *, int, int);
+				extern unsigned __int64 __cdecl _xgetbv(unsigned int);
+			}
+
+		#else
+
+			#include <intrin.h>
+
+		#endif
+
+	#else
+
+		#include <cpuid.h>
+
+	#endif
+
+#endif
+
+
+using namespace Terathon;
+
+
+namespace
+{
+	#if defined(TERATHON_SSE)
+
+		void GetCpuid(uint32 leaf, uint32 subleaf, uint32 *reg)
+		{
+			#if defined(_MSC_VER)
+
+				int		info[4];
+
+				__cpuidex(info, int(leaf), int(subleaf));
+				reg[0] = uint32(info[0]);
+				reg[1] = uint32(info[1]);
+				reg[2] = uint32(info[2]);
+				reg[3] = uint32(info[3]);
+
+			#else
+
+				__cpuid_count(leaf, subleaf, reg[0], reg[1], reg[2], reg[3]);
+
+			#endif
+		}
+
+		uint32 GetXcr0(void)
+		{
+			#if defined(_MSC_VER)
+
+				return (uint32(_xgetbv(0)));
+
+			#else
+
+				uint32	eax, edx;
+
+				__asm__ volatile ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+				return (eax);
+
+			#endif
+		}
+
+	#endif
+
+	uint32 DetectSimdFeatures(void)
+	{
+		uint32 features = 0;
+
+		#if defined(TERATHON_SSE)
+
+			uint32		reg[4];
+
+			GetCpuid(0, 0, reg);
+			uint32 maxLeaf = reg[0];
+			if (maxLeaf >= 1)
+			{
+				GetCpuid(1, 0, reg);
+				uint32 ecx = reg[2];
+				uint32 edx = reg[3];
+
+				if (edx & (1U << 26))
+				{
+					features |= kSimdFeatureSse2;
+				}
+
+				if (ecx & (1U << 19))
+				{
+					features |= kSimdFeatureSse41;
+				}
+
+				// AVX state must be enabled by the OS (XCR0 bits 1 and 2) before any
+				// VEX-encoded instruction can be used, regardless of the cpuid bits.
+
+				uint32 xcr0 = (ecx & (1U << 27)) ? GetXcr0() : 0;
+				if (((ecx & (1U << 28)) != 0) && ((xcr0 & 0x06) == 0x06))
+				{
+					features |= kSimdFeatureAvx;
+
+					if (ecx & (1U << 12))
+					{
+						features |= kSimdFeatureFma;
+					}
+
+					if (maxLeaf >= 7)
+					{
+						GetCpuid(7, 0, reg);
+						uint32 ebx = reg[1];
+
+						if (ebx & (1U << 5))
+						{
+							features |= kSimdFeatureAvx2;
+						}
+
+						// AVX-512 additionally requires the opmask and upper ZMM state (XCR0 bits 5-7).
+
+						if (((ebx & (1U << 16)) != 0) && ((xcr0 & 0xE0) == 0xE0))
+						{
+							features |= kSimdFeatureAvx512;
+						}
+					}
+				}
+			}
+
+		#elif defined(TERATHON_NEON)
+
+			features |= kSimdFeatureNeon;
+
+		#endif
+
+		return (features);
+	}
+
+	const TerathonSimd::DispatchTable *SelectDispatchTable(void)
+	{
+		#if defined(TERATHON_SIMD_DISPATCH)
+
+			// The widest variant is tried first. A variant is only selected if it uses some feature that
+			// the baseline functions were not already compiled with, since it would not be faster otherwise.
+
+			uint32 available = SimdGetFeatures();
+			uint32 compiled = SimdGetRequiredFeatures();
+
+			const TerathonSimd::DispatchTable *const variant[2] = {TerathonSimd::GetAvx512DispatchTable(), TerathonSimd::GetAvx2DispatchTable()};
+			for (const TerathonSimd::DispatchTable *table : variant)
+			{
+				if ((table) && ((available & table->requiredFeatures) == table->requiredFeatures) && ((table->requiredFeatures & ~compiled) != 0))
+				{
+					return (table);
+				}
+			}
+
+		#endif
+
+		return (nullptr);
+	}
+}
+
+
+uint32 Terathon::SimdGetFeatures(void)
+{
+	static const uint32 features = DetectSimdFeatures();
+	return (features);
+}
+
+uint32 Terathon::SimdGetRequiredFeatures(void)
+{
+	uint32 features = 0;
+
+	#if defined(TERATHON_SSE)
+
+		features |= kSimdFeatureSse2;
+
+	#endif
+
+	#if defined(TERATHON_SSE4) || defined(__SSE4_1__)
+
+		features |= kSimdFeatureSse41;
+
+	#endif
+
+	#if defined(TERATHON_AVX)
+
+		features |= kSimdFeatureAvx;
+
+	#endif
+
+	#if defined(__AVX2__)
+
+		features |= kSimdFeatureAvx2;
+
+	#endif
+
+	#if defined(TERATHON_FMA)
+
+		features |= kSimdFeatureFma;
+
+	#endif
+
+	#if defined(TERATHON_AVX512)
+
+		features |= kSimdFeatureAvx512;
+
+	#endif
+
+	#if defined(TERATHON_NEON)
+
+		features |= kSimdFeatureNeon;
+
+	#endif
+
+	return (features);
+}
+
+uint32 Terathon::SimdGetDispatchFeatures(void)
+{
+	const TerathonSimd::DispatchTable *table = TerathonSimd::dispatchTable;
+	return ((table) ? table->requiredFeatures : SimdGetRequiredFeatures());
+}
+
+bool Terathon::SimdCheckFeatures(void)
+{
+	uint32 required = SimdGetRequiredFeatures();
+	return ((SimdGetFeatures() & required) == required);
+}
+
+const TerathonSimd::DispatchTable *const TerathonSimd::dispatchTable = SelectDispatchTable();
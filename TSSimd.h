@@ -26,6 +26,18 @@
 
 #endif
 
+#if defined(__AVX512F__)
+
+	#define TERATHON_AVX512 1
+
+#endif
+
+#if defined(__FMA__) && !defined(TERATHON_SIMD_VARIANT)
+
+	#define TERATHON_FMA 1
+
+#endif
+
 #if defined(__ARM_NEON)
 
 	#define TERATHON_NEON 1
@@ -62,6 +74,11 @@
 			unsigned __int64	m128i_u64[2];
 		} __m128i;
 
+		typedef union __declspec(intrin_type) __declspec(align(16)) __m128d
+		{
+			double				m128d_f64[2];
+		} __m128d;
+
 		#define _MM_SHUFFLE(p3,p2,p1,p0) (((p3) << 6) | ((p2) << 4) | ((p1) << 2) | (p0))
 
 		extern "C"
@@ -99,6 +116,8 @@
 			extern void _mm_store_ss(float *, __m128);
 			extern void _mm_store_ps(float *, __m128);
 			extern void _mm_storeu_ps(float *, __m128);
+			extern void _mm_stream_ps(float *, __m128);
+			extern void _mm_sfence(void);
 			extern unsigned int _mm_getcsr(void);
 			extern void _mm_setcsr(unsigned int);
 
@@ -124,6 +143,32 @@
 			extern __m128i _mm_cvtps_epi32(__m128);
 			extern __m128i _mm_add_epi32(__m128i, __m128i);
 			extern __m128i _mm_sub_epi32(__m128i, __m128i);
+			extern __m128i _mm_loadl_epi64(const __m128i *);
+			extern __m128i _mm_unpacklo_epi64(__m128i, __m128i);
+			extern __m128 _mm_castsi128_ps(__m128i);
+			extern __m128i _mm_castps_si128(__m128);
+
+			extern __m128d _mm_add_pd(__m128d, __m128d);
+			extern __m128d _mm_sub_pd(__m128d, __m128d);
+			extern __m128d _mm_mul_pd(__m128d, __m128d);
+			extern __m128d _mm_div_pd(__m128d, __m128d);
+			extern __m128d _mm_sqrt_sd(__m128d, __m128d);
+			extern __m128d _mm_min_pd(__m128d, __m128d);
+			extern __m128d _mm_max_pd(__m128d, __m128d);
+			extern __m128d _mm_setzero_pd(void);
+			extern __m128d _mm_load_pd(const double *);
+			extern __m128d _mm_loadu_pd(const double *);
+			extern __m128d _mm_load_sd(const double *);
+			extern __m128d _mm_load1_pd(const double *);
+			extern void _mm_store_pd(double *, __m128d);
+			extern void _mm_storeu_pd(double *, __m128d);
+			extern void _mm_store_sd(double *, __m128d);
+			extern __m128d _mm_unpacklo_pd(__m128d, __m128d);
+			extern __m128d _mm_unpackhi_pd(__m128d, __m128d);
+			extern __m128d _mm_cvtps_pd(__m128);
+			extern __m128 _mm_cvtpd_ps(__m128d);
+			extern __m128 _mm_movehl_ps(__m128, __m128);
+			extern __m128 _mm_movelh_ps(__m128, __m128);
 		}
 
 	#endif
@@ -147,6 +192,11 @@
 			unsigned __int64	m256i_u64[4];
 		} __m256i;
 
+		typedef union __declspec(intrin_type) __declspec(align(32)) __m256d
+		{
+			double				m256d_f64[4];
+		} __m256d;
+
 		extern "C"
 		{
 			extern __m256 __cdecl _mm256_add_ps(__m256, __m256);
@@ -168,10 +218,138 @@
 			extern __m256 __cdecl _mm256_castps128_ps256(__m128);
 			extern __m256 __cdecl _mm256_setzero_ps(void);
 			extern __m256 __cdecl _mm256_load_ps(const float *);
+			extern __m256 __cdecl _mm256_loadu_ps(const float *);
 			extern __m256 __cdecl _mm256_broadcast_ss(const float *);
+			extern __m256 __cdecl _mm256_broadcast_ps(const __m128 *);
 			extern void __cdecl _mm256_store_ps(float *, __m256);
+			extern void __cdecl _mm256_storeu_ps(float *, __m256);
+			extern __m128 __cdecl _mm256_extractf128_ps(__m256, int);
+			extern __m256 __cdecl _mm256_shuffle_ps(__m256, __m256, int);
+			extern __m256 __cdecl _mm256_blend_ps(__m256, __m256, int);
+			extern __m256 __cdecl _mm256_hadd_ps(__m256, __m256);
+			extern __m256 __cdecl _mm256_round_ps(__m256, int);
+			extern int __cdecl _mm256_movemask_ps(__m256);
+			extern __m256 __cdecl _mm256_cvtepi32_ps(__m256i);
+			extern __m256i __cdecl _mm256_castps_si256(__m256);
+			extern __m256i __cdecl _mm256_cvtps_epi32(__m256);
+			extern __m256i __cdecl _mm256_cvttps_epi32(__m256);
+			extern __m256 __cdecl _mm256_fmadd_ps(__m256, __m256, __m256);
+			extern __m256 __cdecl _mm256_fnmadd_ps(__m256, __m256, __m256);
+			extern __m128 __cdecl _mm_fmadd_ps(__m128, __m128, __m128);
+			extern __m128 __cdecl _mm_fmadd_ss(__m128, __m128, __m128);
+			extern __m128 __cdecl _mm_fnmadd_ps(__m128, __m128, __m128);
+			extern __m128 __cdecl _mm_fnmadd_ss(__m128, __m128, __m128);
+			extern __m128 __cdecl _mm_move_ss(__m128, __m128);
+
+			extern __m256d __cdecl _mm256_add_pd(__m256d, __m256d);
+			extern __m256d __cdecl _mm256_sub_pd(__m256d, __m256d);
+			extern __m256d __cdecl _mm256_mul_pd(__m256d, __m256d);
+			extern __m256d __cdecl _mm256_div_pd(__m256d, __m256d);
+			extern __m256d __cdecl _mm256_min_pd(__m256d, __m256d);
+			extern __m256d __cdecl _mm256_max_pd(__m256d, __m256d);
+			extern __m256d __cdecl _mm256_setzero_pd(void);
+			extern __m256d __cdecl _mm256_load_pd(const double *);
+			extern __m256d __cdecl _mm256_loadu_pd(const double *);
+			extern __m256d __cdecl _mm256_broadcast_sd(const double *);
+			extern void __cdecl _mm256_store_pd(double *, __m256d);
+			extern void __cdecl _mm256_storeu_pd(double *, __m256d);
+			extern __m256d __cdecl _mm256_castpd128_pd256(__m128d);
+			extern __m128d __cdecl _mm256_castpd256_pd128(__m256d);
+			extern __m256d __cdecl _mm256_insertf128_pd(__m256d, __m128d, int);
+			extern __m128d __cdecl _mm256_extractf128_pd(__m256d, int);
+			extern __m256d __cdecl _mm256_permute_pd(__m256d, int);
+			extern __m256d __cdecl _mm256_permute2f128_pd(__m256d, __m256d, int);
+			extern __m256d __cdecl _mm256_cvtps_pd(__m128);
+			extern __m128 __cdecl _mm256_cvtpd_ps(__m256d);
+			extern __m256d __cdecl _mm256_fmadd_pd(__m256d, __m256d, __m256d);
+			extern __m256d __cdecl _mm256_fnmadd_pd(__m256d, __m256d, __m256d);
+			extern __m128d __cdecl _mm_fmadd_pd(__m128d, __m128d, __m128d);
+			extern __m128d __cdecl _mm_fnmadd_pd(__m128d, __m128d, __m128d);
+		}
+
+		#define _CMP_EQ_OQ				0x00
+		#define _CMP_LT_OQ				0x11
+		#define _MM_FROUND_TO_NEG_INF	0x01
+		#define _MM_FROUND_TO_POS_INF	0x02
+		#define _MM_FROUND_NO_EXC		0x08
+
+	#endif
+
+	#if defined(TERATHON_AVX512)
+
+		typedef union __declspec(intrin_type) __declspec(align(64)) __m512
+		{
+			float				m512_f32[16];
+		} __m512;
+
+		typedef union __declspec(intrin_type) __declspec(align(64)) __m512i
+		{
+			__int32				m512i_i32[16];
+			unsigned __int32	m512i_u32[16];
+		} __m512i;
+
+		typedef union __declspec(intrin_type) __declspec(align(64)) __m512d
+		{
+			double				m512d_f64[8];
+		} __m512d;
+
+		typedef unsigned short __mmask16;
+
+		extern "C"
+		{
+			extern __m512 __cdecl _mm512_add_ps(__m512, __m512);
+			extern __m512 __cdecl _mm512_sub_ps(__m512, __m512);
+			extern __m512 __cdecl _mm512_mul_ps(__m512, __m512);
+			extern __m512 __cdecl _mm512_maskz_mul_ps(__mmask16, __m512, __m512);
+			extern __m512 __cdecl _mm512_div_ps(__m512, __m512);
+			extern __m512 __cdecl _mm512_fmadd_ps(__m512, __m512, __m512);
+			extern __m512 __cdecl _mm512_fnmadd_ps(__m512, __m512, __m512);
+			extern __m512 __cdecl _mm512_rsqrt14_ps(__m512);
+			extern __m512 __cdecl _mm512_min_ps(__m512, __m512);
+			extern __m512 __cdecl _mm512_max_ps(__m512, __m512);
+			extern __m512 __cdecl _mm512_roundscale_ps(__m512, int);
+			extern __m512 __cdecl _mm512_setzero_ps(void);
+			extern __m512 __cdecl _mm512_set1_ps(float);
+			extern __m512 __cdecl _mm512_load_ps(const void *);
+			extern __m512 __cdecl _mm512_loadu_ps(const void *);
+			extern __m512 __cdecl _mm512_maskz_loadu_ps(__mmask16, const void *);
+			extern void __cdecl _mm512_store_ps(void *, __m512);
+			extern void __cdecl _mm512_storeu_ps(void *, __m512);
+			extern void __cdecl _mm512_mask_storeu_ps(void *, __mmask16, __m512);
+			extern __m512 __cdecl _mm512_maskz_compress_ps(__mmask16, __m512);
+			extern void __cdecl _mm512_mask_compressstoreu_ps(void *, __mmask16, __m512);
+			extern __m512 __cdecl _mm512_maskz_expand_ps(__mmask16, __m512);
+			extern __m512 __cdecl _mm512_maskz_expandloadu_ps(__mmask16, const void *);
+			extern __m512 __cdecl _mm512_mask_blend_ps(__mmask16, __m512, __m512);
+			extern __m512 __cdecl _mm512_shuffle_ps(__m512, __m512, int);
+			extern __m512 __cdecl _mm512_permutex2var_ps(__m512, __m512i, __m512);
+			extern __m512i __cdecl _mm512_load_si512(const void *);
+			extern __mmask16 __cdecl _mm512_cmp_ps_mask(__m512, __m512, int);
+			extern __m512i __cdecl _mm512_and_si512(__m512i, __m512i);
+			extern __m512i __cdecl _mm512_andnot_si512(__m512i, __m512i);
+			extern __m512i __cdecl _mm512_or_si512(__m512i, __m512i);
+			extern __m512i __cdecl _mm512_xor_si512(__m512i, __m512i);
+			extern __m512 __cdecl _mm512_castsi512_ps(__m512i);
+			extern __m512i __cdecl _mm512_castps_si512(__m512);
+			extern __m512d __cdecl _mm512_castps_pd(__m512);
+			extern __m512 __cdecl _mm512_castpd_ps(__m512d);
+			extern __m256 __cdecl _mm512_castps512_ps256(__m512);
+			extern __m512d __cdecl _mm512_castpd256_pd512(__m256d);
+			extern __m512d __cdecl _mm512_insertf64x4(__m512d, __m256d, int);
+			extern __m256d __cdecl _mm512_extractf64x4_pd(__m512d, int);
+			extern __m256d __cdecl _mm256_castps_pd(__m256);
+			extern __m256 __cdecl _mm256_castpd_ps(__m256d);
+			extern __m512 __cdecl _mm512_cvtepi32_ps(__m512i);
+			extern __m512i __cdecl _mm512_cvtps_epi32(__m512);
+			extern __m512i __cdecl _mm512_cvttps_epi32(__m512);
+			extern float __cdecl _mm512_reduce_add_ps(__m512);
+			extern float __cdecl _mm512_reduce_min_ps(__m512);
+			extern float __cdecl _mm512_reduce_max_ps(__m512);
 		}
 
+		#define _CMP_NEQ_UQ				0x04
+		#define _CMP_GT_OQ				0x1E
+
 	#endif
 
 #else
@@ -260,6 +438,64 @@ namespace Terathon
 	};
 
 
+	struct hexv_float
+	{
+		#if defined(TERATHON_AVX512)
+
+			__m512		v;
+
+			hexv_float(__m512 m) {v = m;}
+
+			operator __m512&(void) {return (v);}
+			operator const __m512&(void) const {return (v);}
+			operator volatile __m512&(void) volatile {return (v);}
+			operator const volatile __m512&(void) const volatile {return (v);}
+
+		#else
+
+			exv_float	lo;
+			exv_float	hi;
+
+		#endif
+
+		inline hexv_float() = default;
+		inline hexv_float(const hexv_float&) = default;
+		inline hexv_float& operator =(const hexv_float&) = default;
+	};
+
+
+	struct vec_double
+	{
+		#if defined(TERATHON_AVX)
+
+			__m256d		v;
+
+			vec_double(__m256d m) {v = m;}
+
+			operator __m256d&(void) {return (v);}
+			operator const __m256d&(void) const {return (v);}
+			operator volatile __m256d&(void) volatile {return (v);}
+			operator const volatile __m256d&(void) const volatile {return (v);}
+
+		#elif defined(TERATHON_SSE)
+
+			__m128d		lo;
+			__m128d		hi;
+
+			vec_double(__m128d a, __m128d b) {lo = a; hi = b;}
+
+		#else
+
+			double		v[4];
+
+		#endif
+
+		inline vec_double() = default;
+		inline vec_double(const vec_double&) = default;
+		inline vec_double& operator =(const vec_double&) = default;
+	};
+
+
 	#if defined(TERATHON_SSE)
 
 		typedef __m128i vec_int8;
@@ -289,9 +525,56 @@ namespace Terathon
 		typedef __m256i exv_uint16;
 		typedef __m256i exv_uint32;
 
+	#else
+
+		struct exv_int32
+		{
+			int32		v[8];
+		};
+
+	#endif
+
+	#if defined(TERATHON_AVX512)
+
+		typedef __m512i hexv_int32;
+		typedef __mmask16 hexv_mask;
+
+	#else
+
+		struct hexv_int32
+		{
+			exv_int32	lo;
+			exv_int32	hi;
+		};
+
+		typedef uint16 hexv_mask;
+
 	#endif
 
 
+	enum : uint32
+	{
+		kSimdFeatureSse2		= 1 << 0,
+		kSimdFeatureSse41		= 1 << 1,
+		kSimdFeatureAvx			= 1 << 2,
+		kSimdFeatureAvx2		= 1 << 3,
+		kSimdFeatureFma			= 1 << 4,
+		kSimdFeatureAvx512		= 1 << 5,
+		kSimdFeatureNeon		= 1 << 6
+	};
+
+
+	TERATHON_API uint32 SimdGetFeatures(void);
+
+
+	// SimdGetRequiredFeatures() returns the features that the library itself was compiled to require, and
+	// SimdGetDispatchFeatures() returns the features required by the kernels selected at run time, which
+	// can be more than the compiled features when the AVX2 or AVX-512 variant objects are linked in.
+
+	TERATHON_API uint32 SimdGetRequiredFeatures(void);
+	TERATHON_API uint32 SimdGetDispatchFeatures(void);
+	TERATHON_API bool SimdCheckFeatures(void);
+
 	inline void SimdInit(void)
 	{
 		#if defined(TERATHON_SSE)
@@ -473,6 +756,21 @@ namespace Terathon
 		#endif
 	}
 
+	inline vec_float VecLoad3D(const float *ptr)
+	{
+		// Loads three floats without reading past them, and sets the w component to zero.
+
+		#if defined(TERATHON_SSE)
+
+			return (_mm_movelh_ps(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(ptr))), _mm_load_ss(ptr + 2)));
+
+		#elif defined(TERATHON_NEON)
+
+			return (vcombine_f32(vld1_f32(ptr), vld1_lane_f32(ptr + 2, vdup_n_f32(0.0F), 0)));
+
+		#endif
+	}
+
 	inline void VecStore(const vec_float& v, float *ptr)
 	{
 		#if defined(TERATHON_SSE)
@@ -499,6 +797,28 @@ namespace Terathon
 		#endif
 	}
 
+	inline void VecStoreNontemporal(const vec_float& v, float *ptr)
+	{
+		#if defined(TERATHON_SSE)
+
+			_mm_stream_ps(ptr, v);
+
+		#elif defined(TERATHON_NEON)
+
+			vst1q_f32(ptr, v);
+
+		#endif
+	}
+
+	inline void VecStoreFence(void)
+	{
+		#if defined(TERATHON_SSE)
+
+			_mm_sfence();
+
+		#endif
+	}
+
 	inline void VecStoreX(const vec_float& v, float *ptr)
 	{
 		#if defined(TERATHON_SSE4)
@@ -1895,6 +2215,47 @@ namespace Terathon
 		#endif
 	}
 
+	inline vec_float VecQuaternionProduct(const vec_float& q1, const vec_float& q2)
+	{
+		// Calculates the Hamilton product q1 * q2 for quaternions stored in (x, y, z, w) order.
+
+		#if defined(TERATHON_SSE)
+
+			alignas(16) static const uint32 sign[12] =
+			{
+				0x00000000, 0x80000000, 0x00000000, 0x80000000,
+				0x00000000, 0x00000000, 0x80000000, 0x80000000,
+				0x80000000, 0x00000000, 0x00000000, 0x80000000
+			};
+
+			const float *s = reinterpret_cast<const float *>(sign);
+
+			vec_float r = _mm_mul_ps(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(3, 3, 3, 3)), q2);
+			r = VecMadd(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(0, 0, 0, 0)), _mm_xor_ps(_mm_shuffle_ps(q2, q2, _MM_SHUFFLE(0, 1, 2, 3)), _mm_load_ps(s)), r);
+			r = VecMadd(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(1, 1, 1, 1)), _mm_xor_ps(_mm_shuffle_ps(q2, q2, _MM_SHUFFLE(1, 0, 3, 2)), _mm_load_ps(s + 4)), r);
+			return (VecMadd(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(2, 2, 2, 2)), _mm_xor_ps(_mm_shuffle_ps(q2, q2, _MM_SHUFFLE(2, 3, 0, 1)), _mm_load_ps(s + 8)), r));
+
+		#elif defined(TERATHON_NEON)
+
+			static const uint32 sign[12] =
+			{
+				0x00000000, 0x80000000, 0x00000000, 0x80000000,
+				0x00000000, 0x00000000, 0x80000000, 0x80000000,
+				0x80000000, 0x00000000, 0x00000000, 0x80000000
+			};
+
+			vec_float yxwz = vrev64q_f32(q2);
+			vec_float wzyx = vextq_f32(yxwz, yxwz, 2);
+			vec_float zwxy = vextq_f32(q2, q2, 2);
+
+			vec_float r = vmulq_laneq_f32(q2, q1, 3);
+			r = vfmaq_laneq_f32(r, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(wzyx), vld1q_u32(sign))), q1, 0);
+			r = vfmaq_laneq_f32(r, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(zwxy), vld1q_u32(sign + 4))), q1, 1);
+			return (vfmaq_laneq_f32(r, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(yxwz), vld1q_u32(sign + 8))), q1, 2));
+
+		#endif
+	}
+
 	inline vec_float VecTransformVector3D(const vec_float& c1, const vec_float& c2, const vec_float& c3, const vec_float& v)
 	{
 		#if defined(TERATHON_SSE)
@@ -1930,6 +2291,125 @@ namespace Terathon
 		#endif
 	}
 
+	inline vec_float VecTransformVector4D(const vec_float& c1, const vec_float& c2, const vec_float& c3, const vec_float& c4, const vec_float& v)
+	{
+		#if defined(TERATHON_SSE)
+
+			vec_float result = _mm_mul_ps(c1, VecSmearX(v));
+			result = _mm_add_ps(result, _mm_mul_ps(c2, VecSmearY(v)));
+			result = _mm_add_ps(result, _mm_mul_ps(c3, VecSmearZ(v)));
+			return (_mm_add_ps(result, _mm_mul_ps(c4, VecSmearW(v))));
+
+		#elif defined(TERATHON_NEON)
+
+			vec_float result = vmulq_f32(c1, VecSmearX(v));
+			result = vfmaq_f32(result, c2, VecSmearY(v));
+			result = vfmaq_f32(result, c3, VecSmearZ(v));
+			return (vfmaq_f32(result, c4, VecSmearW(v)));
+
+		#endif
+	}
+
+	inline vec_float VecLoadPairs(const float *ptr1, const float *ptr2)
+	{
+		#if defined(TERATHON_SSE)
+
+			__m128i a = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(ptr1));
+			__m128i b = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(ptr2));
+			return (_mm_castsi128_ps(_mm_unpacklo_epi64(a, b)));
+
+		#elif defined(TERATHON_NEON)
+
+			return (vcombine_f32(vld1_f32(ptr1), vld1_f32(ptr2)));
+
+		#endif
+	}
+
+	inline void VecDeinterleave2D(const vec_float& a, const vec_float& b, vec_float *x, vec_float *y)
+	{
+		#if defined(TERATHON_SSE)
+
+			*x = VecShuffle<2,0,2,0>(a, b);
+			*y = VecShuffle<3,1,3,1>(a, b);
+
+		#elif defined(TERATHON_NEON)
+
+			float32x4x2_t v = vuzpq_f32(a, b);
+			*x = v.val[0];
+			*y = v.val[1];
+
+		#endif
+	}
+
+	inline void VecLoadDeinterleave3D(const float *ptr, vec_float *x, vec_float *y, vec_float *z)
+	{
+		#if defined(TERATHON_SSE)
+
+			vec_float a = _mm_loadu_ps(ptr);
+			vec_float b = _mm_loadu_ps(ptr + 4);
+			vec_float c = _mm_loadu_ps(ptr + 8);
+
+			*x = VecShuffle<2,0,3,0>(a, VecShuffle<1,1,2,2>(b, c));
+			*y = VecShuffle<2,0,2,0>(VecShuffle<0,0,1,1>(a, b), VecShuffle<2,2,3,3>(b, c));
+			*z = VecShuffle<2,0,2,0>(VecShuffle<1,1,2,2>(a, b), VecShuffle<3,3,0,0>(c, c));
+
+		#elif defined(TERATHON_NEON)
+
+			float32x4x3_t v = vld3q_f32(ptr);
+			*x = v.val[0];
+			*y = v.val[1];
+			*z = v.val[2];
+
+		#endif
+	}
+
+	inline void VecStoreInterleave3D(const vec_float& x, const vec_float& y, const vec_float& z, float *ptr)
+	{
+		#if defined(TERATHON_SSE)
+
+			_mm_storeu_ps(ptr, VecShuffle<2,0,2,0>(VecShuffle<0,0,0,0>(x, y), VecShuffle<1,1,0,0>(z, x)));
+			_mm_storeu_ps(ptr + 4, VecShuffle<2,0,2,0>(VecShuffle<1,1,1,1>(y, z), VecShuffle<2,2,2,2>(x, y)));
+			_mm_storeu_ps(ptr + 8, VecShuffle<2,0,2,0>(VecShuffle<3,3,2,2>(z, x), VecShuffle<3,3,3,3>(y, z)));
+
+		#elif defined(TERATHON_NEON)
+
+			float32x4x3_t	v;
+
+			v.val[0] = x;
+			v.val[1] = y;
+			v.val[2] = z;
+			vst3q_f32(ptr, v);
+
+		#endif
+	}
+
+	inline void VecTranspose4D(const vec_float& a, const vec_float& b, const vec_float& c, const vec_float& d, vec_float *x, vec_float *y, vec_float *z, vec_float *w)
+	{
+		#if defined(TERATHON_SSE)
+
+			vec_float t0 = VecShuffle<1,0,1,0>(a, b);
+			vec_float t1 = VecShuffle<3,2,3,2>(a, b);
+			vec_float t2 = VecShuffle<1,0,1,0>(c, d);
+			vec_float t3 = VecShuffle<3,2,3,2>(c, d);
+
+			*x = VecShuffle<2,0,2,0>(t0, t2);
+			*y = VecShuffle<3,1,3,1>(t0, t2);
+			*z = VecShuffle<2,0,2,0>(t1, t3);
+			*w = VecShuffle<3,1,3,1>(t1, t3);
+
+		#elif defined(TERATHON_NEON)
+
+			float32x4x2_t t0 = vtrnq_f32(a, b);
+			float32x4x2_t t1 = vtrnq_f32(c, d);
+
+			*x = vcombine_f32(vget_low_f32(t0.val[0]), vget_low_f32(t1.val[0]));
+			*y = vcombine_f32(vget_low_f32(t0.val[1]), vget_low_f32(t1.val[1]));
+			*z = vcombine_f32(vget_high_f32(t0.val[0]), vget_high_f32(t1.val[0]));
+			*w = vcombine_f32(vget_high_f32(t0.val[1]), vget_high_f32(t1.val[1]));
+
+		#endif
+	}
+
 	inline vec_int8 VecInt8GetZero(void)
 	{
 		#if defined(TERATHON_SSE)
@@ -2392,6 +2872,19 @@ namespace Terathon
 		#endif
 	}
 
+	inline vec_int32 VecFloatAsInt32(const vec_float& v)
+	{
+		#if defined(TERATHON_SSE)
+
+			return (_mm_castps_si128(v));
+
+		#elif defined(TERATHON_NEON)
+
+			return (vreinterpretq_s32_f32(v));
+
+		#endif
+	}
+
 	inline vec_int32 VecInt32Add(const vec_int32& v1, const vec_int32& v2)
 	{
 		#if defined(TERATHON_SSE)
@@ -2418,105 +2911,2584 @@ namespace Terathon
 		#endif
 	}
 
-	#if defined(TERATHON_AVX)
+	inline vec_double VecDoubleGetZero(void)
+	{
+		#if defined(TERATHON_AVX)
 
-		inline exv_float ExvFloat(const vec_float& v1, const vec_float& v2)
-		{
-			return (_mm256_insertf128_ps(_mm256_castps128_ps256(v1), v2, 1));
-		}
+			return (_mm256_setzero_pd());
 
-		inline exv_float ExvFloatGetZero(void)
-		{
-			return (_mm256_setzero_ps());
-		}
+		#elif defined(TERATHON_SSE)
 
-		inline exv_float ExvFloatGetMinusZero(void)
-		{
-			alignas(32) static const uint32 float_80000000[8] = {0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000};
-			return (_mm256_load_ps(reinterpret_cast<const float *>(float_80000000)));
-		}
+			return (vec_double(_mm_setzero_pd(), _mm_setzero_pd()));
 
-		inline exv_float ExvSmearX(const exv_float& v)
-		{
-			return (_mm256_permute_ps(v, 0x00));
-		}
+		#else
 
-		inline exv_float ExvSmearY(const exv_float& v)
-		{
-			return (_mm256_permute_ps(v, 0x55));
-		}
+			vec_double	result;
 
-		inline exv_float ExvSmearZ(const exv_float& v)
-		{
-			return (_mm256_permute_ps(v, 0xAA));
-		}
+			for (machine i = 0; i < 4; i++) result.v[i] = 0.0;
+			return (result);
 
-		inline exv_float ExvSmearW(const exv_float& v)
-		{
-			return (_mm256_permute_ps(v, 0xFF));
-		}
+		#endif
+	}
 
-		inline exv_float ExvSmearVecLo(const exv_float& v)
-		{
-			return (_mm256_permute2f128_ps(v, v, 0x00));
-		}
+	inline vec_double VecDoubleLoad(const double *ptr)
+	{
+		#if defined(TERATHON_AVX)
 
-		inline exv_float ExvSmearVecHi(const exv_float& v)
-		{
-			return (_mm256_permute2f128_ps(v, v, 0x11));
-		}
+			return (_mm256_load_pd(ptr));
 
-		inline exv_float ExvLoad(const float *ptr)
-		{
-			return (_mm256_load_ps(ptr));
-		}
+		#elif defined(TERATHON_SSE)
 
-		inline exv_float ExvLoadSmearScalar(const float *ptr)
-		{
-			return (_mm256_broadcast_ss(ptr));
-		}
+			return (vec_double(_mm_load_pd(ptr), _mm_load_pd(ptr + 2)));
 
-		inline void ExvStore(const exv_float& v, float *ptr)
-		{
-			_mm256_store_ps(ptr, v);
-		}
+		#else
 
-		inline void ExvStoreX(const exv_float& v, float *ptr)
-		{
-			_mm_store_ss(ptr, _mm256_castps256_ps128(v));
-		}
+			vec_double	result;
 
-		inline void ExvStoreY(const exv_float& v, float *ptr)
-		{
-			_mm_store_ss(ptr, _mm256_castps256_ps128(_mm256_permute_ps(v, 0x55)));
-		}
+			for (machine i = 0; i < 4; i++) result.v[i] = ptr[i];
+			return (result);
 
-		inline void ExvStoreZ(const exv_float& v, float *ptr)
-		{
-			_mm_store_ss(ptr, _mm256_castps256_ps128(_mm256_permute_ps(v, 0xAA)));
+		#endif
+	}
+
+	inline vec_double VecDoubleLoadUnaligned(const double *ptr)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_loadu_pd(ptr));
+
+		#elif defined(TERATHON_SSE)
+
+			return (vec_double(_mm_loadu_pd(ptr), _mm_loadu_pd(ptr + 2)));
+
+		#else
+
+			return (VecDoubleLoad(ptr));
+
+		#endif
+	}
+
+	inline vec_double VecDoubleLoad3D(const double *ptr)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd(ptr)), _mm_load_sd(ptr + 2), 1));
+
+		#elif defined(TERATHON_SSE)
+
+			return (vec_double(_mm_loadu_pd(ptr), _mm_load_sd(ptr + 2)));
+
+		#else
+
+			vec_double	result;
+
+			result.v[0] = ptr[0];
+			result.v[1] = ptr[1];
+			result.v[2] = ptr[2];
+			result.v[3] = 0.0;
+			return (result);
+
+		#endif
+	}
+
+	inline vec_double VecDoubleLoadSmearScalar(const double *ptr)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_broadcast_sd(ptr));
+
+		#elif defined(TERATHON_SSE)
+
+			__m128d v = _mm_load1_pd(ptr);
+			return (vec_double(v, v));
+
+		#else
+
+			vec_double	result;
+
+			for (machine i = 0; i < 4; i++) result.v[i] = ptr[0];
+			return (result);
+
+		#endif
+	}
+
+	inline void VecDoubleStore(const vec_double& v, double *ptr)
+	{
+		#if defined(TERATHON_AVX)
+
+			_mm256_store_pd(ptr, v);
+
+		#elif defined(TERATHON_SSE)
+
+			_mm_store_pd(ptr, v.lo);
+			_mm_store_pd(ptr + 2, v.hi);
+
+		#else
+
+			for (machine i = 0; i < 4; i++) ptr[i] = v.v[i];
+
+		#endif
+	}
+
+	inline void VecDoubleStoreUnaligned(const vec_double& v, double *ptr)
+	{
+		#if defined(TERATHON_AVX)
+
+			_mm256_storeu_pd(ptr, v);
+
+		#elif defined(TERATHON_SSE)
+
+			_mm_storeu_pd(ptr, v.lo);
+			_mm_storeu_pd(ptr + 2, v.hi);
+
+		#else
+
+			VecDoubleStore(v, ptr);
+
+		#endif
+	}
+
+	inline void VecDoubleStore3D(const vec_double& v, double *ptr)
+	{
+		#if defined(TERATHON_AVX)
+
+			_mm_storeu_pd(ptr, _mm256_castpd256_pd128(v));
+			_mm_store_sd(ptr + 2, _mm256_extractf128_pd(v, 1));
+
+		#elif defined(TERATHON_SSE)
+
+			_mm_storeu_pd(ptr, v.lo);
+			_mm_store_sd(ptr + 2, v.hi);
+
+		#else
+
+			ptr[0] = v.v[0];
+			ptr[1] = v.v[1];
+			ptr[2] = v.v[2];
+
+		#endif
+	}
+
+	inline vec_double VecDoubleSmearX(const vec_double& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_permute_pd(_mm256_permute2f128_pd(v, v, 0x00), 0x00));
+
+		#elif defined(TERATHON_SSE)
+
+			__m128d x = _mm_unpacklo_pd(v.lo, v.lo);
+			return (vec_double(x, x));
+
+		#else
+
+			vec_double	result;
+
+			for (machine i = 0; i < 4; i++) result.v[i] = v.v[0];
+			return (result);
+
+		#endif
+	}
+
+	inline vec_double VecDoubleSmearY(const vec_double& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_permute_pd(_mm256_permute2f128_pd(v, v, 0x00), 0x0F));
+
+		#elif defined(TERATHON_SSE)
+
+			__m128d y = _mm_unpackhi_pd(v.lo, v.lo);
+			return (vec_double(y, y));
+
+		#else
+
+			vec_double	result;
+
+			for (machine i = 0; i < 4; i++) result.v[i] = v.v[1];
+			return (result);
+
+		#endif
+	}
+
+	inline vec_double VecDoubleSmearZ(const vec_double& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_permute_pd(_mm256_permute2f128_pd(v, v, 0x11), 0x00));
+
+		#elif defined(TERATHON_SSE)
+
+			__m128d z = _mm_unpacklo_pd(v.hi, v.hi);
+			return (vec_double(z, z));
+
+		#else
+
+			vec_double	result;
+
+			for (machine i = 0; i < 4; i++) result.v[i] = v.v[2];
+			return (result);
+
+		#endif
+	}
+
+	inline vec_double VecDoubleSmearW(const vec_double& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_permute_pd(_mm256_permute2f128_pd(v, v, 0x11), 0x0F));
+
+		#elif defined(TERATHON_SSE)
+
+			__m128d w = _mm_unpackhi_pd(v.hi, v.hi);
+			return (vec_double(w, w));
+
+		#else
+
+			vec_double	result;
+
+			for (machine i = 0; i < 4; i++) result.v[i] = v.v[3];
+			return (result);
+
+		#endif
+	}
+
+	inline vec_double VecFloatConvertDouble(const vec_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_cvtps_pd(v));
+
+		#elif defined(TERATHON_SSE)
+
+			return (vec_double(_mm_cvtps_pd(v), _mm_cvtps_pd(_mm_movehl_ps(v, v))));
+
+		#else
+
+			vec_double		result;
+			float			f[4];
+
+			VecStoreUnaligned(v, f);
+			for (machine i = 0; i < 4; i++) result.v[i] = double(f[i]);
+			return (result);
+
+		#endif
+	}
+
+	inline vec_float VecDoubleConvertFloat(const vec_double& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_cvtpd_ps(v));
+
+		#elif defined(TERATHON_SSE)
+
+			return (_mm_movelh_ps(_mm_cvtpd_ps(v.lo), _mm_cvtpd_ps(v.hi)));
+
+		#else
+
+			float	f[4];
+
+			for (machine i = 0; i < 4; i++) f[i] = float(v.v[i]);
+			return (VecLoadUnaligned(f));
+
+		#endif
+	}
+
+	inline vec_double VecDoubleNegate(const vec_double& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_sub_pd(_mm256_setzero_pd(), v));
+
+		#elif defined(TERATHON_SSE)
+
+			return (vec_double(_mm_sub_pd(_mm_setzero_pd(), v.lo), _mm_sub_pd(_mm_setzero_pd(), v.hi)));
+
+		#else
+
+			vec_double	result;
+
+			for (machine i = 0; i < 4; i++) result.v[i] = -v.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline vec_double VecDoubleMin(const vec_double& v1, const vec_double& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_min_pd(v1, v2));
+
+		#elif defined(TERATHON_SSE)
+
+			return (vec_double(_mm_min_pd(v1.lo, v2.lo), _mm_min_pd(v1.hi, v2.hi)));
+
+		#else
+
+			vec_double	result;
+
+			for (machine i = 0; i < 4; i++) result.v[i] = (v1.v[i] < v2.v[i]) ? v1.v[i] : v2.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline vec_double VecDoubleMax(const vec_double& v1, const vec_double& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_max_pd(v1, v2));
+
+		#elif defined(TERATHON_SSE)
+
+			return (vec_double(_mm_max_pd(v1.lo, v2.lo), _mm_max_pd(v1.hi, v2.hi)));
+
+		#else
+
+			vec_double	result;
+
+			for (machine i = 0; i < 4; i++) result.v[i] = (v1.v[i] > v2.v[i]) ? v1.v[i] : v2.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline vec_double VecDoubleAdd(const vec_double& v1, const vec_double& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_add_pd(v1, v2));
+
+		#elif defined(TERATHON_SSE)
+
+			return (vec_double(_mm_add_pd(v1.lo, v2.lo), _mm_add_pd(v1.hi, v2.hi)));
+
+		#else
+
+			vec_double	result;
+
+			for (machine i = 0; i < 4; i++) result.v[i] = v1.v[i] + v2.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline vec_double VecDoubleSub(const vec_double& v1, const vec_double& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_sub_pd(v1, v2));
+
+		#elif defined(TERATHON_SSE)
+
+			return (vec_double(_mm_sub_pd(v1.lo, v2.lo), _mm_sub_pd(v1.hi, v2.hi)));
+
+		#else
+
+			vec_double	result;
+
+			for (machine i = 0; i < 4; i++) result.v[i] = v1.v[i] - v2.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline vec_double VecDoubleMul(const vec_double& v1, const vec_double& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_mul_pd(v1, v2));
+
+		#elif defined(TERATHON_SSE)
+
+			return (vec_double(_mm_mul_pd(v1.lo, v2.lo), _mm_mul_pd(v1.hi, v2.hi)));
+
+		#else
+
+			vec_double	result;
+
+			for (machine i = 0; i < 4; i++) result.v[i] = v1.v[i] * v2.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline vec_double VecDoubleMadd(const vec_double& v1, const vec_double& v2, const vec_double& v3)
+	{
+		#if defined(TERATHON_AVX)
+
+			#if defined(TERATHON_FMA)
+
+				return (_mm256_fmadd_pd(v1, v2, v3));
+
+			#else
+
+				return (_mm256_add_pd(_mm256_mul_pd(v1, v2), v3));
+
+			#endif
+
+		#elif defined(TERATHON_SSE)
+
+			#if defined(TERATHON_FMA)
+
+				return (vec_double(_mm_fmadd_pd(v1.lo, v2.lo, v3.lo), _mm_fmadd_pd(v1.hi, v2.hi, v3.hi)));
+
+			#else
+
+				return (vec_double(_mm_add_pd(_mm_mul_pd(v1.lo, v2.lo), v3.lo), _mm_add_pd(_mm_mul_pd(v1.hi, v2.hi), v3.hi)));
+
+			#endif
+
+		#else
+
+			vec_double	result;
+
+			for (machine i = 0; i < 4; i++) result.v[i] = v1.v[i] * v2.v[i] + v3.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline vec_double VecDoubleNmsub(const vec_double& v1, const vec_double& v2, const vec_double& v3)
+	{
+		#if defined(TERATHON_AVX)
+
+			#if defined(TERATHON_FMA)
+
+				return (_mm256_fnmadd_pd(v1, v2, v3));
+
+			#else
+
+				return (_mm256_sub_pd(v3, _mm256_mul_pd(v1, v2)));
+
+			#endif
+
+		#elif defined(TERATHON_SSE)
+
+			#if defined(TERATHON_FMA)
+
+				return (vec_double(_mm_fnmadd_pd(v1.lo, v2.lo, v3.lo), _mm_fnmadd_pd(v1.hi, v2.hi, v3.hi)));
+
+			#else
+
+				return (vec_double(_mm_sub_pd(v3.lo, _mm_mul_pd(v1.lo, v2.lo)), _mm_sub_pd(v3.hi, _mm_mul_pd(v1.hi, v2.hi))));
+
+			#endif
+
+		#else
+
+			vec_double	result;
+
+			for (machine i = 0; i < 4; i++) result.v[i] = v3.v[i] - v1.v[i] * v2.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline vec_double VecDoubleDiv(const vec_double& v1, const vec_double& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_div_pd(v1, v2));
+
+		#elif defined(TERATHON_SSE)
+
+			return (vec_double(_mm_div_pd(v1.lo, v2.lo), _mm_div_pd(v1.hi, v2.hi)));
+
+		#else
+
+			vec_double	result;
+
+			for (machine i = 0; i < 4; i++) result.v[i] = v1.v[i] / v2.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline vec_double operator -(const vec_double& v)
+	{
+		return (VecDoubleNegate(v));
+	}
+
+	inline vec_double operator +(const vec_double& v1, const vec_double& v2)
+	{
+		return (VecDoubleAdd(v1, v2));
+	}
+
+	inline vec_double operator -(const vec_double& v1, const vec_double& v2)
+	{
+		return (VecDoubleSub(v1, v2));
+	}
+
+	inline vec_double operator *(const vec_double& v1, const vec_double& v2)
+	{
+		return (VecDoubleMul(v1, v2));
+	}
+
+	inline vec_double operator /(const vec_double& v1, const vec_double& v2)
+	{
+		return (VecDoubleDiv(v1, v2));
+	}
+
+	inline vec_double VecDoubleTransformVector3D(const vec_double& c1, const vec_double& c2, const vec_double& c3, const vec_double& v)
+	{
+		vec_double result = VecDoubleMul(c1, VecDoubleSmearX(v));
+		result = VecDoubleMadd(c2, VecDoubleSmearY(v), result);
+		return (VecDoubleMadd(c3, VecDoubleSmearZ(v), result));
+	}
+
+	inline vec_double VecDoubleTransformPoint3D(const vec_double& c1, const vec_double& c2, const vec_double& c3, const vec_double& c4, const vec_double& p)
+	{
+		vec_double result = VecDoubleMadd(c1, VecDoubleSmearX(p), c4);
+		result = VecDoubleMadd(c2, VecDoubleSmearY(p), result);
+		return (VecDoubleMadd(c3, VecDoubleSmearZ(p), result));
+	}
+
+	#if !defined(TERATHON_AVX)
+
+		inline uint32 ExvFloatToBits(float f)
+		{
+			uint32		u;
+
+			memcpy(&u, &f, 4);
+			return (u);
+		}
+
+		inline float ExvBitsToFloat(uint32 u)
+		{
+			float		f;
+
+			memcpy(&f, &u, 4);
+			return (f);
+		}
+
+	#endif
+
+	inline exv_float ExvFloat(const vec_float& v1, const vec_float& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_insertf128_ps(_mm256_castps128_ps256(v1), v2, 1));
+
+		#else
+
+			exv_float	result;
+
+			VecStoreUnaligned(v1, &result.v[0]);
+			VecStoreUnaligned(v2, &result.v[4]);
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvFloatGetZero(void)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_setzero_ps());
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = 0.0F;
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvFloatGetMinusZero(void)
+	{
+		#if defined(TERATHON_AVX)
+
+			alignas(32) static const uint32 float_80000000[8] = {0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000};
+			return (_mm256_load_ps(reinterpret_cast<const float *>(float_80000000)));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = -0.0F;
+			return (result);
+
+		#endif
+	}
+
+	template <uint32 value>
+	inline exv_float ExvLoadVectorConstant(void)
+	{
+		#if defined(TERATHON_AVX)
+
+			alignas(32) static const uint32 k[8] = {value, value, value, value, value, value, value, value};
+			return (_mm256_load_ps(reinterpret_cast<const float *>(k)));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = ExvBitsToFloat(value);
+			return (result);
+
+		#endif
+	}
+
+	inline vec_float ExvGetVecLo(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_castps256_ps128(v));
+
+		#else
+
+			return (VecLoadUnaligned(&v.v[0]));
+
+		#endif
+	}
+
+	inline vec_float ExvGetVecHi(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_extractf128_ps(v, 1));
+
+		#else
+
+			return (VecLoadUnaligned(&v.v[4]));
+
+		#endif
+	}
+
+	inline exv_float ExvSmearX(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_permute_ps(v, 0x00));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = v.v[i & 4];
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvSmearY(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_permute_ps(v, 0x55));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = v.v[(i & 4) + 1];
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvSmearZ(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_permute_ps(v, 0xAA));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = v.v[(i & 4) + 2];
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvSmearW(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_permute_ps(v, 0xFF));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = v.v[(i & 4) + 3];
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvSmearVecLo(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_permute2f128_ps(v, v, 0x00));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = v.v[i & 3];
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvSmearVecHi(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_permute2f128_ps(v, v, 0x11));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = v.v[(i & 3) + 4];
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvZeroVecLo(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_blend_ps(_mm256_setzero_ps(), v, 0xF0));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = (i < 4) ? 0.0F : v.v[i];
+			return (result);
+
+		#endif
+	}
+
+	template <int p3, int p2, int p1, int p0>
+	inline exv_float ExvShuffle(const exv_float& v1, const exv_float& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_shuffle_ps(v1, v2, _MM_SHUFFLE(p3, p2, p1, p0)));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i += 4)
+			{
+				result.v[i] = v1.v[i + p0];
+				result.v[i + 1] = v1.v[i + p1];
+				result.v[i + 2] = v2.v[i + p2];
+				result.v[i + 3] = v2.v[i + p3];
+			}
+
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvLoad(const float *ptr)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_load_ps(ptr));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = ptr[i];
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvLoadUnaligned(const float *ptr)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_loadu_ps(ptr));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = ptr[i];
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvLoadSmearScalar(const float *ptr)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_broadcast_ss(ptr));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = *ptr;
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvLoadSmearVec(const float *ptr)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_broadcast_ps(reinterpret_cast<const __m128 *>(ptr)));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = ptr[i & 3];
+			return (result);
+
+		#endif
+	}
+
+	inline void ExvStore(const exv_float& v, float *ptr)
+	{
+		#if defined(TERATHON_AVX)
+
+			_mm256_store_ps(ptr, v);
+
+		#else
+
+			for (machine i = 0; i < 8; i++) ptr[i] = v.v[i];
+
+		#endif
+	}
+
+	inline void ExvStoreUnaligned(const exv_float& v, float *ptr)
+	{
+		#if defined(TERATHON_AVX)
+
+			_mm256_storeu_ps(ptr, v);
+
+		#else
+
+			for (machine i = 0; i < 8; i++) ptr[i] = v.v[i];
+
+		#endif
+	}
+
+	inline void ExvStoreX(const exv_float& v, float *ptr)
+	{
+		#if defined(TERATHON_AVX)
+
+			_mm_store_ss(ptr, _mm256_castps256_ps128(v));
+
+		#else
+
+			*ptr = v.v[0];
+
+		#endif
+	}
+
+	inline void ExvStoreY(const exv_float& v, float *ptr)
+	{
+		#if defined(TERATHON_AVX)
+
+			_mm_store_ss(ptr, _mm256_castps256_ps128(_mm256_permute_ps(v, 0x55)));
+
+		#else
+
+			*ptr = v.v[1];
+
+		#endif
+	}
+
+	inline void ExvStoreZ(const exv_float& v, float *ptr)
+	{
+		#if defined(TERATHON_AVX)
+
+			_mm_store_ss(ptr, _mm256_castps256_ps128(_mm256_permute_ps(v, 0xAA)));
+
+		#else
+
+			*ptr = v.v[2];
+
+		#endif
+	}
+
+	inline void ExvStoreW(const exv_float& v, float *ptr)
+	{
+		#if defined(TERATHON_AVX)
+
+			_mm_store_ss(ptr, _mm256_castps256_ps128(_mm256_permute_ps(v, 0xFF)));
+
+		#else
+
+			*ptr = v.v[3];
+
+		#endif
+	}
+
+	inline void ExvStore3D(const exv_float& v, float *ptr1, float *ptr2)
+	{
+		VecStore3D(ExvGetVecLo(v), ptr1);
+		VecStore3D(ExvGetVecHi(v), ptr2);
+	}
+
+	inline int32 ExvTruncateConvert(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm_cvtt_ss2si(_mm256_castps256_ps128(v)));
+
+		#else
+
+			return (int32(v.v[0]));
+
+		#endif
+	}
+
+	inline exv_float ExvInt32ConvertFloat(const exv_int32& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_cvtepi32_ps(v));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = float(v.v[i]);
+			return (result);
+
+		#endif
+	}
+
+	inline exv_int32 ExvConvertInt32(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_cvtps_epi32(v));
+
+		#else
+
+			exv_int32	result;
+
+			for (machine i = 0; i < 8; i++)
+			{
+				float f = v.v[i];
+				result.v[i] = ((f < 4194304.0F) && (f > -4194304.0F)) ? int32((f + 12582912.0F) - 12582912.0F) : int32(f);
+			}
+
+			return (result);
+
+		#endif
+	}
+
+	inline exv_int32 ExvFloatAsInt32(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_castps_si256(v));
+
+		#else
+
+			exv_int32	result;
+
+			memcpy(result.v, v.v, 32);
+			return (result);
+
+		#endif
+	}
+
+	inline exv_int32 ExvTruncateConvertInt32(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_cvttps_epi32(v));
+
+		#else
+
+			exv_int32	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = int32(v.v[i]);
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvNegate(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_sub_ps(_mm256_setzero_ps(), v));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = 0.0F - v.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float operator -(const exv_float& v)
+	{
+		return (ExvNegate(v));
+	}
+
+	inline exv_float ExvMin(const exv_float& v1, const exv_float& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_min_ps(v1, v2));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = (v1.v[i] < v2.v[i]) ? v1.v[i] : v2.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvMax(const exv_float& v1, const exv_float& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_max_ps(v1, v2));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = (v1.v[i] > v2.v[i]) ? v1.v[i] : v2.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvAdd(const exv_float& v1, const exv_float& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_add_ps(v1, v2));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = v1.v[i] + v2.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float operator +(const exv_float& v1, const exv_float& v2)
+	{
+		return (ExvAdd(v1, v2));
+	}
+
+	inline exv_float ExvSub(const exv_float& v1, const exv_float& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_sub_ps(v1, v2));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = v1.v[i] - v2.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float operator -(const exv_float& v1, const exv_float& v2)
+	{
+		return (ExvSub(v1, v2));
+	}
+
+	inline exv_float ExvMul(const exv_float& v1, const exv_float& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_mul_ps(v1, v2));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = v1.v[i] * v2.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float operator *(const exv_float& v1, const exv_float& v2)
+	{
+		return (ExvMul(v1, v2));
+	}
+
+	inline exv_float ExvMadd(const exv_float& v1, const exv_float& v2, const exv_float& v3)
+	{
+		#if defined(TERATHON_FMA)
+
+			return (_mm256_fmadd_ps(v1, v2, v3));
+
+		#elif defined(TERATHON_AVX)
+
+			return (_mm256_add_ps(_mm256_mul_ps(v1, v2), v3));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = v1.v[i] * v2.v[i] + v3.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvNmsub(const exv_float& v1, const exv_float& v2, const exv_float& v3)
+	{
+		#if defined(TERATHON_FMA)
+
+			return (_mm256_fnmadd_ps(v1, v2, v3));
+
+		#elif defined(TERATHON_AVX)
+
+			return (_mm256_sub_ps(v3, _mm256_mul_ps(v1, v2)));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = v3.v[i] - v1.v[i] * v2.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvDiv(const exv_float& v1, const exv_float& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_div_ps(v1, v2));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = v1.v[i] / v2.v[i];
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float operator /(const exv_float& v1, const exv_float& v2)
+	{
+		return (ExvDiv(v1, v2));
+	}
+
+	inline exv_float ExvAnd(const exv_float& v1, const exv_float& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_and_ps(v1, v2));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = ExvBitsToFloat(ExvFloatToBits(v1.v[i]) & ExvFloatToBits(v2.v[i]));
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float operator &(const exv_float& v1, const exv_float& v2)
+	{
+		return (ExvAnd(v1, v2));
+	}
+
+	inline exv_float ExvAndc(const exv_float& v1, const exv_float& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_andnot_ps(v2, v1));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = ExvBitsToFloat(ExvFloatToBits(v1.v[i]) & ~ExvFloatToBits(v2.v[i]));
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvOr(const exv_float& v1, const exv_float& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_or_ps(v1, v2));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = ExvBitsToFloat(ExvFloatToBits(v1.v[i]) | ExvFloatToBits(v2.v[i]));
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float operator |(const exv_float& v1, const exv_float& v2)
+	{
+		return (ExvOr(v1, v2));
+	}
+
+	inline exv_float ExvXor(const exv_float& v1, const exv_float& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_xor_ps(v1, v2));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = ExvBitsToFloat(ExvFloatToBits(v1.v[i]) ^ ExvFloatToBits(v2.v[i]));
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float operator ^(const exv_float& v1, const exv_float& v2)
+	{
+		return (ExvXor(v1, v2));
+	}
+
+	inline exv_float ExvSelect(const exv_float& v1, const exv_float& v2, const exv_float& mask)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_or_ps(_mm256_andnot_ps(mask, v1), _mm256_and_ps(mask, v2)));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = ExvBitsToFloat((ExvFloatToBits(v1.v[i]) & ~ExvFloatToBits(mask.v[i])) | (ExvFloatToBits(v2.v[i]) & ExvFloatToBits(mask.v[i])));
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvMaskCmpeq(const exv_float& v1, const exv_float& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_cmp_ps(v1, v2, _CMP_EQ_OQ));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = ExvBitsToFloat(uint32(-int32(v1.v[i] == v2.v[i])));
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvMaskCmplt(const exv_float& v1, const exv_float& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_cmp_ps(v1, v2, _CMP_LT_OQ));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = ExvBitsToFloat(uint32(-int32(v1.v[i] < v2.v[i])));
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvMaskCmpgt(const exv_float& v1, const exv_float& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_cmp_ps(v2, v1, _CMP_LT_OQ));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++) result.v[i] = ExvBitsToFloat(uint32(-int32(v1.v[i] > v2.v[i])));
+			return (result);
+
+		#endif
+	}
+
+	inline int32 ExvMaskGetBits(const exv_float& mask)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_movemask_ps(mask));
+
+		#else
+
+			int32 result = 0;
+			for (machine i = 0; i < 8; i++) result |= int32(ExvFloatToBits(mask.v[i]) >> 31) << i;
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvInverseSqrt(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			const exv_float three = ExvLoadVectorConstant<0x40400000>();
+			const exv_float half = ExvLoadVectorConstant<0x3F000000>();
+
+			exv_float f = _mm256_rsqrt_ps(v);
+			return (_mm256_mul_ps(_mm256_mul_ps(_mm256_sub_ps(three, _mm256_mul_ps(v, _mm256_mul_ps(f, f))), f), half));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i++)
+			{
+				float x = v.v[i];
+				float r = ExvBitsToFloat(uint32(0x5F375A86 - (ExvFloatToBits(x) >> 1)));
+				r = (0.5F * r) * (3.0F - x * r * r);
+				r = (0.5F * r) * (3.0F - x * r * r);
+				result.v[i] = (0.5F * r) * (3.0F - x * r * r);
+			}
+
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvSqrt(const exv_float& v)
+	{
+		exv_float mask = ExvMaskCmpeq(v, ExvFloatGetZero());
+		return (ExvAndc(ExvMul(ExvInverseSqrt(v), v), mask));
+	}
+
+	inline exv_float ExvFloor(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_round_ps(v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+
+		#else
+
+			return (ExvFloat(VecFloor(ExvGetVecLo(v)), VecFloor(ExvGetVecHi(v))));
+
+		#endif
+	}
+
+	inline exv_float ExvCeil(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_round_ps(v, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+
+		#else
+
+			return (ExvFloat(VecCeil(ExvGetVecLo(v)), VecCeil(ExvGetVecHi(v))));
+
+		#endif
+	}
+
+	inline exv_float ExvPositiveFloor(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_round_ps(v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+
+		#else
+
+			return (ExvFloat(VecPositiveFloor(ExvGetVecLo(v)), VecPositiveFloor(ExvGetVecHi(v))));
+
+		#endif
+	}
+
+	inline exv_float ExvNegativeFloor(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_round_ps(v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+
+		#else
+
+			return (ExvFloat(VecNegativeFloor(ExvGetVecLo(v)), VecNegativeFloor(ExvGetVecHi(v))));
+
+		#endif
+	}
+
+	inline exv_float ExvPositiveCeil(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_round_ps(v, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+
+		#else
+
+			return (ExvFloat(VecPositiveCeil(ExvGetVecLo(v)), VecPositiveCeil(ExvGetVecHi(v))));
+
+		#endif
+	}
+
+	inline exv_float ExvNegativeCeil(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			return (_mm256_round_ps(v, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+
+		#else
+
+			return (ExvFloat(VecNegativeCeil(ExvGetVecLo(v)), VecNegativeCeil(ExvGetVecHi(v))));
+
+		#endif
+	}
+
+	inline void ExvFloorCeil(const exv_float& v, exv_float *f, exv_float *c)
+	{
+		*f = ExvFloor(v);
+		*c = ExvCeil(v);
+	}
+
+	inline exv_float ExvFsgn(const exv_float& v)
+	{
+		exv_float result = ExvLoadVectorConstant<0x3F800000>();
+		result = result | (ExvFloatGetMinusZero() & v);
+		return (ExvAndc(result, ExvMaskCmpeq(v, ExvFloatGetZero())));
+	}
+
+	inline exv_float ExvFnsgn(const exv_float& v)
+	{
+		exv_float result = ExvLoadVectorConstant<0x3F800000>();
+		result = result | ExvAndc(ExvFloatGetMinusZero(), v);
+		return (ExvAndc(result, ExvMaskCmpeq(v, ExvFloatGetZero())));
+	}
+
+	inline exv_float ExvNonzeroFsgn(const exv_float& v)
+	{
+		exv_float result = ExvLoadVectorConstant<0x3F800000>();
+		return (result | (ExvFloatGetMinusZero() & v));
+	}
+
+	inline exv_float ExvNonzeroFnsgn(const exv_float& v)
+	{
+		exv_float result = ExvLoadVectorConstant<0x3F800000>();
+		return (result | ExvAndc(ExvFloatGetMinusZero(), v));
+	}
+
+	inline exv_float ExvHorizontalSum3D(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			exv_float r = _mm256_blend_ps(v, _mm256_setzero_ps(), 0x88);
+			r = _mm256_hadd_ps(r, r);
+			return (_mm256_hadd_ps(r, r));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i += 4)
+			{
+				float s = v.v[i] + v.v[i + 1] + v.v[i + 2];
+				result.v[i] = result.v[i + 1] = result.v[i + 2] = result.v[i + 3] = s;
+			}
+
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvHorizontalSum4D(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			exv_float r = _mm256_hadd_ps(v, v);
+			return (_mm256_hadd_ps(r, r));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i += 4)
+			{
+				float s = v.v[i] + v.v[i + 1] + v.v[i + 2] + v.v[i + 3];
+				result.v[i] = result.v[i + 1] = result.v[i + 2] = result.v[i + 3] = s;
+			}
+
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvHorizontalSum(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			exv_float r = _mm256_add_ps(v, _mm256_permute2f128_ps(v, v, 0x01));
+			r = _mm256_hadd_ps(r, r);
+			return (_mm256_hadd_ps(r, r));
+
+		#else
+
+			exv_float	result;
+
+			float s = 0.0F;
+			for (machine i = 0; i < 8; i++) s += v.v[i];
+			for (machine i = 0; i < 8; i++) result.v[i] = s;
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvHorizontalMin(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			exv_float r = _mm256_min_ps(v, _mm256_permute2f128_ps(v, v, 0x01));
+			r = _mm256_min_ps(r, _mm256_permute_ps(r, 0x4E));
+			return (_mm256_min_ps(r, _mm256_permute_ps(r, 0xB1)));
+
+		#else
+
+			exv_float	result;
+
+			float m = v.v[0];
+			for (machine i = 1; i < 8; i++) m = (v.v[i] < m) ? v.v[i] : m;
+			for (machine i = 0; i < 8; i++) result.v[i] = m;
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvHorizontalMax(const exv_float& v)
+	{
+		#if defined(TERATHON_AVX)
+
+			exv_float r = _mm256_max_ps(v, _mm256_permute2f128_ps(v, v, 0x01));
+			r = _mm256_max_ps(r, _mm256_permute_ps(r, 0x4E));
+			return (_mm256_max_ps(r, _mm256_permute_ps(r, 0xB1)));
+
+		#else
+
+			exv_float	result;
+
+			float m = v.v[0];
+			for (machine i = 1; i < 8; i++) m = (v.v[i] > m) ? v.v[i] : m;
+			for (machine i = 0; i < 8; i++) result.v[i] = m;
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvDot3D(const exv_float& v1, const exv_float& v2)
+	{
+		return (ExvHorizontalSum3D(ExvMul(v1, v2)));
+	}
+
+	inline exv_float ExvDot4D(const exv_float& v1, const exv_float& v2)
+	{
+		return (ExvHorizontalSum4D(ExvMul(v1, v2)));
+	}
+
+	inline exv_float ExvPlaneDotPoint3D(const exv_float& v1, const exv_float& v2)
+	{
+		return (ExvHorizontalSum3D(ExvMul(v1, v2)) + ExvSmearW(v1));
+	}
+
+	inline exv_float ExvProject3D(const exv_float& v1, const exv_float& v2)
+	{
+		return (ExvMul(v2, ExvDot3D(v1, v2)));
+	}
+
+	inline exv_float ExvReject3D(const exv_float& v1, const exv_float& v2)
+	{
+		return (ExvNmsub(v2, ExvDot3D(v1, v2), v1));
+	}
+
+	inline exv_float ExvCross3D(const exv_float& v1, const exv_float& v2)
+	{
+		#if defined(TERATHON_AVX)
+
+			exv_float c = _mm256_mul_ps(v1, _mm256_permute_ps(v2, _MM_SHUFFLE(3, 0, 2, 1)));
+			c = _mm256_sub_ps(c, _mm256_mul_ps(_mm256_permute_ps(v1, _MM_SHUFFLE(3, 0, 2, 1)), v2));
+			return (_mm256_permute_ps(c, _MM_SHUFFLE(3, 0, 2, 1)));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i += 4)
+			{
+				result.v[i] = v1.v[i + 1] * v2.v[i + 2] - v1.v[i + 2] * v2.v[i + 1];
+				result.v[i + 1] = v1.v[i + 2] * v2.v[i] - v1.v[i] * v2.v[i + 2];
+				result.v[i + 2] = v1.v[i] * v2.v[i + 1] - v1.v[i + 1] * v2.v[i];
+				result.v[i + 3] = 0.0F;
+			}
+
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvQuaternionProduct(const exv_float& q1, const exv_float& q2)
+	{
+		// Calculates the Hamilton products q1 * q2 for the two pairs of quaternions
+		// stored in (x, y, z, w) order in the low and high halves.
+
+		#if defined(TERATHON_AVX)
+
+			alignas(32) static const uint32 sign[24] =
+			{
+				0x00000000, 0x80000000, 0x00000000, 0x80000000, 0x00000000, 0x80000000, 0x00000000, 0x80000000,
+				0x00000000, 0x00000000, 0x80000000, 0x80000000, 0x00000000, 0x00000000, 0x80000000, 0x80000000,
+				0x80000000, 0x00000000, 0x00000000, 0x80000000, 0x80000000, 0x00000000, 0x00000000, 0x80000000
+			};
+
+			const float *s = reinterpret_cast<const float *>(sign);
+
+			exv_float r = _mm256_mul_ps(_mm256_permute_ps(q1, _MM_SHUFFLE(3, 3, 3, 3)), q2);
+			r = ExvMadd(_mm256_permute_ps(q1, _MM_SHUFFLE(0, 0, 0, 0)), _mm256_xor_ps(_mm256_permute_ps(q2, _MM_SHUFFLE(0, 1, 2, 3)), _mm256_load_ps(s)), r);
+			r = ExvMadd(_mm256_permute_ps(q1, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_xor_ps(_mm256_permute_ps(q2, _MM_SHUFFLE(1, 0, 3, 2)), _mm256_load_ps(s + 8)), r);
+			return (ExvMadd(_mm256_permute_ps(q1, _MM_SHUFFLE(2, 2, 2, 2)), _mm256_xor_ps(_mm256_permute_ps(q2, _MM_SHUFFLE(2, 3, 0, 1)), _mm256_load_ps(s + 16)), r));
+
+		#else
+
+			exv_float	result;
+
+			for (machine i = 0; i < 8; i += 4)
+			{
+				const float *a = &q1.v[i];
+				const float *b = &q2.v[i];
+
+				result.v[i] = a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1];
+				result.v[i + 1] = a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0];
+				result.v[i + 2] = a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3];
+				result.v[i + 3] = a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2];
+			}
+
+			return (result);
+
+		#endif
+	}
+
+	inline exv_float ExvTransformVector3D(const exv_float& c1, const exv_float& c2, const exv_float& c3, const exv_float& v)
+	{
+		exv_float result = ExvMul(c1, ExvSmearX(v));
+		result = ExvMadd(c2, ExvSmearY(v), result);
+		return (ExvMadd(c3, ExvSmearZ(v), result));
+	}
+
+	inline exv_float ExvTransformPoint3D(const exv_float& c1, const exv_float& c2, const exv_float& c3, const exv_float& c4, const exv_float& p)
+	{
+		exv_float result = ExvMul(c1, ExvSmearX(p));
+		result = ExvMadd(c2, ExvSmearY(p), result);
+		result = ExvMadd(c3, ExvSmearZ(p), result);
+		return (ExvAdd(result, c4));
+	}
+
+	inline exv_float ExvTransformVector4D(const exv_float& c1, const exv_float& c2, const exv_float& c3, const exv_float& c4, const exv_float& v)
+	{
+		exv_float result = ExvMul(c1, ExvSmearX(v));
+		result = ExvMadd(c2, ExvSmearY(v), result);
+		result = ExvMadd(c3, ExvSmearZ(v), result);
+		return (ExvMadd(c4, ExvSmearW(v), result));
+	}
+
+	inline void ExvLoadDeinterleave3D(const float *ptr, exv_float *x, exv_float *y, exv_float *z)
+	{
+		#if defined(TERATHON_AVX)
+
+			exv_float a = ExvFloat(VecLoadUnaligned(ptr), VecLoadUnaligned(ptr + 12));
+			exv_float b = ExvFloat(VecLoadUnaligned(ptr + 4), VecLoadUnaligned(ptr + 16));
+			exv_float c = ExvFloat(VecLoadUnaligned(ptr + 8), VecLoadUnaligned(ptr + 20));
+
+			*x = ExvShuffle<2,0,3,0>(a, ExvShuffle<1,1,2,2>(b, c));
+			*y = ExvShuffle<2,0,2,0>(ExvShuffle<0,0,1,1>(a, b), ExvShuffle<2,2,3,3>(b, c));
+			*z = ExvShuffle<2,0,2,0>(ExvShuffle<1,1,2,2>(a, b), ExvShuffle<3,3,0,0>(c, c));
+
+		#else
+
+			for (machine i = 0; i < 8; i++)
+			{
+				x->v[i] = ptr[i * 3];
+				y->v[i] = ptr[i * 3 + 1];
+				z->v[i] = ptr[i * 3 + 2];
+			}
+
+		#endif
+	}
+
+	inline void ExvStoreInterleave3D(const exv_float& x, const exv_float& y, const exv_float& z, float *ptr)
+	{
+		#if defined(TERATHON_AVX)
+
+			exv_float a = ExvShuffle<2,0,2,0>(ExvShuffle<0,0,0,0>(x, y), ExvShuffle<1,1,0,0>(z, x));
+			exv_float b = ExvShuffle<2,0,2,0>(ExvShuffle<1,1,1,1>(y, z), ExvShuffle<2,2,2,2>(x, y));
+			exv_float c = ExvShuffle<2,0,2,0>(ExvShuffle<3,3,2,2>(z, x), ExvShuffle<3,3,3,3>(y, z));
+
+			VecStoreUnaligned(ExvGetVecLo(a), ptr);
+			VecStoreUnaligned(ExvGetVecLo(b), ptr + 4);
+			VecStoreUnaligned(ExvGetVecLo(c), ptr + 8);
+			VecStoreUnaligned(ExvGetVecHi(a), ptr + 12);
+			VecStoreUnaligned(ExvGetVecHi(b), ptr + 16);
+			VecStoreUnaligned(ExvGetVecHi(c), ptr + 20);
+
+		#else
+
+			for (machine i = 0; i < 8; i++)
+			{
+				ptr[i * 3] = x.v[i];
+				ptr[i * 3 + 1] = y.v[i];
+				ptr[i * 3 + 2] = z.v[i];
+			}
+
+		#endif
+	}
+
+	inline void ExvTranspose4D(const exv_float& a, const exv_float& b, const exv_float& c, const exv_float& d, exv_float *x, exv_float *y, exv_float *z, exv_float *w)
+	{
+		exv_float t0 = ExvShuffle<1,0,1,0>(a, b);
+		exv_float t1 = ExvShuffle<3,2,3,2>(a, b);
+		exv_float t2 = ExvShuffle<1,0,1,0>(c, d);
+		exv_float t3 = ExvShuffle<3,2,3,2>(c, d);
+
+		*x = ExvShuffle<2,0,2,0>(t0, t2);
+		*y = ExvShuffle<3,1,3,1>(t0, t2);
+		*z = ExvShuffle<2,0,2,0>(t1, t3);
+		*w = ExvShuffle<3,1,3,1>(t1, t3);
+	}
+
+	#if !defined(TERATHON_AVX512)
+
+		inline exv_float HexvGetExvMask(uint32 bits)
+		{
+			uint32		m[8];
+			float		f[8];
+
+			for (machine i = 0; i < 8; i++) m[i] = 0U - ((bits >> i) & 1);
+			memcpy(f, m, 32);
+			return (ExvLoadUnaligned(f));
 		}
 
-		inline void ExvStoreW(const exv_float& v, float *ptr)
-		{
-			_mm_store_ss(ptr, _mm256_castps256_ps128(_mm256_permute_ps(v, 0xFF)));
-		}
+	#endif
+
+	inline hexv_float HexvFloat(const exv_float& v1, const exv_float& v2)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_castpd_ps(_mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(v1)), _mm256_castps_pd(v2), 1)));
+
+		#else
+
+			hexv_float	result;
+
+			result.lo = v1;
+			result.hi = v2;
+			return (result);
+
+		#endif
+	}
+
+	inline hexv_float HexvFloatGetZero(void)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_setzero_ps());
+
+		#else
+
+			return (HexvFloat(ExvFloatGetZero(), ExvFloatGetZero()));
+
+		#endif
+	}
+
+	inline hexv_float HexvFloatGetMinusZero(void)
+	{
+		#if defined(TERATHON_AVX512)
+
+			alignas(64) static const uint32 float_80000000[16] = {0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000};
+			return (_mm512_load_ps(float_80000000));
+
+		#else
+
+			return (HexvFloat(ExvFloatGetMinusZero(), ExvFloatGetMinusZero()));
+
+		#endif
+	}
+
+	template <uint32 value>
+	inline hexv_float HexvLoadVectorConstant(void)
+	{
+		#if defined(TERATHON_AVX512)
+
+			alignas(64) static const uint32 k[16] = {value, value, value, value, value, value, value, value, value, value, value, value, value, value, value, value};
+			return (_mm512_load_ps(k));
+
+		#else
+
+			return (HexvFloat(ExvLoadVectorConstant<value>(), ExvLoadVectorConstant<value>()));
+
+		#endif
+	}
+
+	inline exv_float HexvGetExvLo(const hexv_float& v)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_castps512_ps256(v));
+
+		#else
+
+			return (v.lo);
+
+		#endif
+	}
+
+	inline exv_float HexvGetExvHi(const hexv_float& v)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v), 1)));
+
+		#else
+
+			return (v.hi);
+
+		#endif
+	}
+
+	template <int p3, int p2, int p1, int p0>
+	inline hexv_float HexvShuffle(const hexv_float& v1, const hexv_float& v2)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_shuffle_ps(v1, v2, _MM_SHUFFLE(p3, p2, p1, p0)));
+
+		#else
+
+			return (HexvFloat(ExvShuffle<p3,p2,p1,p0>(v1.lo, v2.lo), ExvShuffle<p3,p2,p1,p0>(v1.hi, v2.hi)));
+
+		#endif
+	}
+
+	inline hexv_mask HexvMaskGetFirst(machine count)
+	{
+		return (hexv_mask((1U << count) - 1));
+	}
+
+	inline int32 HexvMaskGetCount(hexv_mask mask)
+	{
+		uint32 m = mask;
+		m = m - ((m >> 1) & 0x5555);
+		m = (m & 0x3333) + ((m >> 2) & 0x3333);
+		m = (m + (m >> 4)) & 0x0F0F;
+		return (int32((m + (m >> 8)) & 0x1F));
+	}
+
+	inline hexv_float HexvLoad(const float *ptr)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_load_ps(ptr));
+
+		#else
+
+			return (HexvFloat(ExvLoad(ptr), ExvLoad(ptr + 8)));
+
+		#endif
+	}
+
+	inline hexv_float HexvLoadUnaligned(const float *ptr)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_loadu_ps(ptr));
+
+		#else
+
+			return (HexvFloat(ExvLoadUnaligned(ptr), ExvLoadUnaligned(ptr + 8)));
+
+		#endif
+	}
+
+	inline hexv_float HexvLoadSmearScalar(const float *ptr)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_set1_ps(*ptr));
+
+		#else
+
+			return (HexvFloat(ExvLoadSmearScalar(ptr), ExvLoadSmearScalar(ptr)));
+
+		#endif
+	}
+
+	inline hexv_float HexvMaskLoad(const float *ptr, hexv_mask mask)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_maskz_loadu_ps(mask, ptr));
+
+		#else
+
+			float		temp[16];
+
+			for (machine i = 0; i < 16; i++) temp[i] = ((mask >> i) & 1) ? ptr[i] : 0.0F;
+			return (HexvLoadUnaligned(temp));
+
+		#endif
+	}
+
+	inline hexv_float HexvExpandLoad(const float *ptr, hexv_mask mask)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_maskz_expandloadu_ps(mask, ptr));
+
+		#else
+
+			float		temp[16];
+
+			for (machine i = 0; i < 16; i++) temp[i] = ((mask >> i) & 1) ? *ptr++ : 0.0F;
+			return (HexvLoadUnaligned(temp));
+
+		#endif
+	}
+
+	inline void HexvStore(const hexv_float& v, float *ptr)
+	{
+		#if defined(TERATHON_AVX512)
+
+			_mm512_store_ps(ptr, v);
+
+		#else
+
+			ExvStore(v.lo, ptr);
+			ExvStore(v.hi, ptr + 8);
+
+		#endif
+	}
+
+	inline void HexvStoreUnaligned(const hexv_float& v, float *ptr)
+	{
+		#if defined(TERATHON_AVX512)
+
+			_mm512_storeu_ps(ptr, v);
+
+		#else
+
+			ExvStoreUnaligned(v.lo, ptr);
+			ExvStoreUnaligned(v.hi, ptr + 8);
+
+		#endif
+	}
+
+	inline void HexvMaskStore(const hexv_float& v, float *ptr, hexv_mask mask)
+	{
+		#if defined(TERATHON_AVX512)
+
+			_mm512_mask_storeu_ps(ptr, mask, v);
+
+		#else
+
+			float		temp[16];
+
+			HexvStoreUnaligned(v, temp);
+			for (machine i = 0; i < 16; i++)
+			{
+				if ((mask >> i) & 1)
+				{
+					ptr[i] = temp[i];
+				}
+			}
+
+		#endif
+	}
+
+	inline int32 HexvCompressStore(const hexv_float& v, float *ptr, hexv_mask mask)
+	{
+		#if defined(TERATHON_AVX512)
+
+			_mm512_mask_compressstoreu_ps(ptr, mask, v);
+
+		#else
+
+			float		temp[16];
+
+			HexvStoreUnaligned(v, temp);
+			float *p = ptr;
+			for (machine i = 0; i < 16; i++)
+			{
+				if ((mask >> i) & 1)
+				{
+					*p++ = temp[i];
+				}
+			}
+
+		#endif
+
+		return (HexvMaskGetCount(mask));
+	}
+
+	inline hexv_float HexvCompress(const hexv_float& v, hexv_mask mask)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_maskz_compress_ps(mask, v));
+
+		#else
+
+			float		temp[16];
+
+			for (machine i = 0; i < 16; i++) temp[i] = 0.0F;
+			HexvCompressStore(v, temp, mask);
+			return (HexvLoadUnaligned(temp));
+
+		#endif
+	}
+
+	inline hexv_float HexvExpand(const hexv_float& v, hexv_mask mask)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_maskz_expand_ps(mask, v));
+
+		#else
+
+			float		temp[16];
+
+			HexvStoreUnaligned(v, temp);
+			return (HexvExpandLoad(temp, mask));
+
+		#endif
+	}
+
+	inline hexv_int32 HexvConvertInt32(const hexv_float& v)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_cvtps_epi32(v));
+
+		#else
+
+			hexv_int32	result;
+
+			result.lo = ExvConvertInt32(v.lo);
+			result.hi = ExvConvertInt32(v.hi);
+			return (result);
+
+		#endif
+	}
+
+	inline hexv_int32 HexvTruncateConvertInt32(const hexv_float& v)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_cvttps_epi32(v));
+
+		#else
+
+			hexv_int32	result;
+
+			result.lo = ExvTruncateConvertInt32(v.lo);
+			result.hi = ExvTruncateConvertInt32(v.hi);
+			return (result);
+
+		#endif
+	}
+
+	inline hexv_float HexvInt32ConvertFloat(const hexv_int32& v)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_cvtepi32_ps(v));
+
+		#else
+
+			return (HexvFloat(ExvInt32ConvertFloat(v.lo), ExvInt32ConvertFloat(v.hi)));
+
+		#endif
+	}
+
+	inline hexv_float HexvNegate(const hexv_float& v)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_sub_ps(_mm512_setzero_ps(), v));
+
+		#else
+
+			return (HexvFloat(ExvNegate(v.lo), ExvNegate(v.hi)));
+
+		#endif
+	}
+
+	inline hexv_float operator -(const hexv_float& v)
+	{
+		return (HexvNegate(v));
+	}
+
+	inline hexv_float HexvMin(const hexv_float& v1, const hexv_float& v2)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_min_ps(v1, v2));
+
+		#else
+
+			return (HexvFloat(ExvMin(v1.lo, v2.lo), ExvMin(v1.hi, v2.hi)));
+
+		#endif
+	}
+
+	inline hexv_float HexvMax(const hexv_float& v1, const hexv_float& v2)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_max_ps(v1, v2));
+
+		#else
+
+			return (HexvFloat(ExvMax(v1.lo, v2.lo), ExvMax(v1.hi, v2.hi)));
+
+		#endif
+	}
+
+	inline hexv_float HexvAdd(const hexv_float& v1, const hexv_float& v2)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_add_ps(v1, v2));
 
-		inline exv_float ExvMul(const exv_float& v1, const exv_float& v2)
-		{
-			return (_mm256_mul_ps(v1, v2));
-		}
+		#else
 
-		inline exv_float operator *(const exv_float& v1, const exv_float& v2)
-		{
-			return (_mm256_mul_ps(v1, v2));
-		}
+			return (HexvFloat(ExvAdd(v1.lo, v2.lo), ExvAdd(v1.hi, v2.hi)));
 
-		inline exv_float ExvMadd(const exv_float& v1, const exv_float& v2, const exv_float& v3)
-		{
-			return (_mm256_add_ps(_mm256_mul_ps(v1, v2), v3));
-		}
+		#endif
+	}
+
+	inline hexv_float operator +(const hexv_float& v1, const hexv_float& v2)
+	{
+		return (HexvAdd(v1, v2));
+	}
+
+	inline hexv_float HexvSub(const hexv_float& v1, const hexv_float& v2)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_sub_ps(v1, v2));
+
+		#else
+
+			return (HexvFloat(ExvSub(v1.lo, v2.lo), ExvSub(v1.hi, v2.hi)));
+
+		#endif
+	}
+
+	inline hexv_float operator -(const hexv_float& v1, const hexv_float& v2)
+	{
+		return (HexvSub(v1, v2));
+	}
+
+	inline hexv_float HexvMul(const hexv_float& v1, const hexv_float& v2)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_mul_ps(v1, v2));
+
+		#else
+
+			return (HexvFloat(ExvMul(v1.lo, v2.lo), ExvMul(v1.hi, v2.hi)));
+
+		#endif
+	}
+
+	inline hexv_float operator *(const hexv_float& v1, const hexv_float& v2)
+	{
+		return (HexvMul(v1, v2));
+	}
+
+	inline hexv_float HexvMadd(const hexv_float& v1, const hexv_float& v2, const hexv_float& v3)
+	{
+		#if defined(TERATHON_AVX512) && defined(TERATHON_FMA)
+
+			return (_mm512_fmadd_ps(v1, v2, v3));
+
+		#elif defined(TERATHON_AVX512)
+
+			return (_mm512_add_ps(_mm512_mul_ps(v1, v2), v3));
+
+		#else
+
+			return (HexvFloat(ExvMadd(v1.lo, v2.lo, v3.lo), ExvMadd(v1.hi, v2.hi, v3.hi)));
+
+		#endif
+	}
+
+	inline hexv_float HexvNmsub(const hexv_float& v1, const hexv_float& v2, const hexv_float& v3)
+	{
+		#if defined(TERATHON_AVX512) && defined(TERATHON_FMA)
+
+			return (_mm512_fnmadd_ps(v1, v2, v3));
+
+		#elif defined(TERATHON_AVX512)
+
+			return (_mm512_sub_ps(v3, _mm512_mul_ps(v1, v2)));
+
+		#else
+
+			return (HexvFloat(ExvNmsub(v1.lo, v2.lo, v3.lo), ExvNmsub(v1.hi, v2.hi, v3.hi)));
+
+		#endif
+	}
+
+	inline hexv_float HexvDiv(const hexv_float& v1, const hexv_float& v2)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_div_ps(v1, v2));
+
+		#else
+
+			return (HexvFloat(ExvDiv(v1.lo, v2.lo), ExvDiv(v1.hi, v2.hi)));
+
+		#endif
+	}
+
+	inline hexv_float operator /(const hexv_float& v1, const hexv_float& v2)
+	{
+		return (HexvDiv(v1, v2));
+	}
+
+	inline hexv_float HexvAnd(const hexv_float& v1, const hexv_float& v2)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(v1), _mm512_castps_si512(v2))));
+
+		#else
+
+			return (HexvFloat(ExvAnd(v1.lo, v2.lo), ExvAnd(v1.hi, v2.hi)));
+
+		#endif
+	}
+
+	inline hexv_float operator &(const hexv_float& v1, const hexv_float& v2)
+	{
+		return (HexvAnd(v1, v2));
+	}
+
+	inline hexv_float HexvAndc(const hexv_float& v1, const hexv_float& v2)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_castsi512_ps(_mm512_andnot_si512(_mm512_castps_si512(v2), _mm512_castps_si512(v1))));
+
+		#else
+
+			return (HexvFloat(ExvAndc(v1.lo, v2.lo), ExvAndc(v1.hi, v2.hi)));
+
+		#endif
+	}
+
+	inline hexv_float HexvOr(const hexv_float& v1, const hexv_float& v2)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(v1), _mm512_castps_si512(v2))));
+
+		#else
+
+			return (HexvFloat(ExvOr(v1.lo, v2.lo), ExvOr(v1.hi, v2.hi)));
+
+		#endif
+	}
+
+	inline hexv_float operator |(const hexv_float& v1, const hexv_float& v2)
+	{
+		return (HexvOr(v1, v2));
+	}
+
+	inline hexv_float HexvXor(const hexv_float& v1, const hexv_float& v2)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(v1), _mm512_castps_si512(v2))));
+
+		#else
+
+			return (HexvFloat(ExvXor(v1.lo, v2.lo), ExvXor(v1.hi, v2.hi)));
+
+		#endif
+	}
+
+	inline hexv_float operator ^(const hexv_float& v1, const hexv_float& v2)
+	{
+		return (HexvXor(v1, v2));
+	}
+
+	inline hexv_float HexvSelect(const hexv_float& v1, const hexv_float& v2, hexv_mask mask)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_mask_blend_ps(mask, v1, v2));
+
+		#else
+
+			return (HexvFloat(ExvSelect(v1.lo, v2.lo, HexvGetExvMask(mask)), ExvSelect(v1.hi, v2.hi, HexvGetExvMask(mask >> 8))));
+
+		#endif
+	}
+
+	inline hexv_mask HexvMaskCmpeq(const hexv_float& v1, const hexv_float& v2)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_cmp_ps_mask(v1, v2, _CMP_EQ_OQ));
+
+		#else
+
+			return (hexv_mask(ExvMaskGetBits(ExvMaskCmpeq(v1.lo, v2.lo)) | (ExvMaskGetBits(ExvMaskCmpeq(v1.hi, v2.hi)) << 8)));
+
+		#endif
+	}
+
+	inline hexv_mask HexvMaskCmplt(const hexv_float& v1, const hexv_float& v2)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_cmp_ps_mask(v1, v2, _CMP_LT_OQ));
+
+		#else
+
+			return (hexv_mask(ExvMaskGetBits(ExvMaskCmplt(v1.lo, v2.lo)) | (ExvMaskGetBits(ExvMaskCmplt(v1.hi, v2.hi)) << 8)));
+
+		#endif
+	}
+
+	inline hexv_mask HexvMaskCmpgt(const hexv_float& v1, const hexv_float& v2)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_cmp_ps_mask(v1, v2, _CMP_GT_OQ));
+
+		#else
+
+			return (hexv_mask(ExvMaskGetBits(ExvMaskCmpgt(v1.lo, v2.lo)) | (ExvMaskGetBits(ExvMaskCmpgt(v1.hi, v2.hi)) << 8)));
+
+		#endif
+	}
+
+	inline hexv_float HexvInverseSqrt(const hexv_float& v)
+	{
+		#if defined(TERATHON_AVX512)
+
+			const hexv_float three = HexvLoadVectorConstant<0x40400000>();
+			const hexv_float half = HexvLoadVectorConstant<0x3F000000>();
+
+			hexv_float f = _mm512_rsqrt14_ps(v);
+			return (_mm512_mul_ps(_mm512_mul_ps(_mm512_fnmadd_ps(v, _mm512_mul_ps(f, f), three), f), half));
+
+		#else
+
+			return (HexvFloat(ExvInverseSqrt(v.lo), ExvInverseSqrt(v.hi)));
+
+		#endif
+	}
+
+	inline hexv_float HexvSqrt(const hexv_float& v)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_maskz_mul_ps(_mm512_cmp_ps_mask(v, _mm512_setzero_ps(), _CMP_NEQ_UQ), HexvInverseSqrt(v), v));
+
+		#else
+
+			return (HexvFloat(ExvSqrt(v.lo), ExvSqrt(v.hi)));
+
+		#endif
+	}
+
+	inline hexv_float HexvFloor(const hexv_float& v)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_roundscale_ps(v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+
+		#else
+
+			return (HexvFloat(ExvFloor(v.lo), ExvFloor(v.hi)));
+
+		#endif
+	}
+
+	inline hexv_float HexvCeil(const hexv_float& v)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_roundscale_ps(v, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+
+		#else
+
+			return (HexvFloat(ExvCeil(v.lo), ExvCeil(v.hi)));
+
+		#endif
+	}
+
+	inline float HexvReduceSum(const hexv_float& v)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_reduce_add_ps(v));
+
+		#else
+
+			float		result;
+
+			ExvStoreX(ExvHorizontalSum(ExvAdd(v.lo, v.hi)), &result);
+			return (result);
+
+		#endif
+	}
+
+	inline float HexvReduceMin(const hexv_float& v)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_reduce_min_ps(v));
+
+		#else
+
+			float		result;
+
+			ExvStoreX(ExvHorizontalMin(ExvMin(v.lo, v.hi)), &result);
+			return (result);
+
+		#endif
+	}
+
+	inline float HexvReduceMax(const hexv_float& v)
+	{
+		#if defined(TERATHON_AVX512)
+
+			return (_mm512_reduce_max_ps(v));
+
+		#else
+
+			float		result;
+
+			ExvStoreX(ExvHorizontalMax(ExvMax(v.lo, v.hi)), &result);
+			return (result);
+
+		#endif
+	}
+
+	inline hexv_float HexvDot3D(const hexv_float& x1, const hexv_float& y1, const hexv_float& z1, const hexv_float& x2, const hexv_float& y2, const hexv_float& z2)
+	{
+		return (HexvMadd(z1, z2, HexvMadd(y1, y2, HexvMul(x1, x2))));
+	}
+
+	inline void HexvCross3D(const hexv_float& x1, const hexv_float& y1, const hexv_float& z1, const hexv_float& x2, const hexv_float& y2, const hexv_float& z2, hexv_float *x, hexv_float *y, hexv_float *z)
+	{
+		*x = HexvNmsub(z1, y2, HexvMul(y1, z2));
+		*y = HexvNmsub(x1, z2, HexvMul(z1, x2));
+		*z = HexvNmsub(y1, x2, HexvMul(x1, y2));
+	}
+
+	inline void HexvLoadDeinterleave3D(const float *ptr, hexv_float *x, hexv_float *y, hexv_float *z)
+	{
+		#if defined(TERATHON_AVX512)
+
+			alignas(64) static const int32 index[6][16] =
+			{
+				{0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 0, 0, 0, 0, 0}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 17, 20, 23, 26, 29},
+				{1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 0, 0, 0, 0, 0}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 18, 21, 24, 27, 30},
+				{2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 0, 0, 0, 0, 0, 0}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 19, 22, 25, 28, 31}
+			};
+
+			__m512 a = _mm512_loadu_ps(ptr);
+			__m512 b = _mm512_loadu_ps(ptr + 16);
+			__m512 c = _mm512_loadu_ps(ptr + 32);
+
+			*x = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, _mm512_load_si512(index[0]), b), _mm512_load_si512(index[1]), c);
+			*y = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, _mm512_load_si512(index[2]), b), _mm512_load_si512(index[3]), c);
+			*z = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, _mm512_load_si512(index[4]), b), _mm512_load_si512(index[5]), c);
+
+		#else
+
+			ExvLoadDeinterleave3D(ptr, &x->lo, &y->lo, &z->lo);
+			ExvLoadDeinterleave3D(ptr + 24, &x->hi, &y->hi, &z->hi);
+
+		#endif
+	}
+
+	inline void HexvStoreInterleave3D(const hexv_float& x, const hexv_float& y, const hexv_float& z, float *ptr)
+	{
+		#if defined(TERATHON_AVX512)
+
+			alignas(64) static const int32 index[6][16] =
+			{
+				{0, 16, 0, 1, 17, 0, 2, 18, 0, 3, 19, 0, 4, 20, 0, 5}, {0, 1, 16, 3, 4, 17, 6, 7, 18, 9, 10, 19, 12, 13, 20, 15},
+				{21, 0, 6, 22, 0, 7, 23, 0, 8, 24, 0, 9, 25, 0, 10, 26}, {0, 21, 2, 3, 22, 5, 6, 23, 8, 9, 24, 11, 12, 25, 14, 15},
+				{0, 11, 27, 0, 12, 28, 0, 13, 29, 0, 14, 30, 0, 15, 31, 0}, {26, 1, 2, 27, 4, 5, 28, 7, 8, 29, 10, 11, 30, 13, 14, 31}
+			};
+
+			_mm512_storeu_ps(ptr, _mm512_permutex2var_ps(_mm512_permutex2var_ps(x, _mm512_load_si512(index[0]), y), _mm512_load_si512(index[1]), z));
+			_mm512_storeu_ps(ptr + 16, _mm512_permutex2var_ps(_mm512_permutex2var_ps(x, _mm512_load_si512(index[2]), y), _mm512_load_si512(index[3]), z));
+			_mm512_storeu_ps(ptr + 32, _mm512_permutex2var_ps(_mm512_permutex2var_ps(x, _mm512_load_si512(index[4]), y), _mm512_load_si512(index[5]), z));
+
+		#else
+
+			ExvStoreInterleave3D(x.lo, y.lo, z.lo, ptr);
+			ExvStoreInterleave3D(x.hi, y.hi, z.hi, ptr + 24);
+
+		#endif
+	}
+
+	inline void HexvTranspose4D(const hexv_float& a, const hexv_float& b, const hexv_float& c, const hexv_float& d, hexv_float *x, hexv_float *y, hexv_float *z, hexv_float *w)
+	{
+		hexv_float t0 = HexvShuffle<1,0,1,0>(a, b);
+		hexv_float t1 = HexvShuffle<3,2,3,2>(a, b);
+		hexv_float t2 = HexvShuffle<1,0,1,0>(c, d);
+		hexv_float t3 = HexvShuffle<3,2,3,2>(c, d);
+
+		*x = HexvShuffle<2,0,2,0>(t0, t2);
+		*y = HexvShuffle<3,1,3,1>(t0, t2);
+		*z = HexvShuffle<2,0,2,0>(t1, t3);
+		*w = HexvShuffle<3,1,3,1>(t1, t3);
+	}
 
-	#endif
 }
 
 
@@ -0,0 +1,37 @@
+//
+// This file is part of the Terathon Common Library, by Eric Lengyel.
+// Copyright 1999-2025, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+
+// This file must be compiled with -mavx2 (or /arch:AVX2) to provide the
+// AVX2 variants of the dispatched functions. Compiled with any other options, it
+// only defines a table accessor that returns nullptr, and the baseline functions are always used.
+
+
+#if defined(__AVX2__) && !defined(TERATHON_NO_SIMD)
+
+	#define Terathon TerathonAvx2
+
+	#include "TSSimdVariant.h"
+
+
+	const TerathonSimd::DispatchTable *TerathonSimd::GetAvx2DispatchTable(void)
+	{
+		return (&Terathon::variantDispatchTable);
+	}
+
+#else
+
+	#include "TSSimdDispatch.h"
+
+
+	const TerathonSimd::DispatchTable *TerathonSimd::GetAvx2DispatchTable(void)
+	{
+		return (nullptr);
+	}
+
+#endif
@@ -0,0 +1,114 @@
+//
+// This file is part of the Terathon Common Library, by Eric Lengyel.
+// Copyright 1999-2025, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+
+#ifndef TSSimdDispatch_h
+#define TSSimdDispatch_h
+
+
+#include "TSSimd.h"
+
+#include <stddef.h>
+
+
+// The array functions of the library are compiled a second time in TSSimdAvx2.cpp and TSSimdAvx512.cpp
+// with the Terathon namespace renamed, and each of those files exports a table of pointers to its copies.
+// The baseline functions forward to the table selected at startup when the processor supports the wider
+// instruction set. Single-element functions are not dispatched because they gain nothing from wider registers.
+// The table only uses fundamental types because the variant copies of the library types are distinct types
+// in their own namespaces, and all objects are passed by pointer.
+
+
+#if defined(TERATHON_SSE) && !defined(TERATHON_NO_SIMD) && !defined(TERATHON_SIMD_VARIANT)
+
+	#define TERATHON_SIMD_DISPATCH 1
+
+#endif
+
+
+namespace TerathonSimd
+{
+	struct DispatchTable
+	{
+		unsigned int	requiredFeatures;
+
+		void (*SinArray)(const float *x, float *result, ptrdiff_t count);
+		void (*CosArray)(const float *x, float *result, ptrdiff_t count);
+		void (*TanArray)(const float *x, float *result, ptrdiff_t count);
+		void (*CosSinArray)(const float *x, float *c, float *s, ptrdiff_t count);
+		void (*ArcsinArray)(const float *y, float *result, ptrdiff_t count);
+		void (*ArccosArray)(const float *x, float *result, ptrdiff_t count);
+		void (*ArctanArray)(const float *x, float *result, ptrdiff_t count);
+		void (*Arctan2Array)(const float *y, const float *x, float *result, ptrdiff_t count);
+		void (*ExpArray)(const float *x, float *result, ptrdiff_t count);
+		void (*LogArray)(const float *x, float *result, ptrdiff_t count);
+
+		void (*InverseMatrix3DArray)(const void *m, void *result, ptrdiff_t count);
+
+		void (*InverseMatrix4DArray)(const void *m, void *result, ptrdiff_t count);
+		void (*InverseMatrix4DColumns)(const float *const *m, float *const *result, ptrdiff_t count);
+		void (*MultiplyMatrices4DLeft)(const void *m1, const void *m2, void *result, ptrdiff_t count);
+		void (*MultiplyMatrices4DRight)(const void *m1, const void *m2, void *result, ptrdiff_t count);
+
+		void (*InverseTransform3DArray)(const void *m, void *result, ptrdiff_t count);
+		void (*TransformPointsTransform3D)(const void *m, const void *in, void *out, ptrdiff_t count);
+		void (*TransformVectorsTransform3D)(const void *m, const void *in, void *out, ptrdiff_t count);
+		void (*TransformFlatPointsTransform3D)(const void *m, const void *in, void *out, ptrdiff_t count);
+		void (*TransformPointsStridedTransform3D)(const void *m, const void *in, ptrdiff_t inStride, void *out, ptrdiff_t outStride, ptrdiff_t count);
+		void (*TransformVectorsStridedTransform3D)(const void *m, const void *in, ptrdiff_t inStride, void *out, ptrdiff_t outStride, ptrdiff_t count);
+		void (*TransformPointsSoaTransform3D)(const void *m, const float *inX, const float *inY, const float *inZ, float *outX, float *outY, float *outZ, ptrdiff_t count);
+		void (*TransformVectorsSoaTransform3D)(const void *m, const float *inX, const float *inY, const float *inZ, float *outX, float *outY, float *outZ, ptrdiff_t count);
+		void (*StoreTransformMatricesTransform3D)(const void *transform, float *matrix, ptrdiff_t count, unsigned int flags);
+
+		void (*TransformLinesMotor3D)(const void *Q, const void *in, void *out, ptrdiff_t count);
+		void (*TransformPlanesMotor3D)(const void *Q, const void *in, void *out, ptrdiff_t count);
+		void (*PropagateMotors)(const void *localMotor, const void *parentIndex, void *worldMotor, void *worldTransform, ptrdiff_t count, ptrdiff_t start);
+		void (*StoreTransformMatricesMotor3D)(const void *motor, float *matrix, ptrdiff_t count, unsigned int flags);
+		void (*SetTransformMatricesMotor3D)(const void *matrix, void *result, ptrdiff_t count);
+		void (*EvaluateMotorInterpolator)(const void *interpolator, const float *t, void *result, ptrdiff_t count);
+		void (*EvaluateMotorInterpolators)(const void *interpolator, const float *t, void *result, ptrdiff_t count);
+
+		void (*TransformLinesFlector3D)(const void *F, const void *in, void *out, ptrdiff_t count);
+		void (*TransformPlanesFlector3D)(const void *F, const void *in, void *out, ptrdiff_t count);
+		void (*StoreTransformMatricesFlector3D)(const void *flector, float *matrix, ptrdiff_t count, unsigned int flags);
+
+		void (*TransformVectorsSoaQuaternion)(const void *q, const float *inX, const float *inY, const float *inZ, float *outX, float *outY, float *outZ, ptrdiff_t count);
+		void (*TransformVectorsIndexedQuaternion)(const void *q, const void *index, const float *inX, const float *inY, const float *inZ, float *outX, float *outY, float *outZ, ptrdiff_t count);
+		void (*GetRotationMatrices)(const void *q, void *result, ptrdiff_t count);
+		void (*SetRotationMatrices)(const void *matrix, void *result, ptrdiff_t count);
+		void (*CalculateEigensystems)(const void *m, void *eigenvalues, void *rotation, ptrdiff_t count);
+		void (*CalculateSingularValueDecompositions)(const void *m, void *U, void *S, void *V, ptrdiff_t count);
+		void (*CalculatePolarDecompositionsMatrix3D)(const void *m, void *rotation, void *stretch, ptrdiff_t count);
+		void (*CalculatePolarDecompositionsTransform3D)(const void *m, void *rotation, void *stretch, ptrdiff_t count);
+		void (*DecomposeTransforms)(const void *m, void *translation, void *rotation, void *scale, void *shear, ptrdiff_t count);
+		void (*ComposeTransforms)(const void *translation, const void *rotation, const void *scale, const void *shear, void *result, ptrdiff_t count);
+		void (*NlerpArray)(const void *q1, const void *q2, const float *t, void *result, ptrdiff_t count);
+		void (*SlerpArray)(const void *q1, const void *q2, const float *t, void *result, ptrdiff_t count);
+		void (*CorrectedNlerpArray)(const void *q1, const void *q2, const float *t, void *result, ptrdiff_t count);
+		void (*NlerpSoa)(const float *const *q1, const float *const *q2, const float *t, float *const *result, ptrdiff_t count);
+		void (*SlerpSoa)(const float *const *q1, const float *const *q2, const float *t, float *const *result, ptrdiff_t count);
+		void (*CorrectedNlerpSoa)(const float *const *q1, const float *const *q2, const float *t, float *const *result, ptrdiff_t count);
+
+		void (*TransformPointsDoubleTransform3D)(const void *m, const void *in, void *out, ptrdiff_t count);
+		void (*TransformVectorsDoubleTransform3D)(const void *m, const void *in, void *out, ptrdiff_t count);
+	};
+
+
+	// Each of these returns nullptr when its file was not compiled with the corresponding instruction set.
+
+	const DispatchTable *GetAvx2DispatchTable(void);
+	const DispatchTable *GetAvx512DispatchTable(void);
+
+	// The table selected for the running processor, or nullptr when the baseline functions are fastest. It is set
+	// during static initialization, so functions called by earlier static initializers use the baseline code.
+
+	extern const DispatchTable *const dispatchTable;
+}
+
+
+#endif
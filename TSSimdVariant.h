@@ -0,0 +1,408 @@
+//
+// This file is part of the Terathon Common Library, by Eric Lengyel.
+// Copyright 1999-2025, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+
+// This file is only included by TSSimdAvx2.cpp and TSSimdAvx512.cpp after they have renamed the Terathon
+// namespace. It compiles the library sources a second time with the instruction set of the including file
+// and defines the dispatch table that points to the functions in the renamed namespace.
+
+
+#ifndef TSSimdVariant_h
+#define TSSimdVariant_h
+
+
+#define TERATHON_SIMD_VARIANT 1
+
+
+// The variants must give the same results as the baseline functions, including the single-element functions
+// that are not dispatched, so the FMA code paths are disabled in TSSimd.h when TERATHON_SIMD_VARIANT is
+// defined, and the compiler is not allowed to fuse multiplies and adds on its own.
+
+#if defined(__clang__)
+
+	#pragma STDC FP_CONTRACT OFF
+
+#elif defined(__GNUC__)
+
+	#pragma GCC optimize ("fp-contract=off")
+
+#elif defined(_MSC_VER)
+
+	#pragma fp_contract (off)
+
+#endif
+
+
+#include "TSAlgebra.cpp"
+#include "TSBivector3D.cpp"
+#include "TSConformal2D.cpp"
+#include "TSConformal3D.cpp"
+#include "TSDouble3D.cpp"
+#include "TSFlector2D.cpp"
+#include "TSFlector3D.cpp"
+#include "TSMath.cpp"
+#include "TSMatrix2D.cpp"
+#include "TSMatrix3D.cpp"
+#include "TSMatrix4D.cpp"
+#include "TSMotor2D.cpp"
+#include "TSMotor3D.cpp"
+#include "TSQuaternion.cpp"
+#include "TSRigid2D.cpp"
+#include "TSRigid3D.cpp"
+#include "TSVector2D.cpp"
+#include "TSVector3D.cpp"
+#include "TSVector4D.cpp"
+
+
+namespace Terathon
+{
+	namespace
+	{
+		#if defined(TERATHON_AVX512)
+
+			constexpr uint32 kVariantAvx512Feature = kSimdFeatureAvx512;
+
+		#else
+
+			constexpr uint32 kVariantAvx512Feature = 0;
+
+		#endif
+
+		constexpr uint32 kVariantFeatures = kSimdFeatureSse2 | kSimdFeatureSse41 | kSimdFeatureAvx | kSimdFeatureAvx2 | kVariantAvx512Feature;
+
+
+		void SinArray(const float *x, float *result, ptrdiff_t count)
+		{
+			Sin(x, result, count);
+		}
+
+		void CosArray(const float *x, float *result, ptrdiff_t count)
+		{
+			Cos(x, result, count);
+		}
+
+		void TanArray(const float *x, float *result, ptrdiff_t count)
+		{
+			Tan(x, result, count);
+		}
+
+		void CosSinArray(const float *x, float *c, float *s, ptrdiff_t count)
+		{
+			CosSin(x, c, s, count);
+		}
+
+		void ArcsinArray(const float *y, float *result, ptrdiff_t count)
+		{
+			Arcsin(y, result, count);
+		}
+
+		void ArccosArray(const float *x, float *result, ptrdiff_t count)
+		{
+			Arccos(x, result, count);
+		}
+
+		void ArctanArray(const float *x, float *result, ptrdiff_t count)
+		{
+			Arctan(x, result, count);
+		}
+
+		void Arctan2Array(const float *y, const float *x, float *result, ptrdiff_t count)
+		{
+			Arctan(y, x, result, count);
+		}
+
+		void ExpArray(const float *x, float *result, ptrdiff_t count)
+		{
+			Exp(x, result, count);
+		}
+
+		void LogArray(const float *x, float *result, ptrdiff_t count)
+		{
+			Log(x, result, count);
+		}
+
+		void InverseMatrix3DArray(const void *m, void *result, ptrdiff_t count)
+		{
+			Inverse(static_cast<const Matrix3D *>(m), static_cast<Matrix3D *>(result), count);
+		}
+
+		void InverseMatrix4DArray(const void *m, void *result, ptrdiff_t count)
+		{
+			Inverse(static_cast<const Matrix4D *>(m), static_cast<Matrix4D *>(result), count);
+		}
+
+		void InverseMatrix4DColumns(const float *const *m, float *const *result, ptrdiff_t count)
+		{
+			Inverse(m, result, count);
+		}
+
+		void MultiplyMatrices4DLeft(const void *m1, const void *m2, void *result, ptrdiff_t count)
+		{
+			MultiplyMatrices(*static_cast<const Matrix4D *>(m1), static_cast<const Matrix4D *>(m2), static_cast<Matrix4D *>(result), count);
+		}
+
+		void MultiplyMatrices4DRight(const void *m1, const void *m2, void *result, ptrdiff_t count)
+		{
+			MultiplyMatrices(static_cast<const Matrix4D *>(m1), *static_cast<const Matrix4D *>(m2), static_cast<Matrix4D *>(result), count);
+		}
+
+		void InverseTransform3DArray(const void *m, void *result, ptrdiff_t count)
+		{
+			Inverse(static_cast<const Transform3D *>(m), static_cast<Transform3D *>(result), count);
+		}
+
+		void TransformPointsTransform3D(const void *m, const void *in, void *out, ptrdiff_t count)
+		{
+			TransformPoints(*static_cast<const Transform3D *>(m), static_cast<const Point3D *>(in), static_cast<Point3D *>(out), count);
+		}
+
+		void TransformVectorsTransform3D(const void *m, const void *in, void *out, ptrdiff_t count)
+		{
+			TransformVectors(*static_cast<const Transform3D *>(m), static_cast<const Vector3D *>(in), static_cast<Vector3D *>(out), count);
+		}
+
+		void TransformFlatPointsTransform3D(const void *m, const void *in, void *out, ptrdiff_t count)
+		{
+			TransformPoints(*static_cast<const Transform3D *>(m), static_cast<const FlatPoint3D *>(in), static_cast<FlatPoint3D *>(out), count);
+		}
+
+		void TransformPointsStridedTransform3D(const void *m, const void *in, ptrdiff_t inStride, void *out, ptrdiff_t outStride, ptrdiff_t count)
+		{
+			TransformPoints(*static_cast<const Transform3D *>(m), static_cast<const Point3D *>(in), inStride, static_cast<Point3D *>(out), outStride, count);
+		}
+
+		void TransformVectorsStridedTransform3D(const void *m, const void *in, ptrdiff_t inStride, void *out, ptrdiff_t outStride, ptrdiff_t count)
+		{
+			TransformVectors(*static_cast<const Transform3D *>(m), static_cast<const Vector3D *>(in), inStride, static_cast<Vector3D *>(out), outStride, count);
+		}
+
+		void TransformPointsSoaTransform3D(const void *m, const float *inX, const float *inY, const float *inZ, float *outX, float *outY, float *outZ, ptrdiff_t count)
+		{
+			TransformPoints(*static_cast<const Transform3D *>(m), inX, inY, inZ, outX, outY, outZ, count);
+		}
+
+		void TransformVectorsSoaTransform3D(const void *m, const float *inX, const float *inY, const float *inZ, float *outX, float *outY, float *outZ, ptrdiff_t count)
+		{
+			TransformVectors(*static_cast<const Transform3D *>(m), inX, inY, inZ, outX, outY, outZ, count);
+		}
+
+		void StoreTransformMatricesTransform3D(const void *transform, float *matrix, ptrdiff_t count, unsigned int flags)
+		{
+			StoreTransformMatrices(static_cast<const Transform3D *>(transform), matrix, count, flags);
+		}
+
+		void TransformLinesMotor3D(const void *Q, const void *in, void *out, ptrdiff_t count)
+		{
+			TransformLines(*static_cast<const Motor3D *>(Q), static_cast<const Line3D *>(in), static_cast<Line3D *>(out), count);
+		}
+
+		void TransformPlanesMotor3D(const void *Q, const void *in, void *out, ptrdiff_t count)
+		{
+			TransformPlanes(*static_cast<const Motor3D *>(Q), static_cast<const Plane3D *>(in), static_cast<Plane3D *>(out), count);
+		}
+
+		void PropagateMotorArray(const void *localMotor, const void *parentIndex, void *worldMotor, void *worldTransform, ptrdiff_t count, ptrdiff_t start)
+		{
+			PropagateMotors(static_cast<const Motor3D *>(localMotor), static_cast<const int32 *>(parentIndex), static_cast<Motor3D *>(worldMotor), static_cast<Transform3D *>(worldTransform), count, start);
+		}
+
+		void StoreTransformMatricesMotor3D(const void *motor, float *matrix, ptrdiff_t count, unsigned int flags)
+		{
+			StoreTransformMatrices(static_cast<const Motor3D *>(motor), matrix, count, flags);
+		}
+
+		void SetTransformMatricesMotor3D(const void *matrix, void *result, ptrdiff_t count)
+		{
+			SetTransformMatrices(static_cast<const Transform3D *>(matrix), static_cast<Motor3D *>(result), count);
+		}
+
+		void EvaluateMotorInterpolator(const void *interpolator, const float *t, void *result, ptrdiff_t count)
+		{
+			static_cast<const MotorInterpolator *>(interpolator)->Evaluate(t, static_cast<Motor3D *>(result), count);
+		}
+
+		void EvaluateMotorInterpolatorArray(const void *interpolator, const float *t, void *result, ptrdiff_t count)
+		{
+			EvaluateMotorInterpolators(static_cast<const MotorInterpolator *>(interpolator), t, static_cast<Motor3D *>(result), count);
+		}
+
+		void TransformLinesFlector3D(const void *F, const void *in, void *out, ptrdiff_t count)
+		{
+			TransformLines(*static_cast<const Flector3D *>(F), static_cast<const Line3D *>(in), static_cast<Line3D *>(out), count);
+		}
+
+		void TransformPlanesFlector3D(const void *F, const void *in, void *out, ptrdiff_t count)
+		{
+			TransformPlanes(*static_cast<const Flector3D *>(F), static_cast<const Plane3D *>(in), static_cast<Plane3D *>(out), count);
+		}
+
+		void StoreTransformMatricesFlector3D(const void *flector, float *matrix, ptrdiff_t count, unsigned int flags)
+		{
+			StoreTransformMatrices(static_cast<const Flector3D *>(flector), matrix, count, flags);
+		}
+
+		void TransformVectorsSoaQuaternion(const void *q, const float *inX, const float *inY, const float *inZ, float *outX, float *outY, float *outZ, ptrdiff_t count)
+		{
+			TransformVectors(*static_cast<const Quaternion *>(q), inX, inY, inZ, outX, outY, outZ, count);
+		}
+
+		void TransformVectorsIndexedQuaternion(const void *q, const void *index, const float *inX, const float *inY, const float *inZ, float *outX, float *outY, float *outZ, ptrdiff_t count)
+		{
+			TransformVectors(static_cast<const Quaternion *>(q), static_cast<const int32 *>(index), inX, inY, inZ, outX, outY, outZ, count);
+		}
+
+		void GetRotationMatrixArray(const void *q, void *result, ptrdiff_t count)
+		{
+			GetRotationMatrices(static_cast<const Quaternion *>(q), static_cast<Matrix3D *>(result), count);
+		}
+
+		void SetRotationMatrixArray(const void *matrix, void *result, ptrdiff_t count)
+		{
+			SetRotationMatrices(static_cast<const Transform3D *>(matrix), static_cast<Quaternion *>(result), count);
+		}
+
+		void CalculateEigensystemArray(const void *m, void *eigenvalues, void *rotation, ptrdiff_t count)
+		{
+			CalculateEigensystems(static_cast<const Matrix3D *>(m), static_cast<Vector3D *>(eigenvalues), static_cast<Quaternion *>(rotation), count);
+		}
+
+		void CalculateSingularValueDecompositionArray(const void *m, void *U, void *S, void *V, ptrdiff_t count)
+		{
+			CalculateSingularValueDecompositions(static_cast<const Matrix3D *>(m), static_cast<Quaternion *>(U), static_cast<Vector3D *>(S), static_cast<Quaternion *>(V), count);
+		}
+
+		void CalculatePolarDecompositionsMatrix3D(const void *m, void *rotation, void *stretch, ptrdiff_t count)
+		{
+			CalculatePolarDecompositions(static_cast<const Matrix3D *>(m), static_cast<Quaternion *>(rotation), static_cast<Matrix3D *>(stretch), count);
+		}
+
+		void CalculatePolarDecompositionsTransform3D(const void *m, void *rotation, void *stretch, ptrdiff_t count)
+		{
+			CalculatePolarDecompositions(static_cast<const Transform3D *>(m), static_cast<Quaternion *>(rotation), static_cast<Matrix3D *>(stretch), count);
+		}
+
+		void DecomposeTransformArray(const void *m, void *translation, void *rotation, void *scale, void *shear, ptrdiff_t count)
+		{
+			DecomposeTransforms(static_cast<const Transform3D *>(m), static_cast<Vector3D *>(translation), static_cast<Quaternion *>(rotation), static_cast<Vector3D *>(scale), static_cast<Vector3D *>(shear), count);
+		}
+
+		void ComposeTransformArray(const void *translation, const void *rotation, const void *scale, const void *shear, void *result, ptrdiff_t count)
+		{
+			ComposeTransforms(static_cast<const Vector3D *>(translation), static_cast<const Quaternion *>(rotation), static_cast<const Vector3D *>(scale), static_cast<const Vector3D *>(shear), static_cast<Transform3D *>(result), count);
+		}
+
+		void NlerpArray(const void *q1, const void *q2, const float *t, void *result, ptrdiff_t count)
+		{
+			Nlerp(static_cast<const Quaternion *>(q1), static_cast<const Quaternion *>(q2), t, static_cast<Quaternion *>(result), count);
+		}
+
+		void SlerpArray(const void *q1, const void *q2, const float *t, void *result, ptrdiff_t count)
+		{
+			Slerp(static_cast<const Quaternion *>(q1), static_cast<const Quaternion *>(q2), t, static_cast<Quaternion *>(result), count);
+		}
+
+		void CorrectedNlerpArray(const void *q1, const void *q2, const float *t, void *result, ptrdiff_t count)
+		{
+			CorrectedNlerp(static_cast<const Quaternion *>(q1), static_cast<const Quaternion *>(q2), t, static_cast<Quaternion *>(result), count);
+		}
+
+		void NlerpSoa(const float *const *q1, const float *const *q2, const float *t, float *const *result, ptrdiff_t count)
+		{
+			Nlerp(q1, q2, t, result, count);
+		}
+
+		void SlerpSoa(const float *const *q1, const float *const *q2, const float *t, float *const *result, ptrdiff_t count)
+		{
+			Slerp(q1, q2, t, result, count);
+		}
+
+		void CorrectedNlerpSoa(const float *const *q1, const float *const *q2, const float *t, float *const *result, ptrdiff_t count)
+		{
+			CorrectedNlerp(q1, q2, t, result, count);
+		}
+
+		void TransformPointsDoubleTransform3D(const void *m, const void *in, void *out, ptrdiff_t count)
+		{
+			TransformPoints(*static_cast<const DoubleTransform3D *>(m), static_cast<const DoublePoint3D *>(in), static_cast<DoublePoint3D *>(out), count);
+		}
+
+		void TransformVectorsDoubleTransform3D(const void *m, const void *in, void *out, ptrdiff_t count)
+		{
+			TransformVectors(*static_cast<const DoubleTransform3D *>(m), static_cast<const DoubleVector3D *>(in), static_cast<DoubleVector3D *>(out), count);
+		}
+
+
+		const TerathonSimd::DispatchTable variantDispatchTable =
+		{
+			kVariantFeatures,
+
+			&SinArray,
+			&CosArray,
+			&TanArray,
+			&CosSinArray,
+			&ArcsinArray,
+			&ArccosArray,
+			&ArctanArray,
+			&Arctan2Array,
+			&ExpArray,
+			&LogArray,
+
+			&InverseMatrix3DArray,
+
+			&InverseMatrix4DArray,
+			&InverseMatrix4DColumns,
+			&MultiplyMatrices4DLeft,
+			&MultiplyMatrices4DRight,
+
+			&InverseTransform3DArray,
+			&TransformPointsTransform3D,
+			&TransformVectorsTransform3D,
+			&TransformFlatPointsTransform3D,
+			&TransformPointsStridedTransform3D,
+			&TransformVectorsStridedTransform3D,
+			&TransformPointsSoaTransform3D,
+			&TransformVectorsSoaTransform3D,
+			&StoreTransformMatricesTransform3D,
+
+			&TransformLinesMotor3D,
+			&TransformPlanesMotor3D,
+			&PropagateMotorArray,
+			&StoreTransformMatricesMotor3D,
+			&SetTransformMatricesMotor3D,
+			&EvaluateMotorInterpolator,
+			&EvaluateMotorInterpolatorArray,
+
+			&TransformLinesFlector3D,
+			&TransformPlanesFlector3D,
+			&StoreTransformMatricesFlector3D,
+
+			&TransformVectorsSoaQuaternion,
+			&TransformVectorsIndexedQuaternion,
+			&GetRotationMatrixArray,
+			&SetRotationMatrixArray,
+			&CalculateEigensystemArray,
+			&CalculateSingularValueDecompositionArray,
+			&CalculatePolarDecompositionsMatrix3D,
+			&CalculatePolarDecompositionsTransform3D,
+			&DecomposeTransformArray,
+			&ComposeTransformArray,
+			&NlerpArray,
+			&SlerpArray,
+			&CorrectedNlerpArray,
+			&NlerpSoa,
+			&SlerpSoa,
+			&CorrectedNlerpSoa,
+
+			&TransformPointsDoubleTransform3D,
+			&TransformVectorsDoubleTransform3D
+		};
+	}
+}
+
+
+#endif
@@ -0,0 +1,332 @@
+//
+// This file is part of the Terathon Math Library, by Eric Lengyel.
+// Copyright 1999-2025, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+
+// Self-contained accuracy and differential test for the scalar math functions. Each function
+// is sampled over its domain and compared with a double-precision reference, and the test fails
+// when the maximum error exceeds the bound documented in TSMath.h. The outputs can be saved by
+// one build and compared by another, and the comparison fails when the SIMD and TERATHON_NO_SIMD
+// builds diverge by more than the threshold listed for each function.
+//
+// g++ -std=c++17 -O2 -I. -DTERATHON_NO_SIMD Tools/TSAccuracy.cpp TS*.cpp -o accuracy-scalar && ./accuracy-scalar --save scalar.bin
+// g++ -std=c++17 -O2 -I. Tools/TSAccuracy.cpp TS*.cpp -o accuracy && ./accuracy --compare scalar.bin
+//
+// The --samples option changes the number of samples per function. When the count is at least the
+// number of floats in a bit-pattern range, every float in the range is tested.
+
+
+#include "TSMath.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+
+using namespace Terathon;
+
+
+namespace
+{
+	enum ErrorMetric
+	{
+		kErrorUlp,					// Error divided by the spacing of floats at the reference value.
+		kErrorRelative,				// Error divided by the magnitude of the reference value.
+		kErrorAbsolute				// Error with no scaling.
+	};
+
+	enum SampleMode
+	{
+		kSampleLinear,				// Evenly spaced values in [min, max].
+		kSampleBits,				// Evenly spaced bit patterns in [min, max], where 0 < min < max.
+		kSampleBitsSymmetric		// The same as kSampleBits, but each value is also tested with the opposite sign.
+	};
+
+	typedef float FloatFunction(float);
+	typedef double DoubleFunction(double);
+	typedef void ArrayFunction(const float *, float *, machine);
+
+	struct AccuracyTest
+	{
+		const char			*name;
+		FloatFunction		*function;
+		ArrayFunction		*arrayFunction;
+		DoubleFunction		*reference;
+		SampleMode			sampleMode;
+		float				min;
+		float				max;
+		ErrorMetric			metric;
+		double				bound;					// Maximum error documented in TSMath.h.
+		double				divergence;				// Maximum difference between two builds, in the same metric.
+	};
+
+
+	double ReferenceSqrt(double x) {return (std::sqrt(x));}
+	double ReferenceInverseSqrt(double x) {return (1.0 / std::sqrt(x));}
+	double ReferenceSin(double x) {return (std::sin(x));}
+	double ReferenceCos(double x) {return (std::cos(x));}
+	double ReferenceTan(double x) {return (std::tan(x));}
+	double ReferenceArcsin(double x) {return (std::asin(x));}
+	double ReferenceArccos(double x) {return (std::acos(x));}
+	double ReferenceArctan(double x) {return (std::atan(x));}
+	double ReferenceExp(double x) {return (std::exp(x));}
+	double ReferenceLog(double x) {return (std::log(x));}
+	double ReferenceFloor(double x) {return (std::floor(x));}
+	double ReferenceCeil(double x) {return (std::ceil(x));}
+
+
+	const AccuracyTest accuracyTest[] =
+	{
+		{"Sqrt", [](float x) {return (Sqrt(x));}, nullptr, &ReferenceSqrt, kSampleBits, 1.17549435e-38F, 3.40282347e+38F, kErrorRelative, 4.0e-7, 6.0e-7},
+		{"InverseSqrt", [](float x) {return (InverseSqrt(x));}, nullptr, &ReferenceInverseSqrt, kSampleBits, 1.17549435e-38F, 3.40282347e+38F, kErrorRelative, 4.0e-7, 6.0e-7},
+		{"Sin", [](float x) {return (Sin(x));}, [](const float *x, float *r, machine n) {Sin(x, r, n);}, &ReferenceSin, kSampleLinear, -6.28318531F, 6.28318531F, kErrorAbsolute, 4.8e-7, 2.4e-7},
+		{"Cos", [](float x) {return (Cos(x));}, [](const float *x, float *r, machine n) {Cos(x, r, n);}, &ReferenceCos, kSampleLinear, -6.28318531F, 6.28318531F, kErrorAbsolute, 4.8e-7, 2.4e-7},
+		{"Sin", [](float x) {return (Sin(x));}, [](const float *x, float *r, machine n) {Sin(x, r, n);}, &ReferenceSin, kSampleLinear, -100.0F, 100.0F, kErrorAbsolute, 7.1e-6, 2.4e-7},
+		{"Cos", [](float x) {return (Cos(x));}, [](const float *x, float *r, machine n) {Cos(x, r, n);}, &ReferenceCos, kSampleLinear, -100.0F, 100.0F, kErrorAbsolute, 7.1e-6, 2.4e-7},
+		{"Tan", [](float x) {return (Tan(x));}, [](const float *x, float *r, machine n) {Tan(x, r, n);}, &ReferenceTan, kSampleLinear, -1.5F, 1.5F, kErrorUlp, 21.0, 4.0},
+		{"Arcsin", [](float x) {return (Arcsin(x));}, [](const float *x, float *r, machine n) {Arcsin(x, r, n);}, &ReferenceArcsin, kSampleLinear, -1.0F, 1.0F, kErrorAbsolute, 1.0e-6, 1.0e-6},
+		{"Arccos", [](float x) {return (Arccos(x));}, [](const float *x, float *r, machine n) {Arccos(x, r, n);}, &ReferenceArccos, kSampleLinear, -1.0F, 1.0F, kErrorAbsolute, 1.0e-6, 1.0e-6},
+		{"Arctan", [](float x) {return (Arctan(x));}, [](const float *x, float *r, machine n) {Arctan(x, r, n);}, &ReferenceArctan, kSampleBitsSymmetric, 1.0e-20F, 1.0e+20F, kErrorUlp, 2.0, 2.0},
+		{"Exp", [](float x) {return (Exp(x));}, [](const float *x, float *r, machine n) {Exp(x, r, n);}, &ReferenceExp, kSampleLinear, -87.0F, 88.0F, kErrorUlp, 3.7, 4.0},
+		{"Log", [](float x) {return (Log(x));}, [](const float *x, float *r, machine n) {Log(x, r, n);}, &ReferenceLog, kSampleBits, 0.5F, 2.0F, kErrorAbsolute, 1.5e-7, 1.5e-7},
+		{"Log", [](float x) {return (Log(x));}, [](const float *x, float *r, machine n) {Log(x, r, n);}, &ReferenceLog, kSampleBits, 1.17549435e-38F, 0.5F, kErrorUlp, 2.3, 2.3},
+		{"Log", [](float x) {return (Log(x));}, [](const float *x, float *r, machine n) {Log(x, r, n);}, &ReferenceLog, kSampleBits, 2.0F, 3.40282347e+38F, kErrorUlp, 2.3, 2.3},
+		{"Floor", [](float x) {return (Floor(x));}, nullptr, &ReferenceFloor, kSampleBitsSymmetric, 1.17549435e-38F, 3.40282347e+38F, kErrorUlp, 0.0, 0.0},
+		{"Ceil", [](float x) {return (Ceil(x));}, nullptr, &ReferenceCeil, kSampleBitsSymmetric, 1.17549435e-38F, 3.40282347e+38F, kErrorUlp, 0.0, 0.0}
+	};
+
+
+	uint32 FloatToBits(float x)
+	{
+		uint32 i;
+		memcpy(&i, &x, 4);
+		return (i);
+	}
+
+	float BitsToFloat(uint32 i)
+	{
+		float x;
+		memcpy(&x, &i, 4);
+		return (x);
+	}
+
+	void GenerateSamples(const AccuracyTest& test, machine sampleCount, std::vector<float>& sample)
+	{
+		sample.clear();
+
+		if (test.sampleMode == kSampleLinear)
+		{
+			double scale = (double(test.max) - double(test.min)) / double(sampleCount - 1);
+			for (machine a = 0; a < sampleCount; a++)
+			{
+				sample.push_back(float(double(test.min) + double(a) * scale));
+			}
+		}
+		else
+		{
+			uint32 first = FloatToBits(test.min);
+			uint32 last = FloatToBits(test.max);
+			uint64 range = uint64(last - first) + 1;
+			uint64 stride = (range + uint64(sampleCount) - 1) / uint64(sampleCount);
+
+			for (uint64 i = first; i <= last; i += stride)
+			{
+				float x = BitsToFloat(uint32(i));
+				sample.push_back(x);
+				if (test.sampleMode == kSampleBitsSymmetric)
+				{
+					sample.push_back(-x);
+				}
+			}
+		}
+	}
+
+	double CalculateError(ErrorMetric metric, double result, double reference)
+	{
+		double error = std::fabs(result - reference);
+		if (metric == kErrorRelative)
+		{
+			return ((reference != 0.0) ? error / std::fabs(reference) : error);
+		}
+
+		if (metric == kErrorUlp)
+		{
+			// The spacing of floats is 2^(e - 23) for a reference value in [2^e, 2^(e + 1)),
+			// and it stays at the subnormal spacing 2^-149 below the normal range.
+
+			int e = (reference != 0.0) ? std::ilogb(reference) : -126;
+			return (error / std::ldexp(1.0, ((e > -126) ? e : -126) - 23));
+		}
+
+		return (error);
+	}
+
+	bool ReportError(const char *name, const AccuracyTest& test, const float *result, const std::vector<float>& sample)
+	{
+		double maxError = 0.0;
+		double sumError = 0.0;
+		float worstInput = 0.0F;
+		machine count = 0;
+
+		machine sampleCount = machine(sample.size());
+		for (machine a = 0; a < sampleCount; a++)
+		{
+			double reference = test.reference(sample[a]);
+			if (!std::isfinite(reference))
+			{
+				continue;
+			}
+
+			double error = CalculateError(test.metric, result[a], reference);
+			if (!(error <= maxError))
+			{
+				maxError = error;
+				worstInput = sample[a];
+			}
+
+			sumError += error;
+			count++;
+		}
+
+		static const char *const metricName[3] = {"ulp", "relative", "absolute"};
+
+		bool pass = (maxError <= test.bound);
+		std::printf("%-12s [%-14.8g, %14.8g] %9d samples  %-8s max %-11.4g mean %-11.4g at %-14.8g bound %-9.3g %s\n",
+			name, test.min, test.max, int(count), metricName[test.metric], maxError, sumError / double((count > 0) ? count : 1), worstInput, test.bound, (pass) ? "PASS" : "FAIL");
+
+		return (pass);
+	}
+
+	bool CompareBuilds(const char *name, const AccuracyTest& test, const float *result, const float *other, const std::vector<float>& sample)
+	{
+		double maxDivergence = 0.0;
+		float worstInput = 0.0F;
+
+		machine sampleCount = machine(sample.size());
+		for (machine a = 0; a < sampleCount; a++)
+		{
+			if (!std::isfinite(test.reference(sample[a])))
+			{
+				continue;
+			}
+
+			double divergence = (result[a] != other[a]) ? CalculateError(test.metric, result[a], other[a]) : 0.0;
+			if (!(divergence <= maxDivergence))
+			{
+				maxDivergence = divergence;
+				worstInput = sample[a];
+			}
+		}
+
+		bool pass = (maxDivergence <= test.divergence);
+		std::printf("%-12s [%-14.8g, %14.8g] divergence %-11.4g at %-14.8g threshold %-9.3g %s\n",
+			name, test.min, test.max, maxDivergence, worstInput, test.divergence, (pass) ? "PASS" : "FAIL");
+
+		return (pass);
+	}
+}
+
+
+int main(int argc, char **argv)
+{
+	machine sampleCount = 1 << 22;
+	const char *saveName = nullptr;
+	const char *compareName = nullptr;
+
+	for (int a = 1; a < argc; a++)
+	{
+		if ((std::strcmp(argv[a], "--samples") == 0) && (a + 1 < argc))
+		{
+			sampleCount = machine(std::strtoll(argv[++a], nullptr, 10));
+		}
+		else if ((std::strcmp(argv[a], "--save") == 0) && (a + 1 < argc))
+		{
+			saveName = argv[++a];
+		}
+		else if ((std::strcmp(argv[a], "--compare") == 0) && (a + 1 < argc))
+		{
+			compareName = argv[++a];
+		}
+		else
+		{
+			std::fprintf(stderr, "usage: %s [--samples count] [--save file | --compare file]\n", argv[0]);
+			return (2);
+		}
+	}
+
+	#if defined(TERATHON_NO_SIMD)
+		std::printf("Configuration: TERATHON_NO_SIMD\n\n");
+	#else
+		std::printf("Configuration: SIMD\n\n");
+	#endif
+
+	FILE *saveFile = (saveName) ? std::fopen(saveName, "wb") : nullptr;
+	FILE *compareFile = (compareName) ? std::fopen(compareName, "rb") : nullptr;
+	if (((saveName) && (!saveFile)) || ((compareName) && (!compareFile)))
+	{
+		std::fprintf(stderr, "cannot open %s\n", (saveName) ? saveName : compareName);
+		return (2);
+	}
+
+	bool pass = true;
+	std::vector<float> sample, result, arrayResult, other;
+
+	for (const AccuracyTest& test : accuracyTest)
+	{
+		GenerateSamples(test, sampleCount, sample);
+		machine count = machine(sample.size());
+
+		result.resize(count);
+		for (machine a = 0; a < count; a++)
+		{
+			result[a] = test.function(sample[a]);
+		}
+
+		pass &= ReportError(test.name, test, result.data(), sample);
+
+		if (test.arrayFunction)
+		{
+			char name[32];
+			std::snprintf(name, sizeof(name), "%s[]", test.name);
+
+			arrayResult.resize(count);
+			test.arrayFunction(sample.data(), arrayResult.data(), count);
+			pass &= ReportError(name, test, arrayResult.data(), sample);
+		}
+
+		if (saveFile)
+		{
+			std::fwrite(result.data(), sizeof(float), size_t(count), saveFile);
+		}
+		else if (compareFile)
+		{
+			other.resize(count);
+			if (std::fread(other.data(), sizeof(float), size_t(count), compareFile) != size_t(count))
+			{
+				std::fprintf(stderr, "%s does not match this sample count\n", compareName);
+				return (2);
+			}
+
+			pass &= CompareBuilds(test.name, test, result.data(), other.data(), sample);
+		}
+	}
+
+	if (saveFile)
+	{
+		std::fclose(saveFile);
+	}
+
+	if (compareFile)
+	{
+		std::fclose(compareFile);
+	}
+
+	std::printf("\n%s\n", (pass) ? "PASS" : "FAIL");
+	return ((pass) ? 0 : 1);
+}
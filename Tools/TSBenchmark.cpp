@@ -0,0 +1,401 @@
+//
+// This file is part of the Terathon Math Library, by Eric Lengyel.
+// Copyright 1999-2025, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+
+// Self-contained microbenchmark for the exported math functions. Each function is timed
+// with 1024 calls on independent inputs in single-element mode, and each array entry point
+// is timed with several element counts in batched mode. The results are written to stdout
+// as JSON, and the configuration field identifies the SIMD path that the library was built
+// with so that the output of the SIMD and TERATHON_NO_SIMD builds can be compared. The dispatch
+// field names the variant selected at run time when TSSimdAvx2.cpp or TSSimdAvx512.cpp was
+// compiled with its instruction set, or none when the baseline functions are used.
+//
+// g++ -std=c++17 -O2 -I. Tools/TSBenchmark.cpp TS*.cpp -o benchmark-simd
+// g++ -std=c++17 -O2 -I. -DTERATHON_NO_SIMD Tools/TSBenchmark.cpp TS*.cpp -o benchmark-scalar
+
+
+#include "TSFlector3D.h"
+#include "TSDouble3D.h"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+
+using namespace Terathon;
+
+
+namespace
+{
+	struct BenchmarkResult
+	{
+		const char		*name;
+		const char		*mode;
+		machine			count;
+		double			nanoseconds;
+	};
+
+
+	const machine kSingleCount = 1024;
+	const machine kBatchCount[3] = {16, 1024, 16384};
+	const machine kMaxCount = 16384;
+
+	std::vector<BenchmarkResult>	resultArray;
+	volatile float					sink;
+	uint32							randomState = 0x12345678;
+
+
+	const char *GetConfigurationName(void)
+	{
+		#if defined(TERATHON_NO_SIMD)
+			return ("no_simd");
+		#elif defined(TERATHON_AVX512)
+			return ("avx512");
+		#elif defined(TERATHON_AVX)
+			#if defined(TERATHON_FMA)
+				return ("avx_fma");
+			#else
+				return ("avx");
+			#endif
+		#elif defined(TERATHON_SSE4)
+			return ("sse4");
+		#elif defined(TERATHON_SSE)
+			return ("sse");
+		#elif defined(TERATHON_NEON)
+			return ("neon");
+		#else
+			return ("unknown");
+		#endif
+	}
+
+	const char *GetDispatchName(void)
+	{
+		#if !defined(TERATHON_NO_SIMD)
+
+			uint32 features = SimdGetDispatchFeatures();
+			if (features != SimdGetRequiredFeatures())
+			{
+				return ((features & kSimdFeatureAvx512) ? "avx512" : "avx2");
+			}
+
+		#endif
+
+		return ("none");
+	}
+
+	float RandomFloat(float min, float max)
+	{
+		randomState = randomState * 1664525U + 1013904223U;
+		return (min + (max - min) * float(randomState >> 8) * (1.0F / 16777216.0F));
+	}
+
+	Vector3D RandomVector(float range)
+	{
+		return (Vector3D(RandomFloat(-range, range), RandomFloat(-range, range), RandomFloat(-range, range)));
+	}
+
+	Quaternion RandomQuaternion(void)
+	{
+		Quaternion q(RandomFloat(-1.0F, 1.0F), RandomFloat(-1.0F, 1.0F), RandomFloat(-1.0F, 1.0F), RandomFloat(0.1F, 1.0F));
+		return (q * InverseSqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w));
+	}
+
+	Motor3D RandomMotor(void)
+	{
+		Motor3D Q(RandomQuaternion());
+		return (Motor3D::MakeTranslation(RandomVector(10.0F)) * Q);
+	}
+
+	Matrix3D RandomMatrix3D(void)
+	{
+		Matrix3D m;
+		for (machine j = 0; j < 3; j++)
+		{
+			for (machine i = 0; i < 3; i++)
+			{
+				m(i,j) = RandomFloat(-1.0F, 1.0F) + ((i == j) ? 3.0F : 0.0F);
+			}
+		}
+
+		return (m);
+	}
+
+	Matrix4D RandomMatrix4D(void)
+	{
+		Matrix4D m;
+		for (machine j = 0; j < 4; j++)
+		{
+			for (machine i = 0; i < 4; i++)
+			{
+				m(i,j) = RandomFloat(-1.0F, 1.0F) + ((i == j) ? 4.0F : 0.0F);
+			}
+		}
+
+		return (m);
+	}
+
+	Transform3D RandomTransform(void)
+	{
+		Transform3D m = RandomMotor().GetTransformMatrix();
+		Vector3D s(RandomFloat(0.5F, 2.0F), RandomFloat(0.5F, 2.0F), RandomFloat(0.5F, 2.0F));
+		return (m * Transform3D::MakeScale(s.x, s.y, s.z));
+	}
+
+	template <typename type>
+	void Consume(const type *data, machine count)
+	{
+		// Reads every float in the output so the compiler cannot discard the work.
+
+		const float *f = reinterpret_cast<const float *>(data);
+		machine n = count * machine(sizeof(type) / sizeof(float));
+		float sum = 0.0F;
+		for (machine a = 0; a < n; a++)
+		{
+			sum += f[a];
+		}
+
+		sink = sum;
+	}
+
+	template <typename function>
+	double Measure(function&& func, machine count)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		// Doubles the repetition count until a trial takes at least 5 ms, and then reports the best of five trials.
+
+		machine repeat = 1;
+		for (;;)
+		{
+			Clock::time_point start = Clock::now();
+			for (machine r = 0; r < repeat; r++)
+			{
+				func();
+			}
+
+			double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+			if (elapsed > 5.0e6)
+			{
+				break;
+			}
+
+			repeat *= 2;
+		}
+
+		double best = 1.0e300;
+		for (machine trial = 0; trial < 5; trial++)
+		{
+			Clock::time_point start = Clock::now();
+			for (machine r = 0; r < repeat; r++)
+			{
+				func();
+			}
+
+			double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+			best = Fmin(best, elapsed);
+		}
+
+		return (best / double(repeat * count));
+	}
+
+	template <typename function>
+	void BenchmarkSingle(const char *name, function&& func)
+	{
+		resultArray.push_back(BenchmarkResult{name, "single", kSingleCount, Measure(func, kSingleCount)});
+	}
+
+	template <typename function>
+	void BenchmarkBatch(const char *name, function&& func)
+	{
+		for (machine count : kBatchCount)
+		{
+			resultArray.push_back(BenchmarkResult{name, "batch", count, Measure([&]() {func(count);}, count)});
+		}
+	}
+
+	void WriteResults(void)
+	{
+		std::printf("{\n\t\"configuration\": \"%s\",\n\t\"dispatch\": \"%s\",\n\t\"results\": [\n", GetConfigurationName(), GetDispatchName());
+
+		machine count = machine(resultArray.size());
+		for (machine a = 0; a < count; a++)
+		{
+			const BenchmarkResult& result = resultArray[a];
+			std::printf("\t\t{\"name\": \"%s\", \"mode\": \"%s\", \"count\": %d, \"ns_per_op\": %.3f, \"mops_per_s\": %.2f}%s\n",
+				result.name, result.mode, int(result.count), result.nanoseconds, 1.0e3 / result.nanoseconds, (a + 1 < count) ? "," : "");
+		}
+
+		std::printf("\t]\n}\n");
+	}
+}
+
+
+int main(void)
+{
+	std::vector<float> angle(kMaxCount), positive(kMaxCount), unit(kMaxCount), param(kMaxCount);
+	std::vector<float> floatOut1(kMaxCount), floatOut2(kMaxCount);
+	std::vector<float> soaIn[3], soaOut[3];
+	std::vector<Quaternion> quat1(kMaxCount), quat2(kMaxCount), quatOut(kMaxCount);
+	std::vector<Motor3D> motor(kMaxCount), motorOut(kMaxCount);
+	std::vector<MotorInterpolator> interpolator(kMaxCount);
+	std::vector<Matrix3D> mat3(kMaxCount), mat3Out(kMaxCount);
+	std::vector<Matrix4D> mat4(kMaxCount), mat4Out(kMaxCount);
+	std::vector<Transform3D> xform(kMaxCount), rigid(kMaxCount), xformOut(kMaxCount);
+	std::vector<Point3D> point(kMaxCount), pointOut(kMaxCount);
+	std::vector<Vector3D> vector(kMaxCount), vectorOut1(kMaxCount), vectorOut2(kMaxCount), vectorOut3(kMaxCount);
+	std::vector<Line3D> line(kMaxCount), lineOut(kMaxCount);
+	std::vector<Plane3D> plane(kMaxCount), planeOut(kMaxCount);
+	std::vector<int32> parentIndex(kMaxCount), quatIndex(kMaxCount);
+	std::vector<float> matrixBuffer(kMaxCount * 16);
+
+	for (machine k = 0; k < 3; k++)
+	{
+		soaIn[k].resize(kMaxCount);
+		soaOut[k].resize(kMaxCount);
+	}
+
+	for (machine a = 0; a < kMaxCount; a++)
+	{
+		angle[a] = RandomFloat(-6.0F, 6.0F);
+		positive[a] = RandomFloat(0.01F, 80.0F);
+		unit[a] = RandomFloat(-1.0F, 1.0F);
+		param[a] = RandomFloat(0.0F, 1.0F);
+
+		for (machine k = 0; k < 3; k++)
+		{
+			soaIn[k][a] = RandomFloat(-10.0F, 10.0F);
+		}
+
+		quat1[a] = RandomQuaternion();
+		quat2[a] = RandomQuaternion();
+		motor[a] = RandomMotor();
+		interpolator[a].Set(motor[a], RandomMotor());
+		mat3[a] = RandomMatrix3D();
+		mat4[a] = RandomMatrix4D();
+		xform[a] = RandomTransform();
+		rigid[a] = RandomMotor().GetTransformMatrix();
+		point[a] = Point3D(RandomFloat(-10.0F, 10.0F), RandomFloat(-10.0F, 10.0F), RandomFloat(-10.0F, 10.0F));
+		vector[a] = RandomVector(10.0F);
+		line[a] = Line3D(unit[a], 0.5F, -0.25F, 1.0F, 2.0F, -3.0F);
+		plane[a] = Plane3D(0.6F, 0.0F, 0.8F, RandomFloat(-10.0F, 10.0F));
+		parentIndex[a] = (a == 0) ? -1 : int32((a - 1) >> 1);
+		quatIndex[a] = int32(randomState & (kMaxCount - 1));
+	}
+
+	const Quaternion& q = quat1[0];
+	const Motor3D& Q = motor[0];
+	const Transform3D& M = xform[0];
+
+	// Scalar math functions.
+
+	BenchmarkSingle("Sqrt", [&]() {for (machine a = 0; a < kSingleCount; a++) floatOut1[a] = Sqrt(positive[a]); Consume(floatOut1.data(), kSingleCount);});
+	BenchmarkSingle("InverseSqrt", [&]() {for (machine a = 0; a < kSingleCount; a++) floatOut1[a] = InverseSqrt(positive[a]); Consume(floatOut1.data(), kSingleCount);});
+	BenchmarkSingle("Sin", [&]() {for (machine a = 0; a < kSingleCount; a++) floatOut1[a] = Sin(angle[a]); Consume(floatOut1.data(), kSingleCount);});
+	BenchmarkSingle("Cos", [&]() {for (machine a = 0; a < kSingleCount; a++) floatOut1[a] = Cos(angle[a]); Consume(floatOut1.data(), kSingleCount);});
+	BenchmarkSingle("Tan", [&]() {for (machine a = 0; a < kSingleCount; a++) floatOut1[a] = Tan(unit[a]); Consume(floatOut1.data(), kSingleCount);});
+	BenchmarkSingle("CosSin", [&]() {for (machine a = 0; a < kSingleCount; a++) CosSin(angle[a], &floatOut1[a], &floatOut2[a]); Consume(floatOut1.data(), kSingleCount);});
+	BenchmarkSingle("Arcsin", [&]() {for (machine a = 0; a < kSingleCount; a++) floatOut1[a] = Arcsin(unit[a]); Consume(floatOut1.data(), kSingleCount);});
+	BenchmarkSingle("Arccos", [&]() {for (machine a = 0; a < kSingleCount; a++) floatOut1[a] = Arccos(unit[a]); Consume(floatOut1.data(), kSingleCount);});
+	BenchmarkSingle("Arctan", [&]() {for (machine a = 0; a < kSingleCount; a++) floatOut1[a] = Arctan(angle[a]); Consume(floatOut1.data(), kSingleCount);});
+	BenchmarkSingle("Arctan2", [&]() {for (machine a = 0; a < kSingleCount; a++) floatOut1[a] = Arctan(unit[a], angle[a]); Consume(floatOut1.data(), kSingleCount);});
+	BenchmarkSingle("Exp", [&]() {for (machine a = 0; a < kSingleCount; a++) floatOut1[a] = Exp(angle[a]); Consume(floatOut1.data(), kSingleCount);});
+	BenchmarkSingle("Log", [&]() {for (machine a = 0; a < kSingleCount; a++) floatOut1[a] = Log(positive[a]); Consume(floatOut1.data(), kSingleCount);});
+
+	BenchmarkBatch("Sin", [&](machine count) {Sin(angle.data(), floatOut1.data(), count); Consume(floatOut1.data(), count);});
+	BenchmarkBatch("Cos", [&](machine count) {Cos(angle.data(), floatOut1.data(), count); Consume(floatOut1.data(), count);});
+	BenchmarkBatch("Tan", [&](machine count) {Tan(unit.data(), floatOut1.data(), count); Consume(floatOut1.data(), count);});
+	BenchmarkBatch("CosSin", [&](machine count) {CosSin(angle.data(), floatOut1.data(), floatOut2.data(), count); Consume(floatOut1.data(), count);});
+	BenchmarkBatch("Arcsin", [&](machine count) {Arcsin(unit.data(), floatOut1.data(), count); Consume(floatOut1.data(), count);});
+	BenchmarkBatch("Arccos", [&](machine count) {Arccos(unit.data(), floatOut1.data(), count); Consume(floatOut1.data(), count);});
+	BenchmarkBatch("Arctan", [&](machine count) {Arctan(angle.data(), floatOut1.data(), count); Consume(floatOut1.data(), count);});
+	BenchmarkBatch("Arctan2", [&](machine count) {Arctan(unit.data(), angle.data(), floatOut1.data(), count); Consume(floatOut1.data(), count);});
+	BenchmarkBatch("Exp", [&](machine count) {Exp(angle.data(), floatOut1.data(), count); Consume(floatOut1.data(), count);});
+	BenchmarkBatch("Log", [&](machine count) {Log(positive.data(), floatOut1.data(), count); Consume(floatOut1.data(), count);});
+
+	// Matrices and transforms.
+
+	BenchmarkSingle("Inverse(Matrix3D)", [&]() {for (machine a = 0; a < kSingleCount; a++) mat3Out[a] = Inverse(mat3[a]); Consume(mat3Out.data(), kSingleCount);});
+	BenchmarkSingle("Inverse(Matrix4D)", [&]() {for (machine a = 0; a < kSingleCount; a++) mat4Out[a] = Inverse(mat4[a]); Consume(mat4Out.data(), kSingleCount);});
+	BenchmarkSingle("Determinant(Matrix4D)", [&]() {for (machine a = 0; a < kSingleCount; a++) floatOut1[a] = Determinant(mat4[a]); Consume(floatOut1.data(), kSingleCount);});
+	BenchmarkSingle("Matrix4D*Matrix4D", [&]() {for (machine a = 0; a < kSingleCount; a++) mat4Out[a] = mat4[a] * mat4[0]; Consume(mat4Out.data(), kSingleCount);});
+	BenchmarkSingle("Transform3D*Transform3D", [&]() {for (machine a = 0; a < kSingleCount; a++) xformOut[a] = xform[a] * M; Consume(xformOut.data(), kSingleCount);});
+	BenchmarkSingle("Transform3D*Point3D", [&]() {for (machine a = 0; a < kSingleCount; a++) pointOut[a] = xform[a] * point[a]; Consume(pointOut.data(), kSingleCount);});
+	BenchmarkSingle("Inverse(Transform3D)", [&]() {for (machine a = 0; a < kSingleCount; a++) xformOut[a] = Inverse(xform[a]); Consume(xformOut.data(), kSingleCount);});
+
+	BenchmarkBatch("Inverse(Matrix3D)", [&](machine count) {Inverse(mat3.data(), mat3Out.data(), count); Consume(mat3Out.data(), count);});
+	BenchmarkBatch("Inverse(Matrix4D)", [&](machine count) {Inverse(mat4.data(), mat4Out.data(), count); Consume(mat4Out.data(), count);});
+	BenchmarkBatch("MultiplyMatrices", [&](machine count) {MultiplyMatrices(mat4[0], mat4.data(), mat4Out.data(), count); Consume(mat4Out.data(), count);});
+	BenchmarkBatch("Inverse(Transform3D)", [&](machine count) {Inverse(xform.data(), xformOut.data(), count); Consume(xformOut.data(), count);});
+	BenchmarkBatch("TransformPoints(Transform3D)", [&](machine count) {TransformPoints(M, point.data(), pointOut.data(), count); Consume(pointOut.data(), count);});
+	BenchmarkBatch("TransformVectors(Transform3D)", [&](machine count) {TransformVectors(M, vector.data(), vectorOut1.data(), count); Consume(vectorOut1.data(), count);});
+	BenchmarkBatch("TransformPoints(Transform3D,SoA)", [&](machine count) {TransformPoints(M, soaIn[0].data(), soaIn[1].data(), soaIn[2].data(), soaOut[0].data(), soaOut[1].data(), soaOut[2].data(), count); Consume(soaOut[0].data(), count);});
+	BenchmarkBatch("StoreTransformMatrices(Transform3D)", [&](machine count) {StoreTransformMatrices(xform.data(), matrixBuffer.data(), count); Consume(matrixBuffer.data(), count * 16);});
+
+	// Quaternions.
+
+	BenchmarkSingle("Quaternion*Quaternion", [&]() {for (machine a = 0; a < kSingleCount; a++) quatOut[a] = quat1[a] * quat2[a]; Consume(quatOut.data(), kSingleCount);});
+	BenchmarkSingle("Transform(Vector3D,Quaternion)", [&]() {for (machine a = 0; a < kSingleCount; a++) vectorOut1[a] = Transform(vector[a], quat1[a]); Consume(vectorOut1.data(), kSingleCount);});
+	BenchmarkSingle("GetRotationMatrix", [&]() {for (machine a = 0; a < kSingleCount; a++) mat3Out[a] = quat1[a].GetRotationMatrix(); Consume(mat3Out.data(), kSingleCount);});
+	BenchmarkSingle("SetRotationMatrix", [&]() {for (machine a = 0; a < kSingleCount; a++) quatOut[a].SetRotationMatrix(rigid[a]); Consume(quatOut.data(), kSingleCount);});
+	BenchmarkSingle("Nlerp", [&]() {for (machine a = 0; a < kSingleCount; a++) quatOut[a] = Nlerp(quat1[a], quat2[a], param[a]); Consume(quatOut.data(), kSingleCount);});
+	BenchmarkSingle("Slerp", [&]() {for (machine a = 0; a < kSingleCount; a++) quatOut[a] = Slerp(quat1[a], quat2[a], param[a]); Consume(quatOut.data(), kSingleCount);});
+	BenchmarkSingle("CorrectedNlerp", [&]() {for (machine a = 0; a < kSingleCount; a++) quatOut[a] = CorrectedNlerp(quat1[a], quat2[a], param[a]); Consume(quatOut.data(), kSingleCount);});
+
+	BenchmarkBatch("TransformVectors(Quaternion,SoA)", [&](machine count) {TransformVectors(q, soaIn[0].data(), soaIn[1].data(), soaIn[2].data(), soaOut[0].data(), soaOut[1].data(), soaOut[2].data(), count); Consume(soaOut[0].data(), count);});
+	BenchmarkBatch("TransformVectors(Quaternion,Indexed)", [&](machine count) {TransformVectors(quat1.data(), quatIndex.data(), soaIn[0].data(), soaIn[1].data(), soaIn[2].data(), soaOut[0].data(), soaOut[1].data(), soaOut[2].data(), count); Consume(soaOut[0].data(), count);});
+	BenchmarkBatch("GetRotationMatrices", [&](machine count) {GetRotationMatrices(quat1.data(), mat3Out.data(), count); Consume(mat3Out.data(), count);});
+	BenchmarkBatch("SetRotationMatrices", [&](machine count) {SetRotationMatrices(rigid.data(), quatOut.data(), count); Consume(quatOut.data(), count);});
+	BenchmarkBatch("Nlerp", [&](machine count) {Nlerp(quat1.data(), quat2.data(), param.data(), quatOut.data(), count); Consume(quatOut.data(), count);});
+	BenchmarkBatch("Slerp", [&](machine count) {Slerp(quat1.data(), quat2.data(), param.data(), quatOut.data(), count); Consume(quatOut.data(), count);});
+	BenchmarkBatch("CorrectedNlerp", [&](machine count) {CorrectedNlerp(quat1.data(), quat2.data(), param.data(), quatOut.data(), count); Consume(quatOut.data(), count);});
+
+	// Motors and flectors.
+
+	BenchmarkSingle("Motor3D*Motor3D", [&]() {for (machine a = 0; a < kSingleCount; a++) motorOut[a] = motor[a] * Q; Consume(motorOut.data(), kSingleCount);});
+	BenchmarkSingle("Transform(Point3D,Motor3D)", [&]() {for (machine a = 0; a < kSingleCount; a++) pointOut[a] = Transform(point[a], motor[a]); Consume(pointOut.data(), kSingleCount);});
+	BenchmarkSingle("Transform(Line3D,Motor3D)", [&]() {for (machine a = 0; a < kSingleCount; a++) lineOut[a] = Transform(line[a], motor[a]); Consume(lineOut.data(), kSingleCount);});
+	BenchmarkSingle("Transform(Plane3D,Motor3D)", [&]() {for (machine a = 0; a < kSingleCount; a++) planeOut[a] = Transform(plane[a], motor[a]); Consume(planeOut.data(), kSingleCount);});
+	BenchmarkSingle("Motor3D::GetTransformMatrix", [&]() {for (machine a = 0; a < kSingleCount; a++) xformOut[a] = motor[a].GetTransformMatrix(); Consume(xformOut.data(), kSingleCount);});
+	BenchmarkSingle("Motor3D::SetTransformMatrix", [&]() {for (machine a = 0; a < kSingleCount; a++) motorOut[a].SetTransformMatrix(rigid[a]); Consume(motorOut.data(), kSingleCount);});
+	BenchmarkSingle("Sqrt(Motor3D)", [&]() {for (machine a = 0; a < kSingleCount; a++) motorOut[a] = Sqrt(motor[a]); Consume(motorOut.data(), kSingleCount);});
+	BenchmarkSingle("Log(Motor3D)", [&]() {for (machine a = 0; a < kSingleCount; a++) lineOut[a] = Log(motor[a]); Consume(lineOut.data(), kSingleCount);});
+	BenchmarkSingle("Exp(Line3D)", [&]() {for (machine a = 0; a < kSingleCount; a++) motorOut[a] = Exp(line[a]); Consume(motorOut.data(), kSingleCount);});
+	BenchmarkSingle("Sclerp", [&]() {for (machine a = 0; a < kSingleCount; a++) motorOut[a] = Sclerp(Q, motor[a], param[a]); Consume(motorOut.data(), kSingleCount);});
+	BenchmarkSingle("MotorInterpolator::Evaluate", [&]() {for (machine a = 0; a < kSingleCount; a++) motorOut[a] = interpolator[a].Evaluate(param[a]); Consume(motorOut.data(), kSingleCount);});
+
+	BenchmarkBatch("TransformPoints(Motor3D)", [&](machine count) {TransformPoints(Q, point.data(), pointOut.data(), count); Consume(pointOut.data(), count);});
+	BenchmarkBatch("TransformVectors(Motor3D)", [&](machine count) {TransformVectors(Q, vector.data(), vectorOut1.data(), count); Consume(vectorOut1.data(), count);});
+	BenchmarkBatch("TransformLines(Motor3D)", [&](machine count) {TransformLines(Q, line.data(), lineOut.data(), count); Consume(lineOut.data(), count);});
+	BenchmarkBatch("TransformPlanes(Motor3D)", [&](machine count) {TransformPlanes(Q, plane.data(), planeOut.data(), count); Consume(planeOut.data(), count);});
+	BenchmarkBatch("StoreTransformMatrices(Motor3D)", [&](machine count) {StoreTransformMatrices(motor.data(), matrixBuffer.data(), count); Consume(matrixBuffer.data(), count * 16);});
+	BenchmarkBatch("SetTransformMatrices", [&](machine count) {SetTransformMatrices(rigid.data(), motorOut.data(), count); Consume(motorOut.data(), count);});
+	BenchmarkBatch("PropagateMotors", [&](machine count) {PropagateMotors(motor.data(), parentIndex.data(), motorOut.data(), xformOut.data(), count); Consume(motorOut.data(), count);});
+	BenchmarkBatch("MotorInterpolator::Evaluate", [&](machine count) {interpolator[0].Evaluate(param.data(), motorOut.data(), count); Consume(motorOut.data(), count);});
+	BenchmarkBatch("EvaluateMotorInterpolators", [&](machine count) {EvaluateMotorInterpolators(interpolator.data(), param.data(), motorOut.data(), count); Consume(motorOut.data(), count);});
+
+	Flector3D F(0.0F, 0.0F, 0.0F, 0.0F, 0.6F, 0.0F, 0.8F, 2.0F);
+	BenchmarkBatch("TransformPoints(Flector3D)", [&](machine count) {TransformPoints(F, point.data(), pointOut.data(), count); Consume(pointOut.data(), count);});
+	BenchmarkBatch("TransformLines(Flector3D)", [&](machine count) {TransformLines(F, line.data(), lineOut.data(), count); Consume(lineOut.data(), count);});
+
+	// Decompositions.
+
+	BenchmarkSingle("CalculateEigensystem", [&]() {for (machine a = 0; a < kSingleCount; a++) CalculateEigensystem(mat3[a], &vectorOut1[a], &quatOut[a]); Consume(quatOut.data(), kSingleCount);});
+	BenchmarkSingle("CalculateSingularValueDecomposition", [&]() {for (machine a = 0; a < kSingleCount; a++) CalculateSingularValueDecomposition(mat3[a], &quatOut[a], &vectorOut1[a], &quat2[a]); Consume(quatOut.data(), kSingleCount);});
+	BenchmarkSingle("CalculatePolarDecomposition", [&]() {for (machine a = 0; a < kSingleCount; a++) CalculatePolarDecomposition(xform[a], &quatOut[a], &mat3Out[a]); Consume(quatOut.data(), kSingleCount);});
+	BenchmarkSingle("DecomposeTransform", [&]() {for (machine a = 0; a < kSingleCount; a++) DecomposeTransform(xform[a], &vectorOut1[a], &quatOut[a], &vectorOut2[a], &vectorOut3[a]); Consume(quatOut.data(), kSingleCount);});
+	BenchmarkSingle("ComposeTransform", [&]() {for (machine a = 0; a < kSingleCount; a++) xformOut[a] = ComposeTransform(vector[a], quat1[a], vector[a], vector[a]); Consume(xformOut.data(), kSingleCount);});
+
+	BenchmarkBatch("CalculateEigensystems", [&](machine count) {CalculateEigensystems(mat3.data(), vectorOut1.data(), quatOut.data(), count); Consume(quatOut.data(), count);});
+	BenchmarkBatch("CalculateSingularValueDecompositions", [&](machine count) {CalculateSingularValueDecompositions(mat3.data(), quatOut.data(), vectorOut1.data(), quat2.data(), count); Consume(quatOut.data(), count);});
+	BenchmarkBatch("CalculatePolarDecompositions", [&](machine count) {CalculatePolarDecompositions(xform.data(), quatOut.data(), mat3Out.data(), count); Consume(quatOut.data(), count);});
+	BenchmarkBatch("DecomposeTransforms", [&](machine count) {DecomposeTransforms(xform.data(), vectorOut1.data(), quatOut.data(), vectorOut2.data(), vectorOut3.data(), count); Consume(quatOut.data(), count);});
+	BenchmarkBatch("ComposeTransforms", [&](machine count) {ComposeTransforms(vector.data(), quat1.data(), vector.data(), vector.data(), xformOut.data(), count); Consume(xformOut.data(), count);});
+
+	WriteResults();
+	return (0);
+}
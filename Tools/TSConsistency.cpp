@@ -0,0 +1,325 @@
+//
+// This file is part of the Terathon Math Library, by Eric Lengyel.
+// Copyright 1999-2025, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+
+// Self-contained consistency test for the array functions that are documented to produce the same
+// results as the corresponding single-element functions. Each array function is applied to random
+// inputs, including counts that exercise the scalar tails of the SIMD kernels, and every result is
+// compared bit for bit with the single-element function. When the library is compiled with FMA, the
+// compiler may fuse multiplies and adds differently in the two code paths, so the test instead fails
+// when a component differs by more than a few roundings of the largest term in its sum.
+//
+// g++ -std=c++17 -O2 -I. Tools/TSConsistency.cpp TS*.cpp -o consistency && ./consistency
+// g++ -std=c++17 -O2 -I. -DTERATHON_NO_SIMD Tools/TSConsistency.cpp TS*.cpp -o consistency-scalar && ./consistency-scalar
+//
+// The --count option changes the number of inputs transformed by each random motor or flector and the
+// number of motors or flectors converted to matrices at once.
+
+
+#include "TSMotor3D.h"
+#include "TSFlector3D.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+
+using namespace Terathon;
+
+
+namespace
+{
+	struct ConsistencyResult
+	{
+		machine			elementCount;
+		machine			mismatchCount;
+		double			maxError;
+	};
+
+	typedef void ConsistencyFunction(machine count, ConsistencyResult *result);
+
+	struct ConsistencyTest
+	{
+		const char				*name;
+		ConsistencyFunction		*function;
+	};
+
+
+	// Errors are measured in units of FLT_EPSILON times the magnitude of the largest term summed for a component.
+	// This bound only applies when the library is compiled with FMA. Otherwise, every result must be identical.
+
+	const double kFusedBound = 8.0;
+
+	const machine kTransformCount = 64;
+
+	uint32 randomState = 0x12345678;
+
+
+	float RandomFloat(float min, float max)
+	{
+		randomState = randomState * 1664525U + 1013904223U;
+		return (min + (max - min) * float(randomState >> 8) * (1.0F / 16777216.0F));
+	}
+
+	Vector3D RandomVector(float range)
+	{
+		return (Vector3D(RandomFloat(-range, range), RandomFloat(-range, range), RandomFloat(-range, range)));
+	}
+
+	Quaternion RandomQuaternion(void)
+	{
+		Quaternion q(RandomFloat(-1.0F, 1.0F), RandomFloat(-1.0F, 1.0F), RandomFloat(-1.0F, 1.0F), RandomFloat(0.1F, 1.0F));
+		return (q * InverseSqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w));
+	}
+
+	Motor3D RandomMotor(void)
+	{
+		Motor3D Q(RandomQuaternion());
+		return (Motor3D::MakeTranslation(RandomVector(10.0F)) * Q);
+	}
+
+	Flector3D RandomFlector(void)
+	{
+		Vector3D n = Normalize(RandomVector(1.0F) + Vector3D(0.0F, 0.0F, 2.0F));
+		Flector3D F(Plane3D(n.x, n.y, n.z, RandomFloat(-10.0F, 10.0F)));
+		return (RandomMotor() * F);
+	}
+
+	void RandomTransform(Motor3D *Q)
+	{
+		*Q = RandomMotor();
+	}
+
+	void RandomTransform(Flector3D *F)
+	{
+		*F = RandomFlector();
+	}
+
+	Line3D RandomLine(void)
+	{
+		return (Line3D(RandomVector(1.0F), Bivector3D(RandomFloat(-10.0F, 10.0F), RandomFloat(-10.0F, 10.0F), RandomFloat(-10.0F, 10.0F))));
+	}
+
+	Plane3D RandomPlane(void)
+	{
+		return (Plane3D(RandomFloat(-1.0F, 1.0F), RandomFloat(-1.0F, 1.0F), RandomFloat(-1.0F, 1.0F), RandomFloat(-10.0F, 10.0F)));
+	}
+
+	float Magnitude(const float *v, machine size)
+	{
+		float m = 0.0F;
+		for (machine i = 0; i < size; i++)
+		{
+			m = Fmax(m, Fabs(v[i]));
+		}
+
+		return (m);
+	}
+
+	float Magnitude(const Motor3D& Q)
+	{
+		return (Magnitude(&Q.v.x, 4) + Magnitude(&Q.m.x, 4));
+	}
+
+	float Magnitude(const Flector3D& F)
+	{
+		return (Magnitude(&F.p.x, 4) + Magnitude(&F.g.x, 4));
+	}
+
+	// Each component of a sandwich product is a sum of terms that are quadratic in the motor or flector and linear
+	// in the input, so the product of the squared motor or flector magnitude and the input magnitude bounds them.
+
+	void Compare(const float *result, const float *reference, machine size, float scale, ConsistencyResult *consistency)
+	{
+		if (std::memcmp(result, reference, size * sizeof(float)) != 0)
+		{
+			consistency->mismatchCount++;
+
+			for (machine i = 0; i < size; i++)
+			{
+				double error = std::fabs(double(result[i]) - double(reference[i])) / (double(scale) * double(FLT_EPSILON));
+				if (!(error <= consistency->maxError))
+				{
+					consistency->maxError = error;
+				}
+			}
+		}
+
+		consistency->elementCount++;
+	}
+
+	template <class transform> void TestLines(machine count, ConsistencyResult *consistency)
+	{
+		std::vector<Line3D> in(count), out(count);
+
+		for (machine k = 0; k < kTransformCount; k++)
+		{
+			transform T;
+			RandomTransform(&T);
+			float transformScale = Magnitude(T);
+
+			machine n = count - k;
+			for (machine a = 0; a < n; a++)
+			{
+				in[a] = RandomLine();
+			}
+
+			TransformLines(T, in.data(), out.data(), n);
+
+			for (machine a = 0; a < n; a++)
+			{
+				Line3D reference = Transform(in[a], T);
+				float scale = transformScale * transformScale * Magnitude(&in[a].v.x, 6);
+				Compare(&out[a].v.x, &reference.v.x, 6, scale, consistency);
+			}
+		}
+	}
+
+	template <class transform> void TestPlanes(machine count, ConsistencyResult *consistency)
+	{
+		std::vector<Plane3D> in(count), out(count);
+
+		for (machine k = 0; k < kTransformCount; k++)
+		{
+			transform T;
+			RandomTransform(&T);
+			float transformScale = Magnitude(T);
+
+			machine n = count - k;
+			for (machine a = 0; a < n; a++)
+			{
+				in[a] = RandomPlane();
+			}
+
+			TransformPlanes(T, in.data(), out.data(), n);
+
+			for (machine a = 0; a < n; a++)
+			{
+				Plane3D reference = Transform(in[a], T);
+				float scale = transformScale * transformScale * Magnitude(&in[a].x, 4);
+				Compare(&out[a].x, &reference.x, 4, scale, consistency);
+			}
+		}
+	}
+
+
+	template <class transform> void TestMatrices(machine count, ConsistencyResult *consistency)
+	{
+		std::vector<transform> in(count);
+		std::vector<float> columnMatrix(count * 16), rowMatrix(count * 12);
+
+		for (machine k = 0; k < kTransformCount; k++)
+		{
+			machine n = count - k;
+			for (machine a = 0; a < n; a++)
+			{
+				RandomTransform(&in[a]);
+			}
+
+			StoreTransformMatrices(in.data(), columnMatrix.data(), n);
+			StoreTransformMatrices(in.data(), rowMatrix.data(), n, kMatrixStoreRowMajor | kMatrixStore3x4);
+
+			for (machine a = 0; a < n; a++)
+			{
+				float	columnReference[16], rowReference[12];
+
+				Transform3D m = in[a].GetTransformMatrix();
+				for (machine j = 0; j < 4; j++)
+				{
+					for (machine i = 0; i < 4; i++)
+					{
+						columnReference[j * 4 + i] = m(i,j);
+						if (i < 3)
+						{
+							rowReference[i * 4 + j] = m(i,j);
+						}
+					}
+				}
+
+				float scale = Magnitude(in[a]);
+				scale *= scale;
+
+				Compare(&columnMatrix[a * 16], columnReference, 16, scale, consistency);
+				Compare(&rowMatrix[a * 12], rowReference, 12, scale, consistency);
+			}
+		}
+	}
+
+
+	const ConsistencyTest consistencyTest[] =
+	{
+		{"TransformLines(Motor3D)", &TestLines<Motor3D>},
+		{"TransformPlanes(Motor3D)", &TestPlanes<Motor3D>},
+		{"TransformLines(Flector3D)", &TestLines<Flector3D>},
+		{"TransformPlanes(Flector3D)", &TestPlanes<Flector3D>},
+		{"StoreTransformMatrices(Motor3D)", &TestMatrices<Motor3D>},
+		{"StoreTransformMatrices(Flector3D)", &TestMatrices<Flector3D>}
+	};
+}
+
+
+int main(int argc, char **argv)
+{
+	machine count = 1024;
+
+	for (int a = 1; a < argc; a++)
+	{
+		if ((std::strcmp(argv[a], "--count") == 0) && (a + 1 < argc))
+		{
+			count = machine(std::strtoll(argv[++a], nullptr, 10));
+		}
+		else
+		{
+			std::fprintf(stderr, "usage: %s [--count count]\n", argv[0]);
+			return (2);
+		}
+	}
+
+	if (count < kTransformCount)
+	{
+		std::fprintf(stderr, "the count must be at least %d\n", int(kTransformCount));
+		return (2);
+	}
+
+	#if defined(TERATHON_NO_SIMD)
+		std::printf("Configuration: TERATHON_NO_SIMD");
+	#else
+		std::printf("Configuration: SIMD");
+	#endif
+
+	#if defined(TERATHON_FMA)
+		std::printf(", TERATHON_FMA (bound %g)\n\n", kFusedBound);
+	#else
+		std::printf(" (bit for bit)\n\n");
+	#endif
+
+	bool pass = true;
+
+	for (const ConsistencyTest& test : consistencyTest)
+	{
+		ConsistencyResult consistency = {0, 0, 0.0};
+		test.function(count, &consistency);
+
+		#if defined(TERATHON_FMA)
+			bool testPass = (consistency.maxError <= kFusedBound);
+		#else
+			bool testPass = (consistency.mismatchCount == 0);
+		#endif
+
+		std::printf("%-32s %9d elements  %9d mismatches  max %-11.4g %s\n",
+			test.name, int(consistency.elementCount), int(consistency.mismatchCount), consistency.maxError, (testPass) ? "PASS" : "FAIL");
+
+		pass &= testPass;
+	}
+
+	std::printf("\n%s\n", (pass) ? "PASS" : "FAIL");
+	return ((pass) ? 0 : 1);
+}